@@ -0,0 +1,26 @@
+/** Algebra plugins library, part of the ACTS project
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "algebra/array_cmath.hpp"
+#include "benchmark/common/benchmark_accuracy.hpp"
+
+// System include(s)
+#include <iostream>
+
+using namespace algebra;
+
+/// Run the accuracy checks
+int main() {
+
+  std::cout << "-----------------------------------------------\n"
+            << "Algebra-Plugins 'accuracy' (std::array)\n"
+            << "-----------------------------------------------\n";
+
+  accuracy_report<plugin::array<float>>{}(std::cout, "array<float>");
+  accuracy_report<plugin::array<double>>{}(std::cout, "array<double>");
+}
@@ -0,0 +1,57 @@
+/** Algebra plugins library, part of the ACTS project
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "algebra/array_cmath.hpp"
+#include "benchmark/array/data_generator.hpp"
+#include "benchmark/common/benchmark_fits.hpp"
+
+// Benchmark include
+#include <benchmark/benchmark.h>
+
+// System include(s)
+#include <iostream>
+
+using namespace algebra;
+
+/// Run the line and circle fit benchmarks
+int main(int argc, char** argv) {
+
+  //
+  // Prepare benchmarks
+  //
+  algebra::benchmark_base::configuration cfg{};
+  cfg.n_samples(100000);
+
+  using fit_3_line_f_t = fit_bm<plugin::array<float>, 3, bench_op::line_fit>;
+  using fit_3_line_d_t = fit_bm<plugin::array<double>, 3, bench_op::line_fit>;
+  using fit_10_line_f_t = fit_bm<plugin::array<float>, 10, bench_op::line_fit>;
+  using fit_10_line_d_t =
+      fit_bm<plugin::array<double>, 10, bench_op::line_fit>;
+  using fit_3_circle_f_t =
+      fit_bm<plugin::array<float>, 3, bench_op::circle_fit>;
+  using fit_3_circle_d_t =
+      fit_bm<plugin::array<double>, 3, bench_op::circle_fit>;
+  using fit_10_circle_f_t =
+      fit_bm<plugin::array<float>, 10, bench_op::circle_fit>;
+  using fit_10_circle_d_t =
+      fit_bm<plugin::array<double>, 10, bench_op::circle_fit>;
+
+  std::cout << "-----------------------------------------------\n"
+            << "Algebra-Plugins 'fit' benchmark (std::array)\n"
+            << "-----------------------------------------------\n\n"
+            << cfg;
+
+  //
+  // Register all benchmarks
+  //
+  ALGEBRA_PLUGINS_REGISTER_FIT_BENCH(cfg, cfg)
+
+  ::benchmark::Initialize(&argc, argv);
+  ::benchmark::RunSpecifiedBenchmarks();
+  ::benchmark::Shutdown();
+}
@@ -27,6 +27,10 @@ int main(int argc, char** argv) {
   algebra::benchmark_base::configuration cfg{};
   cfg.n_samples(100000);
 
+  // The decomposition benchmarks keep several matrices per sample
+  algebra::benchmark_base::configuration cfg_decomp{cfg};
+  cfg_decomp.n_samples(10000);
+
   using mat44_transp_f_t =
       matrix_unaryOP_bm<array::matrix_type<float, 4, 4>, bench_op::transpose>;
   using mat44_transp_d_t =
@@ -105,6 +109,179 @@ int main(int argc, char** argv) {
   using mat88_vec_d_t = matrix_vector_bm<array::matrix_type<double, 8, 8>,
                                          array::vector_type<double, 8>>;
 
+  using mat33_inv_f_t =
+      matrix_unaryOP_bm<array::matrix_type<float, 3, 3>, bench_op::invert>;
+  using mat33_inv_d_t =
+      matrix_unaryOP_bm<array::matrix_type<double, 3, 3>, bench_op::invert>;
+  using mat55_inv_f_t =
+      matrix_unaryOP_bm<array::matrix_type<float, 5, 5>, bench_op::invert>;
+  using mat55_inv_d_t =
+      matrix_unaryOP_bm<array::matrix_type<double, 5, 5>, bench_op::invert>;
+
+  using mat33_inv_lud_f_t =
+      matrix_unaryOP_bm<array::matrix_type<float, 3, 3>, bench_op::invert_lud>;
+  using mat33_inv_lud_d_t =
+      matrix_unaryOP_bm<array::matrix_type<double, 3, 3>, bench_op::invert_lud>;
+  using mat44_inv_lud_f_t =
+      matrix_unaryOP_bm<array::matrix_type<float, 4, 4>, bench_op::invert_lud>;
+  using mat44_inv_lud_d_t =
+      matrix_unaryOP_bm<array::matrix_type<double, 4, 4>, bench_op::invert_lud>;
+  using mat55_inv_lud_f_t =
+      matrix_unaryOP_bm<array::matrix_type<float, 5, 5>, bench_op::invert_lud>;
+  using mat55_inv_lud_d_t =
+      matrix_unaryOP_bm<array::matrix_type<double, 5, 5>, bench_op::invert_lud>;
+  using mat66_inv_lud_f_t =
+      matrix_unaryOP_bm<array::matrix_type<float, 6, 6>, bench_op::invert_lud>;
+  using mat66_inv_lud_d_t =
+      matrix_unaryOP_bm<array::matrix_type<double, 6, 6>, bench_op::invert_lud>;
+
+  using mat33_det_f_t =
+      matrix_unaryOP_bm<array::matrix_type<float, 3, 3>, bench_op::determinant>;
+  using mat33_det_d_t = matrix_unaryOP_bm<array::matrix_type<double, 3, 3>,
+                                          bench_op::determinant>;
+  using mat55_det_f_t =
+      matrix_unaryOP_bm<array::matrix_type<float, 5, 5>, bench_op::determinant>;
+  using mat55_det_d_t = matrix_unaryOP_bm<array::matrix_type<double, 5, 5>,
+                                          bench_op::determinant>;
+
+  using mat33_det_lud_f_t = matrix_unaryOP_bm<array::matrix_type<float, 3, 3>,
+                                              bench_op::determinant_lud>;
+  using mat33_det_lud_d_t = matrix_unaryOP_bm<array::matrix_type<double, 3, 3>,
+                                              bench_op::determinant_lud>;
+  using mat44_det_lud_f_t = matrix_unaryOP_bm<array::matrix_type<float, 4, 4>,
+                                              bench_op::determinant_lud>;
+  using mat44_det_lud_d_t = matrix_unaryOP_bm<array::matrix_type<double, 4, 4>,
+                                              bench_op::determinant_lud>;
+  using mat55_det_lud_f_t = matrix_unaryOP_bm<array::matrix_type<float, 5, 5>,
+                                              bench_op::determinant_lud>;
+  using mat55_det_lud_d_t = matrix_unaryOP_bm<array::matrix_type<double, 5, 5>,
+                                              bench_op::determinant_lud>;
+  using mat66_det_lud_f_t = matrix_unaryOP_bm<array::matrix_type<float, 6, 6>,
+                                              bench_op::determinant_lud>;
+  using mat66_det_lud_d_t = matrix_unaryOP_bm<array::matrix_type<double, 6, 6>,
+                                              bench_op::determinant_lud>;
+
+  using mat55_chol_up_f_t =
+      matrix_cholesky_bm<array::matrix_type<float, 5, 5>,
+                         bench_op::cholesky_update>;
+  using mat55_chol_up_d_t =
+      matrix_cholesky_bm<array::matrix_type<double, 5, 5>,
+                         bench_op::cholesky_update>;
+  using mat66_chol_up_f_t =
+      matrix_cholesky_bm<array::matrix_type<float, 6, 6>,
+                         bench_op::cholesky_update>;
+  using mat66_chol_up_d_t =
+      matrix_cholesky_bm<array::matrix_type<double, 6, 6>,
+                         bench_op::cholesky_update>;
+  using mat88_chol_up_f_t =
+      matrix_cholesky_bm<array::matrix_type<float, 8, 8>,
+                         bench_op::cholesky_update>;
+  using mat88_chol_up_d_t =
+      matrix_cholesky_bm<array::matrix_type<double, 8, 8>,
+                         bench_op::cholesky_update>;
+
+  using mat55_chol_down_f_t =
+      matrix_cholesky_bm<array::matrix_type<float, 5, 5>,
+                         bench_op::cholesky_downdate>;
+  using mat55_chol_down_d_t =
+      matrix_cholesky_bm<array::matrix_type<double, 5, 5>,
+                         bench_op::cholesky_downdate>;
+  using mat66_chol_down_f_t =
+      matrix_cholesky_bm<array::matrix_type<float, 6, 6>,
+                         bench_op::cholesky_downdate>;
+  using mat66_chol_down_d_t =
+      matrix_cholesky_bm<array::matrix_type<double, 6, 6>,
+                         bench_op::cholesky_downdate>;
+  using mat88_chol_down_f_t =
+      matrix_cholesky_bm<array::matrix_type<float, 8, 8>,
+                         bench_op::cholesky_downdate>;
+  using mat88_chol_down_d_t =
+      matrix_cholesky_bm<array::matrix_type<double, 8, 8>,
+                         bench_op::cholesky_downdate>;
+
+  using mat55_chol_refac_f_t =
+      matrix_cholesky_bm<array::matrix_type<float, 5, 5>,
+                         bench_op::cholesky_refactor>;
+  using mat55_chol_refac_d_t =
+      matrix_cholesky_bm<array::matrix_type<double, 5, 5>,
+                         bench_op::cholesky_refactor>;
+  using mat66_chol_refac_f_t =
+      matrix_cholesky_bm<array::matrix_type<float, 6, 6>,
+                         bench_op::cholesky_refactor>;
+  using mat66_chol_refac_d_t =
+      matrix_cholesky_bm<array::matrix_type<double, 6, 6>,
+                         bench_op::cholesky_refactor>;
+  using mat88_chol_refac_f_t =
+      matrix_cholesky_bm<array::matrix_type<float, 8, 8>,
+                         bench_op::cholesky_refactor>;
+  using mat88_chol_refac_d_t =
+      matrix_cholesky_bm<array::matrix_type<double, 8, 8>,
+                         bench_op::cholesky_refactor>;
+
+  using mat10x3_ls_qr_f_t =
+      matrix_least_squares_bm<array::matrix_type<float, 10, 3>,
+                              bench_op::least_squares_qr>;
+  using mat10x3_ls_qr_d_t =
+      matrix_least_squares_bm<array::matrix_type<double, 10, 3>,
+                              bench_op::least_squares_qr>;
+  using mat16x5_ls_qr_f_t =
+      matrix_least_squares_bm<array::matrix_type<float, 16, 5>,
+                              bench_op::least_squares_qr>;
+  using mat16x5_ls_qr_d_t =
+      matrix_least_squares_bm<array::matrix_type<double, 16, 5>,
+                              bench_op::least_squares_qr>;
+  using mat32x5_ls_qr_f_t =
+      matrix_least_squares_bm<array::matrix_type<float, 32, 5>,
+                              bench_op::least_squares_qr>;
+  using mat32x5_ls_qr_d_t =
+      matrix_least_squares_bm<array::matrix_type<double, 32, 5>,
+                              bench_op::least_squares_qr>;
+
+  using mat10x3_ls_lud_f_t =
+      matrix_least_squares_bm<array::matrix_type<float, 10, 3>,
+                              bench_op::least_squares_lud>;
+  using mat10x3_ls_lud_d_t =
+      matrix_least_squares_bm<array::matrix_type<double, 10, 3>,
+                              bench_op::least_squares_lud>;
+  using mat16x5_ls_lud_f_t =
+      matrix_least_squares_bm<array::matrix_type<float, 16, 5>,
+                              bench_op::least_squares_lud>;
+  using mat16x5_ls_lud_d_t =
+      matrix_least_squares_bm<array::matrix_type<double, 16, 5>,
+                              bench_op::least_squares_lud>;
+  using mat32x5_ls_lud_f_t =
+      matrix_least_squares_bm<array::matrix_type<float, 32, 5>,
+                              bench_op::least_squares_lud>;
+  using mat32x5_ls_lud_d_t =
+      matrix_least_squares_bm<array::matrix_type<double, 32, 5>,
+                              bench_op::least_squares_lud>;
+
+  using mat44_pinv_f_t = matrix_unaryOP_bm<array::matrix_type<float, 4, 4>,
+                                           bench_op::pseudo_inverse>;
+  using mat44_pinv_d_t = matrix_unaryOP_bm<array::matrix_type<double, 4, 4>,
+                                           bench_op::pseudo_inverse>;
+  using mat66_pinv_f_t = matrix_unaryOP_bm<array::matrix_type<float, 6, 6>,
+                                           bench_op::pseudo_inverse>;
+  using mat66_pinv_d_t = matrix_unaryOP_bm<array::matrix_type<double, 6, 6>,
+                                           bench_op::pseudo_inverse>;
+  using mat88_pinv_f_t = matrix_unaryOP_bm<array::matrix_type<float, 8, 8>,
+                                           bench_op::pseudo_inverse>;
+  using mat88_pinv_d_t = matrix_unaryOP_bm<array::matrix_type<double, 8, 8>,
+                                           bench_op::pseudo_inverse>;
+
+  using mat22_eig_f_t =
+      matrix_symmetric_eigen_bm<array::matrix_type<float, 2, 2>,
+                                bench_op::symmetric_eigen>;
+  using mat22_eig_d_t =
+      matrix_symmetric_eigen_bm<array::matrix_type<double, 2, 2>,
+                                bench_op::symmetric_eigen>;
+  using mat33_eig_f_t =
+      matrix_symmetric_eigen_bm<array::matrix_type<float, 3, 3>,
+                                bench_op::symmetric_eigen>;
+  using mat33_eig_d_t =
+      matrix_symmetric_eigen_bm<array::matrix_type<double, 3, 3>,
+                                bench_op::symmetric_eigen>;
+
   std::cout << "-----------------------------------------------\n"
             << "Algebra-Plugins 'matrix' benchmark (std::array)\n"
             << "-----------------------------------------------\n\n"
@@ -114,6 +291,11 @@ int main(int argc, char** argv) {
   // Register all benchmarks
   //
   ALGEBRA_PLUGINS_REGISTER_MATRIX_BENCH(cfg)
+  ALGEBRA_PLUGINS_REGISTER_MATRIX_ALGORITHM_BENCH(cfg)
+  ALGEBRA_PLUGINS_REGISTER_CHOLESKY_BENCH(cfg_decomp)
+  ALGEBRA_PLUGINS_REGISTER_LEAST_SQUARES_BENCH(cfg_decomp)
+  ALGEBRA_PLUGINS_REGISTER_PSEUDO_INVERSE_BENCH(cfg)
+  ALGEBRA_PLUGINS_REGISTER_SYMMETRIC_EIGEN_BENCH(cfg)
 
   ::benchmark::Initialize(&argc, argv);
   ::benchmark::RunSpecifiedBenchmarks();
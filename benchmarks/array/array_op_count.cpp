@@ -0,0 +1,181 @@
+/** Algebra plugins library, part of the ACTS project
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "algebra/array_instrumented.hpp"
+#include "algebra/math/algorithms/matrix/determinant/cofactor.hpp"
+#include "algebra/math/algorithms/matrix/inverse/cofactor.hpp"
+
+// System include(s)
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <type_traits>
+
+using namespace algebra;
+
+namespace {
+
+using scalar_t = algebra::get_scalar_t<plugin::array_instrumented<double>>;
+
+template <std::size_t N>
+using matrix_t =
+    algebra::get_matrix_t<plugin::array_instrumented<double>, N, N>;
+
+using element_getter_t = algebra::array::element_getter;
+
+/// Print the table header
+void print_header() {
+  std::cout << std::left << std::setw(14) << "operation" << std::setw(20)
+            << "algorithm" << std::setw(6) << "rank" << std::right
+            << std::setw(8) << "add" << std::setw(8) << "mul" << std::setw(8)
+            << "div" << std::setw(8) << "sqrt" << std::setw(8) << "fma"
+            << std::setw(8) << "cmp" << std::setw(10) << "flops\n";
+}
+
+/// Print the operation counts of a single algorithm
+void print_row(const std::string& op, const std::string& algo,
+               const std::string& rank, const op_counts& c) {
+  std::cout << std::left << std::setw(14) << op << std::setw(20) << algo
+            << std::setw(6) << rank << std::right << std::setw(8) << c.add
+            << std::setw(8) << c.mul << std::setw(8) << c.div << std::setw(8)
+            << c.sqrt << std::setw(8) << c.fma << std::setw(8) << c.compare
+            << std::setw(9) << c.flops() << "\n";
+}
+
+/// @returns the operations that were counted during the call to @param f
+template <typename func_t>
+op_counts count(func_t&& f) {
+  reset_instrumented_counters();
+  f();
+  return instrumented_counters();
+}
+
+/// @returns a random, well conditioned N x N matrix
+template <std::size_t N>
+matrix_t<N> random_matrix(std::mt19937& mt) {
+  std::uniform_real_distribution<double> dist(0., 1.);
+
+  matrix_t<N> m;
+  for (std::size_t j = 0u; j < N; ++j) {
+    for (std::size_t i = 0u; i < N; ++i) {
+      element_getter_t{}(m, i, j) = dist(mt) + (i == j ? N : 0.);
+    }
+  }
+  return m;
+}
+
+/// Name of the algorithm that is chosen by the selectors
+template <typename selected_t, typename hard_coded_t, typename cofactor_t>
+std::string selected_name() {
+  if constexpr (std::is_same_v<selected_t, hard_coded_t>) {
+    return "hard_coded";
+  } else if constexpr (std::is_same_v<selected_t, cofactor_t>) {
+    return "cofactor";
+  } else {
+    return "partial_pivot_lud";
+  }
+}
+
+/// Count the operations of all determinant and inversion algorithms for a
+/// matrix of rank @tparam N
+template <std::size_t N>
+void count_matrix_algorithms(std::mt19937& mt) {
+
+  using mat_t = matrix_t<N>;
+  using namespace algebra::generic::matrix;
+
+  const mat_t m = random_matrix<N>(mt);
+  const std::string rank = std::to_string(N);
+
+  using det_hard_coded_t = determinant::hard_coded<mat_t, element_getter_t>;
+  using det_cofactor_t = determinant::cofactor<mat_t, element_getter_t>;
+  using det_lud_t = determinant::partial_pivot_lud<mat_t, element_getter_t>;
+
+  if constexpr (N >= 2 && N <= 6) {
+    print_row("determinant", "hard_coded", rank,
+              count([&m]() { det_hard_coded_t{}(m); }));
+  }
+  print_row("determinant", "cofactor", rank,
+            count([&m]() { det_cofactor_t{}(m); }));
+  print_row("determinant", "partial_pivot_lud", rank,
+            count([&m]() { det_lud_t{}(m); }));
+  print_row("determinant_t",
+            selected_name<generic::determinant_t<mat_t>, det_hard_coded_t,
+                          det_cofactor_t>(),
+            rank, count([&m]() { generic::determinant_t<mat_t>{}(m); }));
+
+  using inv_hard_coded_t = inverse::hard_coded<mat_t, element_getter_t>;
+  using inv_cofactor_t = inverse::cofactor<mat_t, element_getter_t>;
+  using inv_lud_t = inverse::partial_pivot_lud<mat_t, element_getter_t>;
+
+  if constexpr (N >= 2 && N <= 6) {
+    print_row("inverse", "hard_coded", rank,
+              count([&m]() { inv_hard_coded_t{}(m); }));
+  }
+  print_row("inverse", "cofactor", rank,
+            count([&m]() { inv_cofactor_t{}(m); }));
+  print_row("inverse", "partial_pivot_lud", rank,
+            count([&m]() { inv_lud_t{}(m); }));
+  print_row(
+      "inversion_t",
+      selected_name<generic::inversion_t<mat_t>, inv_hard_coded_t,
+                    inv_cofactor_t>(),
+      rank, count([&m]() { generic::inversion_t<mat_t>{}(m); }));
+}
+
+/// Count the operations of the transform3 methods
+void count_transform3(std::mt19937& mt) {
+
+  using transform3_t =
+      algebra::get_transform3D_t<plugin::array_instrumented<double>>;
+  using vector3_t =
+      algebra::get_vector3D_t<plugin::array_instrumented<double>>;
+  using point3_t = algebra::get_point3D_t<plugin::array_instrumented<double>>;
+
+  std::uniform_real_distribution<double> dist(0., 1.);
+
+  const vector3_t t{dist(mt), dist(mt), dist(mt)};
+  const vector3_t z{0., 0., 1.};
+  const vector3_t x{1., 0., 0.};
+  const point3_t p{dist(mt), dist(mt), dist(mt)};
+  const vector3_t v{dist(mt), dist(mt), dist(mt)};
+
+  transform3_t trf{};
+  print_row("transform3", "construct(t,z,x)", "4",
+            count([&]() { trf = transform3_t{t, z, x}; }));
+  print_row("transform3", "point_to_global", "4",
+            count([&]() { trf.point_to_global(p); }));
+  print_row("transform3", "point_to_local", "4",
+            count([&]() { trf.point_to_local(p); }));
+  print_row("transform3", "vector_to_global", "4",
+            count([&]() { trf.vector_to_global(v); }));
+  print_row("transform3", "vector_to_local", "4",
+            count([&]() { trf.vector_to_local(v); }));
+}
+
+}  // namespace
+
+/// Print the operation counts of the matrix algorithms and transforms
+int main() {
+
+  std::cout << "-----------------------------------------------\n"
+            << "Algebra-Plugins 'operation count' (std::array)\n"
+            << "-----------------------------------------------\n\n";
+
+  std::mt19937 mt(42u);
+
+  print_header();
+  count_matrix_algorithms<2>(mt);
+  count_matrix_algorithms<3>(mt);
+  count_matrix_algorithms<4>(mt);
+  count_matrix_algorithms<5>(mt);
+  count_matrix_algorithms<6>(mt);
+  count_matrix_algorithms<8>(mt);
+  count_transform3(mt);
+}
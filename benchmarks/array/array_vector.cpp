@@ -40,6 +40,17 @@ int main(int argc, char** argv) {
   using normlz_f_t =
       vector_unaryOP_bm<array::vector3, float, bench_op::normalize>;
 
+  using normlz_fast_f_t =
+      vector_unaryOP_bm<array::vector3, float, bench_op::normalize_fast>;
+  using phi_fast_f_t =
+      vector_unaryOP_bm<array::vector3, float, bench_op::phi_fast>;
+  using theta_fast_f_t =
+      vector_unaryOP_bm<array::vector3, float, bench_op::theta_fast>;
+  using norm_fast_f_t =
+      vector_unaryOP_bm<array::vector3, float, bench_op::norm_fast>;
+  using eta_fast_f_t =
+      vector_unaryOP_bm<array::vector3, float, bench_op::eta_fast>;
+
   using phi_d_t = vector_unaryOP_bm<array::vector3, double, bench_op::phi>;
   using theta_d_t = vector_unaryOP_bm<array::vector3, double, bench_op::theta>;
   using perp_d_t = vector_unaryOP_bm<array::vector3, double, bench_op::perp>;
@@ -53,6 +64,17 @@ int main(int argc, char** argv) {
   using normlz_d_t =
       vector_unaryOP_bm<array::vector3, double, bench_op::normalize>;
 
+  using normlz_fast_d_t =
+      vector_unaryOP_bm<array::vector3, double, bench_op::normalize_fast>;
+  using phi_fast_d_t =
+      vector_unaryOP_bm<array::vector3, double, bench_op::phi_fast>;
+  using theta_fast_d_t =
+      vector_unaryOP_bm<array::vector3, double, bench_op::theta_fast>;
+  using norm_fast_d_t =
+      vector_unaryOP_bm<array::vector3, double, bench_op::norm_fast>;
+  using eta_fast_d_t =
+      vector_unaryOP_bm<array::vector3, double, bench_op::eta_fast>;
+
   std::cout << "-----------------------------------------------\n"
             << "Algebra-Plugins 'vector' benchmark (std::array)\n"
             << "-----------------------------------------------\n\n"
@@ -62,6 +84,7 @@ int main(int argc, char** argv) {
   // Register all benchmarks
   //
   ALGEBRA_PLUGINS_REGISTER_VECTOR_BENCH(cfg)
+  ALGEBRA_PLUGINS_REGISTER_FAST_VECTOR_BENCH(cfg)
 
   ::benchmark::Initialize(&argc, argv);
   ::benchmark::RunSpecifiedBenchmarks();
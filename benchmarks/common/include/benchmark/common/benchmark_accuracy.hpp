@@ -0,0 +1,538 @@
+/** Algebra plugins library, part of the ACTS project
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "algebra/concepts.hpp"
+#include "algebra/math/algorithms/matrix/determinant/partial_pivot_lud.hpp"
+#include "algebra/math/algorithms/matrix/inverse/partial_pivot_lud.hpp"
+#include "algebra/storage/array.hpp"
+#include "algebra/type_traits.hpp"
+
+// System include(s)
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <numbers>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace algebra {
+
+/// Accuracy of an operation w.r.t. a long double reference
+///
+/// The error of every element is measured both in units in the last place
+/// (ULP) and as relative error. Vectors and matrices are compared normwise,
+/// i.e. the errors of all elements are scaled by their largest reference
+/// element, so that results close to zero do not dominate the statistics.
+template <concepts::value value_t>
+struct accuracy_stats {
+
+  /// Name of the operation
+  std::string_view m_name;
+  /// Name of the input data set
+  std::string_view m_inputs;
+
+  /// Number of compared elements
+  std::size_t m_n{0u};
+  /// Maximal and summed errors
+  /// @{
+  long double m_max_ulp{0.L};
+  long double m_sum_ulp{0.L};
+  long double m_max_rel{0.L};
+  long double m_sum_rel{0.L};
+  /// @}
+
+  /// Add the element @param result to the statistics, given the reference
+  /// value @param ref and the magnitude of the full result @param scale
+  void fill(long double result, long double ref, long double scale) {
+
+    constexpr value_t inf{std::numeric_limits<value_t>::infinity()};
+
+    const long double err{std::fabs(result - ref)};
+    const auto s{static_cast<value_t>(std::fabs(scale))};
+    // Size of one ULP at the magnitude of the reference result
+    const long double ulp =
+        (s > value_t(0))
+            ? static_cast<long double>(std::nextafter(s, inf) - s)
+            : static_cast<long double>(std::numeric_limits<value_t>::min());
+
+    const long double n_ulp{err / ulp};
+    const long double rel{(scale != 0.L) ? err / std::fabs(scale) : err};
+
+    ++m_n;
+    m_max_ulp = std::max(m_max_ulp, n_ulp);
+    m_sum_ulp += n_ulp;
+    m_max_rel = std::max(m_max_rel, rel);
+    m_sum_rel += rel;
+  }
+
+  /// Add a vector/matrix result, given as a flat array of elements
+  template <std::size_t N>
+  void fill(const std::array<long double, N>& result,
+            const std::array<long double, N>& ref) {
+    long double scale{0.L};
+    for (std::size_t i = 0u; i < N; ++i) {
+      scale = std::max(scale, std::fabs(ref[i]));
+    }
+    for (std::size_t i = 0u; i < N; ++i) {
+      fill(result[i], ref[i], scale);
+    }
+  }
+
+  /// Print the statistics as a row of the accuracy report
+  friend std::ostream& operator<<(std::ostream& os, const accuracy_stats& s) {
+    const auto n{static_cast<long double>(std::max<std::size_t>(s.m_n, 1u))};
+
+    os << std::left << std::setw(20) << s.m_name << std::setw(18)
+       << s.m_inputs << std::right << std::setprecision(3) << std::setw(12)
+       << static_cast<double>(s.m_max_ulp) << std::setw(12)
+       << static_cast<double>(s.m_sum_ulp / n) << std::scientific
+       << std::setw(12) << static_cast<double>(s.m_max_rel) << std::setw(12)
+       << static_cast<double>(s.m_sum_rel / n) << std::defaultfloat << "\n";
+
+    return os;
+  }
+};
+
+/// Run the accuracy checks for all vector, matrix and transform3 operations
+/// of the plugin @tparam A and print the report
+///
+/// The inputs are generated in long double precision and then rounded to the
+/// value type of the plugin. The reference results are computed in long
+/// double precision from the rounded inputs, so that only the error of the
+/// operation itself is measured.
+template <typename A>
+requires concepts::aos<A> struct accuracy_report {
+
+  using value_t = algebra::get_value_t<A>;
+  using scalar_t = algebra::get_scalar_t<A>;
+  using vector3_t = algebra::get_vector3D_t<A>;
+  using point3_t = algebra::get_point3D_t<A>;
+  using transform3_t = algebra::get_transform3D_t<A>;
+  template <std::size_t N>
+  using matrix_t = algebra::get_matrix_t<A, N, N>;
+
+  /// Reference types
+  /// @{
+  using ref_vector_t = std::array<long double, 3>;
+  template <std::size_t N>
+  using ref_matrix_t = algebra::array::matrix_type<long double, N, N>;
+  using ref_element_getter_t = algebra::array::element_getter;
+  /// @}
+
+  /// Number of random samples per operation and data set
+  std::size_t m_n_samples{10000u};
+
+  /// Random number generation (fixed seed for reproducible reports)
+  std::mt19937_64 m_mt{42u};
+
+  /// @returns a uniformly distributed random number in [min, max)
+  long double uniform(long double min, long double max) {
+    return std::uniform_real_distribution<long double>(min, max)(m_mt);
+  }
+
+  /// Round the long double value @param x to the precision of the plugin
+  static long double rounded(long double x) {
+    return static_cast<long double>(static_cast<value_t>(x));
+  }
+
+  /// Convert between the plugin and the reference types
+  /// @{
+  static vector3_t to_vector(const ref_vector_t& v) {
+    return vector3_t{static_cast<scalar_t>(v[0]), static_cast<scalar_t>(v[1]),
+                     static_cast<scalar_t>(v[2])};
+  }
+
+  static ref_vector_t from_vector(const vector3_t& v) {
+    return {static_cast<long double>(v[0]), static_cast<long double>(v[1]),
+            static_cast<long double>(v[2])};
+  }
+
+  template <std::size_t N>
+  static matrix_t<N> to_matrix(const ref_matrix_t<N>& m) {
+    matrix_t<N> ret;
+    for (std::size_t i = 0u; i < N; ++i) {
+      for (std::size_t j = 0u; j < N; ++j) {
+        algebra::getter::element(ret, i, j) =
+            static_cast<scalar_t>(ref_element_getter_t{}(m, i, j));
+      }
+    }
+    return ret;
+  }
+
+  template <std::size_t N>
+  static std::array<long double, N * N> flatten(const matrix_t<N>& m) {
+    std::array<long double, N * N> ret;
+    for (std::size_t i = 0u; i < N; ++i) {
+      for (std::size_t j = 0u; j < N; ++j) {
+        ret[i * N + j] =
+            static_cast<long double>(algebra::getter::element(m, i, j));
+      }
+    }
+    return ret;
+  }
+
+  template <std::size_t N>
+  static std::array<long double, N * N> flatten(const ref_matrix_t<N>& m) {
+    std::array<long double, N * N> ret;
+    for (std::size_t i = 0u; i < N; ++i) {
+      for (std::size_t j = 0u; j < N; ++j) {
+        ret[i * N + j] = ref_element_getter_t{}(m, i, j);
+      }
+    }
+    return ret;
+  }
+  /// @}
+
+  /// Reference implementations
+  /// @{
+  static long double dot(const ref_vector_t& a, const ref_vector_t& b) {
+    return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+  }
+
+  static ref_vector_t cross(const ref_vector_t& a, const ref_vector_t& b) {
+    return {a[1] * b[2] - a[2] * b[1], a[2] * b[0] - a[0] * b[2],
+            a[0] * b[1] - a[1] * b[0]};
+  }
+
+  static long double perp(const ref_vector_t& v) {
+    return std::sqrt(v[0] * v[0] + v[1] * v[1]);
+  }
+
+  static long double norm(const ref_vector_t& v) {
+    return std::sqrt(dot(v, v));
+  }
+
+  static ref_vector_t normalize(const ref_vector_t& v) {
+    const long double n{norm(v)};
+    return {v[0] / n, v[1] / n, v[2] / n};
+  }
+
+  template <std::size_t N>
+  static ref_matrix_t<N> product(const ref_matrix_t<N>& a,
+                                 const ref_matrix_t<N>& b) {
+    ref_matrix_t<N> ret;
+    for (std::size_t i = 0u; i < N; ++i) {
+      for (std::size_t j = 0u; j < N; ++j) {
+        long double sum{0.L};
+        for (std::size_t k = 0u; k < N; ++k) {
+          sum += ref_element_getter_t{}(a, i, k) *
+                 ref_element_getter_t{}(b, k, j);
+        }
+        ref_element_getter_t{}(ret, i, j) = sum;
+      }
+    }
+    return ret;
+  }
+  /// @}
+
+  /// Random input data
+  /// @{
+
+  /// @returns a random vector with components in [-1, 1)
+  ref_vector_t random_vector() {
+    return {rounded(uniform(-1.L, 1.L)), rounded(uniform(-1.L, 1.L)),
+            rounded(uniform(-1.L, 1.L))};
+  }
+
+  /// @returns a random vector close to the z-axis (large eta), of which the
+  /// components span several orders of magnitude
+  ref_vector_t forward_vector() {
+    return {rounded(1e-3L * uniform(-1.L, 1.L)),
+            rounded(1e-3L * uniform(-1.L, 1.L)), rounded(uniform(0.5L, 1.L))};
+  }
+
+  /// @returns a vector that is almost parallel to @param v
+  ref_vector_t parallel_vector(const ref_vector_t& v) {
+    return {rounded(v[0] + 1e-4L * uniform(-1.L, 1.L)),
+            rounded(v[1] + 1e-4L * uniform(-1.L, 1.L)),
+            rounded(v[2] + 1e-4L * uniform(-1.L, 1.L))};
+  }
+
+  /// @returns a random N x N matrix with elements in [-1, 1)
+  template <std::size_t N>
+  ref_matrix_t<N> random_matrix() {
+    ref_matrix_t<N> m;
+    for (std::size_t i = 0u; i < N; ++i) {
+      for (std::size_t j = 0u; j < N; ++j) {
+        ref_element_getter_t{}(m, i, j) = rounded(uniform(-1.L, 1.L));
+      }
+    }
+    return m;
+  }
+
+  /// @returns a random, symmetric positive definite N x N matrix that is
+  /// close to singular, like a covariance with very different uncertainties
+  /// @note the condition number is 1/sqrt(epsilon) of the value type
+  template <std::size_t N>
+  ref_matrix_t<N> near_singular_matrix() {
+
+    // Random orthogonal basis (Gram-Schmidt)
+    ref_matrix_t<N> q;
+    for (std::size_t j = 0u; j < N; ++j) {
+      for (std::size_t i = 0u; i < N; ++i) {
+        ref_element_getter_t{}(q, i, j) = uniform(-1.L, 1.L);
+      }
+      for (std::size_t k = 0u; k < j; ++k) {
+        long double proj{0.L};
+        for (std::size_t i = 0u; i < N; ++i) {
+          proj +=
+              ref_element_getter_t{}(q, i, j) * ref_element_getter_t{}(q, i, k);
+        }
+        for (std::size_t i = 0u; i < N; ++i) {
+          ref_element_getter_t{}(q, i, j) -=
+              proj * ref_element_getter_t{}(q, i, k);
+        }
+      }
+      long double n{0.L};
+      for (std::size_t i = 0u; i < N; ++i) {
+        n += ref_element_getter_t{}(q, i, j) * ref_element_getter_t{}(q, i, j);
+      }
+      n = std::sqrt(n);
+      for (std::size_t i = 0u; i < N; ++i) {
+        ref_element_getter_t{}(q, i, j) /= n;
+      }
+    }
+
+    // Eigenvalues that are logarithmically spaced between 1 and 1/cond
+    const long double cond{
+        1.L / std::sqrt(static_cast<long double>(
+                  std::numeric_limits<value_t>::epsilon()))};
+
+    ref_matrix_t<N> m;
+    for (std::size_t i = 0u; i < N; ++i) {
+      for (std::size_t j = 0u; j < N; ++j) {
+        long double sum{0.L};
+        for (std::size_t k = 0u; k < N; ++k) {
+          const long double lambda{
+              std::pow(cond, -static_cast<long double>(k) / (N - 1))};
+          sum += ref_element_getter_t{}(q, i, k) * lambda *
+                 ref_element_getter_t{}(q, j, k);
+        }
+        ref_element_getter_t{}(m, i, j) = rounded(sum);
+      }
+    }
+    // Make sure the rounded matrix is exactly symmetric
+    for (std::size_t i = 0u; i < N; ++i) {
+      for (std::size_t j = 0u; j < i; ++j) {
+        ref_element_getter_t{}(m, i, j) = ref_element_getter_t{}(m, j, i);
+      }
+    }
+
+    return m;
+  }
+  /// @}
+
+  /// Accuracy of the vector operations
+  void vector_accuracy(std::ostream& os, std::string_view inputs,
+                       bool forward) {
+
+    accuracy_stats<value_t> dot_stats{"dot", inputs};
+    accuracy_stats<value_t> cross_stats{"cross", inputs};
+    accuracy_stats<value_t> norm_stats{"norm", inputs};
+    accuracy_stats<value_t> normlz_stats{"normalize", inputs};
+    accuracy_stats<value_t> phi_stats{"phi", inputs};
+    accuracy_stats<value_t> theta_stats{"theta", inputs};
+    accuracy_stats<value_t> perp_stats{"perp", inputs};
+    accuracy_stats<value_t> eta_stats{"eta", inputs};
+
+    for (std::size_t n = 0u; n < m_n_samples; ++n) {
+
+      const ref_vector_t a{forward ? forward_vector() : random_vector()};
+      const ref_vector_t b{forward ? parallel_vector(a) : random_vector()};
+
+      const vector3_t va{to_vector(a)};
+      const vector3_t vb{to_vector(b)};
+
+      const long double d{dot(a, b)};
+      dot_stats.fill(
+          static_cast<long double>(algebra::vector::dot(va, vb)), d,
+          norm(a) * norm(b));
+
+      const vector3_t c = algebra::vector::cross(va, vb);
+      cross_stats.fill(from_vector(c), cross(a, b));
+
+      norm_stats.fill(static_cast<long double>(algebra::vector::norm(va)),
+                      norm(a), norm(a));
+
+      const vector3_t u = algebra::vector::normalize(va);
+      normlz_stats.fill(from_vector(u), normalize(a));
+
+      const long double phi{std::atan2(a[1], a[0])};
+      phi_stats.fill(static_cast<long double>(algebra::vector::phi(va)), phi,
+                     phi);
+
+      const long double theta{std::atan2(perp(a), a[2])};
+      theta_stats.fill(static_cast<long double>(algebra::vector::theta(va)),
+                       theta, theta);
+
+      perp_stats.fill(static_cast<long double>(algebra::vector::perp(va)),
+                      perp(a), perp(a));
+
+      const long double eta{std::atanh(a[2] / norm(a))};
+      eta_stats.fill(static_cast<long double>(algebra::vector::eta(va)), eta,
+                     eta);
+    }
+
+    os << dot_stats << cross_stats << norm_stats << normlz_stats << phi_stats
+       << theta_stats << perp_stats << eta_stats;
+  }
+
+  /// Accuracy of the matrix operations on N x N matrices
+  template <std::size_t N>
+  void matrix_accuracy(std::ostream& os, std::string_view inputs,
+                       bool near_singular) {
+
+    using ref_determinant_t =
+        algebra::generic::matrix::determinant::partial_pivot_lud<
+            ref_matrix_t<N>, ref_element_getter_t>;
+    using ref_inverse_t = algebra::generic::matrix::inverse::partial_pivot_lud<
+        ref_matrix_t<N>, ref_element_getter_t>;
+
+    const std::string dim{std::to_string(N) + "x" + std::to_string(N)};
+    const std::string det_name{"determinant_" + dim};
+    const std::string inv_name{"inverse_" + dim};
+    const std::string mul_name{"mul_" + dim};
+
+    accuracy_stats<value_t> det_stats{det_name, inputs};
+    accuracy_stats<value_t> inv_stats{inv_name, inputs};
+    accuracy_stats<value_t> mul_stats{mul_name, inputs};
+
+    for (std::size_t n = 0u; n < m_n_samples; ++n) {
+
+      const ref_matrix_t<N> a{near_singular ? near_singular_matrix<N>()
+                                            : random_matrix<N>()};
+      const ref_matrix_t<N> b{random_matrix<N>()};
+
+      const matrix_t<N> ma{to_matrix<N>(a)};
+      const matrix_t<N> mb{to_matrix<N>(b)};
+
+      const long double det{ref_determinant_t{}(a)};
+      det_stats.fill(
+          static_cast<long double>(algebra::matrix::determinant(ma)), det,
+          det);
+
+      const matrix_t<N> inv = algebra::matrix::inverse(ma);
+      inv_stats.fill(flatten<N>(inv), flatten<N>(ref_inverse_t{}(a)));
+
+      const matrix_t<N> prod = ma * mb;
+      mul_stats.fill(flatten<N>(prod), flatten<N>(product<N>(a, b)));
+    }
+
+    os << det_stats << inv_stats << mul_stats;
+  }
+
+  /// Accuracy of the transform3 operations
+  void transform3_accuracy(std::ostream& os, std::string_view inputs,
+                           long double translation) {
+
+    using ref_inverse_t = algebra::generic::matrix::inverse::partial_pivot_lud<
+        ref_matrix_t<4>, ref_element_getter_t>;
+
+    accuracy_stats<value_t> p_glob_stats{"point_to_global", inputs};
+    accuracy_stats<value_t> p_loc_stats{"point_to_local", inputs};
+    accuracy_stats<value_t> v_glob_stats{"vector_to_global", inputs};
+    accuracy_stats<value_t> v_loc_stats{"vector_to_local", inputs};
+
+    for (std::size_t n = 0u; n < m_n_samples; ++n) {
+
+      // Random, right handed frame
+      const long double phi{uniform(-std::numbers::pi_v<long double>,
+                                    std::numbers::pi_v<long double>)};
+      const long double cos_theta{uniform(-1.L, 1.L)};
+      const long double sin_theta{std::sqrt(1.L - cos_theta * cos_theta)};
+
+      const ref_vector_t z{rounded(sin_theta * std::cos(phi)),
+                           rounded(sin_theta * std::sin(phi)),
+                           rounded(cos_theta)};
+      ref_vector_t x{normalize(cross(z, random_vector()))};
+      x = {rounded(x[0]), rounded(x[1]), rounded(x[2])};
+      const ref_vector_t y{cross(z, x)};
+      const ref_vector_t t{rounded(translation * uniform(-1.L, 1.L)),
+                           rounded(translation * uniform(-1.L, 1.L)),
+                           rounded(translation * uniform(-1.L, 1.L))};
+
+      const transform3_t trf{to_vector(t), to_vector(z), to_vector(x)};
+
+      // Reference transformation matrix and its inverse
+      ref_matrix_t<4> m;
+      for (std::size_t i = 0u; i < 3u; ++i) {
+        ref_element_getter_t{}(m, i, 0) = x[i];
+        ref_element_getter_t{}(m, i, 1) = y[i];
+        ref_element_getter_t{}(m, i, 2) = z[i];
+        ref_element_getter_t{}(m, i, 3) = t[i];
+        ref_element_getter_t{}(m, 3, i) = 0.L;
+      }
+      ref_element_getter_t{}(m, 3, 3) = 1.L;
+      const ref_matrix_t<4> m_inv{ref_inverse_t{}(m)};
+
+      // Points close to the origin of the frame
+      const ref_vector_t p{rounded(t[0] + uniform(-1.L, 1.L)),
+                           rounded(t[1] + uniform(-1.L, 1.L)),
+                           rounded(t[2] + uniform(-1.L, 1.L))};
+      const ref_vector_t v{random_vector()};
+
+      auto apply = [](const ref_matrix_t<4>& mat, const ref_vector_t& r,
+                      long double w) {
+        ref_vector_t ret;
+        for (std::size_t i = 0u; i < 3u; ++i) {
+          ret[i] = ref_element_getter_t{}(mat, i, 0) * r[0] +
+                   ref_element_getter_t{}(mat, i, 1) * r[1] +
+                   ref_element_getter_t{}(mat, i, 2) * r[2] +
+                   ref_element_getter_t{}(mat, i, 3) * w;
+        }
+        return ret;
+      };
+
+      const point3_t p_glob = trf.point_to_global(to_vector(p));
+      p_glob_stats.fill(from_vector(p_glob), apply(m, p, 1.L));
+
+      const point3_t p_loc = trf.point_to_local(to_vector(p));
+      p_loc_stats.fill(from_vector(p_loc), apply(m_inv, p, 1.L));
+
+      const vector3_t v_glob = trf.vector_to_global(to_vector(v));
+      v_glob_stats.fill(from_vector(v_glob), apply(m, v, 0.L));
+
+      const vector3_t v_loc = trf.vector_to_local(to_vector(v));
+      v_loc_stats.fill(from_vector(v_loc), apply(m_inv, v, 0.L));
+    }
+
+    os << p_glob_stats << p_loc_stats << v_glob_stats << v_loc_stats;
+  }
+
+  /// Run all accuracy checks and print the report to @param os
+  void operator()(std::ostream& os, std::string_view name) {
+
+    os << "\n" << name << " (" << m_n_samples << " samples)\n";
+    os << std::left << std::setw(20) << "operation" << std::setw(18)
+       << "inputs" << std::right << std::setw(12) << "max ulp" << std::setw(12)
+       << "mean ulp" << std::setw(12) << "max rel" << std::setw(12)
+       << "mean rel"
+       << "\n";
+
+    vector_accuracy(os, "random", false);
+    vector_accuracy(os, "forward/parallel", true);
+
+    matrix_accuracy<4>(os, "random", false);
+    matrix_accuracy<4>(os, "near-singular", true);
+    matrix_accuracy<6>(os, "random", false);
+    matrix_accuracy<6>(os, "near-singular", true);
+
+    transform3_accuracy(os, "random", 1.L);
+    transform3_accuracy(os, "large translation", 1e4L);
+  }
+};
+
+}  // namespace algebra
@@ -0,0 +1,139 @@
+/** Algebra plugins library, part of the ACTS project
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "algebra/math/kernels/fits.hpp"
+#include "benchmark_base.hpp"
+#include "register_benchmark.hpp"
+
+// Benchmark include
+#include <benchmark/benchmark.h>
+
+// System include(s)
+#include <array>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+namespace algebra {
+
+template <concepts::vector vector_t>
+void fill_random_vec(std::vector<vector_t> &);
+
+/// Benchmark for the line and circle fits to sets of @tparam N hits
+///
+/// For SoA plugins, a sample holds the hits of several fit candidates.
+template <concepts::algebra A, std::size_t N, typename fit_op>
+struct fit_bm : public benchmark_base {
+
+  using point3_t = algebra::get_point3D_t<A>;
+  using hit_t = typename fit_op::template hit_t<A>;
+
+  /// Prefix for the benchmark name
+  static constexpr std::string_view bm_name{"fit"};
+
+  std::vector<std::array<hit_t, N>> hits;
+
+  /// No default construction: Cannot prepare data
+  fit_bm() = delete;
+  /// Construct from an externally provided configuration @param cfg
+  explicit fit_bm(benchmark_base::configuration cfg) : benchmark_base{cfg} {
+
+    const std::size_t n_samples{this->m_cfg.n_samples()};
+
+    std::vector<point3_t> points;
+    points.reserve(n_samples * N);
+    fill_random_vec(points);
+
+    // Use the first coordinates of the random points for the hits
+    hits.resize(n_samples);
+    for (std::size_t i{0}; i < n_samples; ++i) {
+      for (std::size_t j{0}; j < N; ++j) {
+        for (std::size_t k{0}; k < algebra::traits::size<hit_t>; ++k) {
+          hits[i][j][k] = points[i * N + j][k];
+        }
+      }
+    }
+  }
+  fit_bm(const fit_bm &bm) = default;
+  fit_bm &operator=(fit_bm &other) = default;
+
+  /// Clear state
+  ~fit_bm() override { hits.clear(); }
+
+  constexpr std::string name() const override {
+    return std::string{bm_name} + "_" + std::string{fit_op::name} + "_" +
+           std::to_string(N);
+  }
+
+  /// Benchmark case
+  inline void operator()(::benchmark::State &state) const override {
+
+    const std::size_t n_samples{this->m_cfg.n_samples()};
+
+    // Run the benchmark
+    for (auto _ : state) {
+      for (std::size_t i{0}; i < n_samples; ++i) {
+        auto result = fit_op{}.template operator()<A>(hits[i]);
+        ::benchmark::DoNotOptimize(result);
+      }
+    }
+  }
+};
+
+// Fits to be benchmarked
+namespace bench_op {
+
+struct line_fit {
+  static constexpr std::string_view name{"line"};
+
+  template <concepts::algebra A>
+  using hit_t = algebra::get_point3D_t<A>;
+
+  template <concepts::algebra A, std::size_t N>
+  constexpr auto operator()(const std::array<hit_t<A>, N> &hits) const {
+    algebra::get_matrix_t<A, kernels::e_line_size, kernels::e_line_size> cov;
+    algebra::get_scalar_t<A> chi2;
+    auto params = kernels::line_fit(hits, cov, chi2);
+
+    return std::tuple{params, cov, chi2};
+  }
+};
+struct circle_fit {
+  static constexpr std::string_view name{"circle"};
+
+  template <concepts::algebra A>
+  using hit_t = algebra::get_point2D_t<A>;
+
+  template <concepts::algebra A, std::size_t N>
+  constexpr auto operator()(const std::array<hit_t<A>, N> &hits) const {
+    algebra::get_matrix_t<A, kernels::e_circle_size, kernels::e_circle_size>
+        cov;
+    algebra::get_scalar_t<A> chi2;
+    auto params = kernels::circle_fit(hits, cov, chi2);
+
+    return std::tuple{params, cov, chi2};
+  }
+};
+
+}  // namespace bench_op
+
+// Macro for registering the fit benchmarks
+#define ALGEBRA_PLUGINS_REGISTER_FIT_BENCH(CFG_S, CFG_D)            \
+  algebra::register_benchmark<fit_3_line_f_t>(CFG_S, "_single");    \
+  algebra::register_benchmark<fit_3_line_d_t>(CFG_D, "_double");    \
+  algebra::register_benchmark<fit_10_line_f_t>(CFG_S, "_single");   \
+  algebra::register_benchmark<fit_10_line_d_t>(CFG_D, "_double");   \
+  algebra::register_benchmark<fit_3_circle_f_t>(CFG_S, "_single");  \
+  algebra::register_benchmark<fit_3_circle_d_t>(CFG_D, "_double");  \
+  algebra::register_benchmark<fit_10_circle_f_t>(CFG_S, "_single"); \
+  algebra::register_benchmark<fit_10_circle_d_t>(CFG_D, "_double");
+
+}  // namespace algebra
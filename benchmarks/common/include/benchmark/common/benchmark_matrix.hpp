@@ -161,6 +161,185 @@ struct matrix_vector_bm : public matrix_bm<matrix_t> {
   }
 };
 
+/// Benchmark rank-1 modifications of the Cholesky factors of symmetric
+/// positive definite matrices
+template <concepts::matrix matrix_t, typename cholesky_op>
+struct matrix_cholesky_bm : public matrix_bm<matrix_t> {
+  using base_type = matrix_bm<matrix_t>;
+  using vector_t = algebra::traits::vector_t<matrix_t>;
+  using scalar_t = algebra::traits::scalar_t<matrix_t>;
+
+  /// Symmetric positive definite matrices, which stay positive definite when
+  /// the rank-1 modifications are subtracted
+  std::vector<matrix_t> c;
+  /// Cholesky factors of @c c
+  std::vector<matrix_t> l;
+  /// Rank-1 modifications
+  std::vector<vector_t> v;
+
+  matrix_cholesky_bm() = delete;
+  explicit matrix_cholesky_bm(benchmark_base::configuration cfg)
+      : base_type{cfg} {
+
+    constexpr std::size_t N{algebra::traits::rank<matrix_t>};
+
+    using element_getter_t = algebra::traits::element_getter_t<matrix_t>;
+    using cholesky_t =
+        algebra::generic::matrix::decomposition::cholesky<matrix_t,
+                                                          element_getter_t>;
+
+    const std::size_t n_samples{this->m_cfg.n_samples()};
+
+    c.reserve(n_samples);
+    l.reserve(n_samples);
+    v.reserve(n_samples);
+
+    for (std::size_t s{0}; s < n_samples; ++s) {
+      // C = A * A^T + N * I + v * v^T
+      matrix_t m = this->a[s] * algebra::matrix::transpose(this->a[s]);
+      vector_t u;
+      for (std::size_t i = 0u; i < N; ++i) {
+        u[i] = algebra::getter::element(this->b[s], i, 0u);
+      }
+      for (std::size_t j = 0u; j < N; ++j) {
+        for (std::size_t i = 0u; i < N; ++i) {
+          algebra::getter::element(m, i, j) += u[i] * u[j];
+        }
+        algebra::getter::element(m, j, j) += static_cast<scalar_t>(N);
+      }
+
+      c.push_back(m);
+      l.push_back(cholesky_t{}(m));
+      v.push_back(u);
+    }
+  }
+  matrix_cholesky_bm(const matrix_cholesky_bm& bm) = default;
+  matrix_cholesky_bm& operator=(matrix_cholesky_bm& other) = default;
+
+  /// Clear state
+  ~matrix_cholesky_bm() override {
+    c.clear();
+    l.clear();
+    v.clear();
+  }
+
+  constexpr std::string name() const override {
+    return std::string{base_type::name} + "_" + std::string{cholesky_op::name};
+  }
+
+  inline void operator()(::benchmark::State& state) const override {
+
+    const std::size_t n_samples{this->m_cfg.n_samples()};
+
+    // Run the benchmark
+    for (auto _ : state) {
+      for (std::size_t i{0}; i < n_samples; ++i) {
+        matrix_t result = cholesky_op{}(c[i], l[i], v[i]);
+        ::benchmark::DoNotOptimize(result);
+      }
+    }
+  }
+};
+
+/// Benchmark the least squares solution of overdetermined systems A * x = b
+template <concepts::matrix matrix_t, typename least_squares_op>
+struct matrix_least_squares_bm : public matrix_bm<matrix_t> {
+  using base_type = matrix_bm<matrix_t>;
+  using vector_t = algebra::traits::vector_t<matrix_t>;
+
+  /// Right hand sides
+  std::vector<vector_t> v;
+
+  matrix_least_squares_bm() = delete;
+  explicit matrix_least_squares_bm(benchmark_base::configuration cfg)
+      : base_type{cfg} {
+
+    constexpr std::size_t M{algebra::traits::rows<matrix_t>};
+
+    const std::size_t n_samples{this->m_cfg.n_samples()};
+
+    v.reserve(n_samples);
+    for (std::size_t s{0}; s < n_samples; ++s) {
+      vector_t u;
+      for (std::size_t i = 0u; i < M; ++i) {
+        u[i] = algebra::getter::element(this->b[s], i, 0u);
+      }
+      v.push_back(u);
+    }
+  }
+  matrix_least_squares_bm(const matrix_least_squares_bm& bm) = default;
+  matrix_least_squares_bm& operator=(matrix_least_squares_bm& other) = default;
+
+  /// Clear state
+  ~matrix_least_squares_bm() override { v.clear(); }
+
+  constexpr std::string name() const override {
+    return std::string{base_type::name} + "_" +
+           std::string{least_squares_op::name};
+  }
+
+  inline void operator()(::benchmark::State& state) const override {
+
+    using result_t = std::invoke_result_t<least_squares_op, matrix_t, vector_t>;
+
+    const std::size_t n_samples{this->m_cfg.n_samples()};
+
+    // Run the benchmark
+    for (auto _ : state) {
+      for (std::size_t i{0}; i < n_samples; ++i) {
+        result_t result = least_squares_op{}(this->a[i], v[i]);
+        ::benchmark::DoNotOptimize(result);
+      }
+    }
+  }
+};
+
+/// Benchmark the eigen decomposition of symmetric matrices
+template <concepts::matrix matrix_t, typename eigen_op>
+struct matrix_symmetric_eigen_bm : public matrix_bm<matrix_t> {
+  using base_type = matrix_bm<matrix_t>;
+
+  /// Symmetric matrices A + A^T
+  std::vector<matrix_t> s;
+
+  matrix_symmetric_eigen_bm() = delete;
+  explicit matrix_symmetric_eigen_bm(benchmark_base::configuration cfg)
+      : base_type{cfg} {
+
+    const std::size_t n_samples{this->m_cfg.n_samples()};
+
+    s.reserve(n_samples);
+    for (std::size_t i{0}; i < n_samples; ++i) {
+      s.push_back(this->a[i] + algebra::matrix::transpose(this->a[i]));
+    }
+  }
+  matrix_symmetric_eigen_bm(const matrix_symmetric_eigen_bm& bm) = default;
+  matrix_symmetric_eigen_bm& operator=(matrix_symmetric_eigen_bm& other) =
+      default;
+
+  /// Clear state
+  ~matrix_symmetric_eigen_bm() override { s.clear(); }
+
+  constexpr std::string name() const override {
+    return std::string{base_type::name} + "_" + std::string{eigen_op::name};
+  }
+
+  inline void operator()(::benchmark::State& state) const override {
+
+    using result_t = std::invoke_result_t<eigen_op, matrix_t>;
+
+    const std::size_t n_samples{this->m_cfg.n_samples()};
+
+    // Run the benchmark
+    for (auto _ : state) {
+      for (std::size_t i{0}; i < n_samples; ++i) {
+        result_t result = eigen_op{}(s[i]);
+        ::benchmark::DoNotOptimize(result);
+      }
+    }
+  }
+};
+
 // Functions to be benchmarked
 namespace bench_op {
 
@@ -206,6 +385,97 @@ struct invert {
     return algebra::matrix::inverse(a);
   }
 };
+struct determinant_lud {
+  static constexpr std::string_view name{"determinant_lud"};
+  template <concepts::matrix matrix_t>
+  constexpr auto operator()(const matrix_t& a) const {
+    return algebra::matrix::determinant(
+        a, algebra::generic::matrix::policy::partial_pivot_lud{});
+  }
+};
+struct invert_lud {
+  static constexpr std::string_view name{"invert_lud"};
+  template <concepts::matrix matrix_t>
+  constexpr auto operator()(const matrix_t& a) const {
+    return algebra::matrix::inverse(
+        a, algebra::generic::matrix::policy::partial_pivot_lud{});
+  }
+};
+struct pseudo_inverse {
+  static constexpr std::string_view name{"pseudo_inverse"};
+  template <concepts::matrix matrix_t>
+  constexpr auto operator()(const matrix_t& a) const {
+    return algebra::matrix::pseudo_inverse(a);
+  }
+};
+
+struct cholesky_update {
+  static constexpr std::string_view name{"cholesky_update"};
+  template <concepts::matrix matrix_t, concepts::vector vector_t>
+  constexpr matrix_t operator()(const matrix_t&, const matrix_t& l,
+                                const vector_t& v) const {
+    matrix_t res = l;
+    algebra::generic::matrix::decomposition::cholesky_update<
+        matrix_t, algebra::traits::element_getter_t<matrix_t>>{}(res, v);
+    return res;
+  }
+};
+struct cholesky_downdate {
+  static constexpr std::string_view name{"cholesky_downdate"};
+  template <concepts::matrix matrix_t, concepts::vector vector_t>
+  constexpr matrix_t operator()(const matrix_t&, const matrix_t& l,
+                                const vector_t& v) const {
+    matrix_t res = l;
+    algebra::generic::matrix::decomposition::cholesky_downdate<
+        matrix_t, algebra::traits::element_getter_t<matrix_t>>{}(res, v);
+    return res;
+  }
+};
+/// Full refactorization of C + v * v^T, for comparison with the update
+struct cholesky_refactor {
+  static constexpr std::string_view name{"cholesky_refactor"};
+  template <concepts::matrix matrix_t, concepts::vector vector_t>
+  constexpr matrix_t operator()(const matrix_t& c, const matrix_t&,
+                                const vector_t& v) const {
+    constexpr std::size_t N{algebra::traits::rank<matrix_t>};
+
+    matrix_t m = c;
+    for (std::size_t j = 0u; j < N; ++j) {
+      for (std::size_t i = 0u; i < N; ++i) {
+        algebra::getter::element(m, i, j) += v[i] * v[j];
+      }
+    }
+    return algebra::generic::matrix::decomposition::cholesky<
+        matrix_t, algebra::traits::element_getter_t<matrix_t>>{}(m);
+  }
+};
+
+struct least_squares_qr {
+  static constexpr std::string_view name{"least_squares_qr"};
+  template <concepts::matrix matrix_t, concepts::vector vector_t>
+  constexpr auto operator()(const matrix_t& a, const vector_t& b) const {
+    return algebra::matrix::least_squares(a, b);
+  }
+};
+/// Solution of the normal equations A^T * A * x = A^T * b, for comparison
+struct least_squares_lud {
+  static constexpr std::string_view name{"least_squares_lud"};
+  template <concepts::matrix matrix_t, concepts::vector vector_t>
+  constexpr auto operator()(const matrix_t& a, const vector_t& b) const {
+    const auto a_t = algebra::matrix::transpose(a);
+    return algebra::matrix::inverse(
+               a_t * a, algebra::generic::matrix::policy::partial_pivot_lud{}) *
+           (a_t * b);
+  }
+};
+
+struct symmetric_eigen {
+  static constexpr std::string_view name{"symmetric_eigen"};
+  template <concepts::matrix matrix_t>
+  constexpr auto operator()(const matrix_t& a) const {
+    return algebra::matrix::symmetric_eigen(a);
+  }
+};
 
 }  // namespace bench_op
 
@@ -253,4 +523,94 @@ struct invert {
   algebra::register_benchmark<mat88_vec_f_t>(CFG, "_8x8_single");    \
   algebra::register_benchmark<mat88_vec_d_t>(CFG, "_8x8_double");
 
+// Macro for registering additional benchmarks of the determinant and inversion
+// algorithms for small matrices: The algorithms chosen by the selectors
+// against the LU decomposition with partial pivoting
+#define ALGEBRA_PLUGINS_REGISTER_MATRIX_ALGORITHM_BENCH(CFG)          \
+  algebra::register_benchmark<mat33_inv_f_t>(CFG, "_3x3_single");     \
+  algebra::register_benchmark<mat33_inv_d_t>(CFG, "_3x3_double");     \
+  algebra::register_benchmark<mat55_inv_f_t>(CFG, "_5x5_single");     \
+  algebra::register_benchmark<mat55_inv_d_t>(CFG, "_5x5_double");     \
+                                                                      \
+  algebra::register_benchmark<mat33_inv_lud_f_t>(CFG, "_3x3_single"); \
+  algebra::register_benchmark<mat33_inv_lud_d_t>(CFG, "_3x3_double"); \
+  algebra::register_benchmark<mat44_inv_lud_f_t>(CFG, "_4x4_single"); \
+  algebra::register_benchmark<mat44_inv_lud_d_t>(CFG, "_4x4_double"); \
+  algebra::register_benchmark<mat55_inv_lud_f_t>(CFG, "_5x5_single"); \
+  algebra::register_benchmark<mat55_inv_lud_d_t>(CFG, "_5x5_double"); \
+  algebra::register_benchmark<mat66_inv_lud_f_t>(CFG, "_6x6_single"); \
+  algebra::register_benchmark<mat66_inv_lud_d_t>(CFG, "_6x6_double"); \
+                                                                      \
+  algebra::register_benchmark<mat33_det_f_t>(CFG, "_3x3_single");     \
+  algebra::register_benchmark<mat33_det_d_t>(CFG, "_3x3_double");     \
+  algebra::register_benchmark<mat55_det_f_t>(CFG, "_5x5_single");     \
+  algebra::register_benchmark<mat55_det_d_t>(CFG, "_5x5_double");     \
+                                                                      \
+  algebra::register_benchmark<mat33_det_lud_f_t>(CFG, "_3x3_single"); \
+  algebra::register_benchmark<mat33_det_lud_d_t>(CFG, "_3x3_double"); \
+  algebra::register_benchmark<mat44_det_lud_f_t>(CFG, "_4x4_single"); \
+  algebra::register_benchmark<mat44_det_lud_d_t>(CFG, "_4x4_double"); \
+  algebra::register_benchmark<mat55_det_lud_f_t>(CFG, "_5x5_single"); \
+  algebra::register_benchmark<mat55_det_lud_d_t>(CFG, "_5x5_double"); \
+  algebra::register_benchmark<mat66_det_lud_f_t>(CFG, "_6x6_single"); \
+  algebra::register_benchmark<mat66_det_lud_d_t>(CFG, "_6x6_double");
+
+// Macro for registering the benchmarks of the rank-1 Cholesky updates and
+// downdates against the full refactorization
+#define ALGEBRA_PLUGINS_REGISTER_CHOLESKY_BENCH(CFG)                     \
+  algebra::register_benchmark<mat55_chol_up_f_t>(CFG, "_5x5_single");    \
+  algebra::register_benchmark<mat55_chol_up_d_t>(CFG, "_5x5_double");    \
+  algebra::register_benchmark<mat66_chol_up_f_t>(CFG, "_6x6_single");    \
+  algebra::register_benchmark<mat66_chol_up_d_t>(CFG, "_6x6_double");    \
+  algebra::register_benchmark<mat88_chol_up_f_t>(CFG, "_8x8_single");    \
+  algebra::register_benchmark<mat88_chol_up_d_t>(CFG, "_8x8_double");    \
+                                                                         \
+  algebra::register_benchmark<mat55_chol_down_f_t>(CFG, "_5x5_single");  \
+  algebra::register_benchmark<mat55_chol_down_d_t>(CFG, "_5x5_double");  \
+  algebra::register_benchmark<mat66_chol_down_f_t>(CFG, "_6x6_single");  \
+  algebra::register_benchmark<mat66_chol_down_d_t>(CFG, "_6x6_double");  \
+  algebra::register_benchmark<mat88_chol_down_f_t>(CFG, "_8x8_single");  \
+  algebra::register_benchmark<mat88_chol_down_d_t>(CFG, "_8x8_double");  \
+                                                                         \
+  algebra::register_benchmark<mat55_chol_refac_f_t>(CFG, "_5x5_single"); \
+  algebra::register_benchmark<mat55_chol_refac_d_t>(CFG, "_5x5_double"); \
+  algebra::register_benchmark<mat66_chol_refac_f_t>(CFG, "_6x6_single"); \
+  algebra::register_benchmark<mat66_chol_refac_d_t>(CFG, "_6x6_double"); \
+  algebra::register_benchmark<mat88_chol_refac_f_t>(CFG, "_8x8_single"); \
+  algebra::register_benchmark<mat88_chol_refac_d_t>(CFG, "_8x8_double");
+
+// Macro for registering the benchmarks of the least squares solution of tall
+// systems with the QR decomposition against the normal equations
+#define ALGEBRA_PLUGINS_REGISTER_LEAST_SQUARES_BENCH(CFG)               \
+  algebra::register_benchmark<mat10x3_ls_qr_f_t>(CFG, "_10x3_single");  \
+  algebra::register_benchmark<mat10x3_ls_qr_d_t>(CFG, "_10x3_double");  \
+  algebra::register_benchmark<mat16x5_ls_qr_f_t>(CFG, "_16x5_single");  \
+  algebra::register_benchmark<mat16x5_ls_qr_d_t>(CFG, "_16x5_double");  \
+  algebra::register_benchmark<mat32x5_ls_qr_f_t>(CFG, "_32x5_single");  \
+  algebra::register_benchmark<mat32x5_ls_qr_d_t>(CFG, "_32x5_double");  \
+                                                                        \
+  algebra::register_benchmark<mat10x3_ls_lud_f_t>(CFG, "_10x3_single"); \
+  algebra::register_benchmark<mat10x3_ls_lud_d_t>(CFG, "_10x3_double"); \
+  algebra::register_benchmark<mat16x5_ls_lud_f_t>(CFG, "_16x5_single"); \
+  algebra::register_benchmark<mat16x5_ls_lud_d_t>(CFG, "_16x5_double"); \
+  algebra::register_benchmark<mat32x5_ls_lud_f_t>(CFG, "_32x5_single"); \
+  algebra::register_benchmark<mat32x5_ls_lud_d_t>(CFG, "_32x5_double");
+
+// Macro for registering the benchmarks of the pseudo-inverse, computed with
+// the singular value decomposition (compare with the LU decomposition)
+#define ALGEBRA_PLUGINS_REGISTER_PSEUDO_INVERSE_BENCH(CFG)           \
+  algebra::register_benchmark<mat44_pinv_f_t>(CFG, "_4x4_single"); \
+  algebra::register_benchmark<mat44_pinv_d_t>(CFG, "_4x4_double"); \
+  algebra::register_benchmark<mat66_pinv_f_t>(CFG, "_6x6_single"); \
+  algebra::register_benchmark<mat66_pinv_d_t>(CFG, "_6x6_double"); \
+  algebra::register_benchmark<mat88_pinv_f_t>(CFG, "_8x8_single"); \
+  algebra::register_benchmark<mat88_pinv_d_t>(CFG, "_8x8_double");
+
+// Macro for registering the benchmarks of the symmetric eigen decomposition
+#define ALGEBRA_PLUGINS_REGISTER_SYMMETRIC_EIGEN_BENCH(CFG)         \
+  algebra::register_benchmark<mat22_eig_f_t>(CFG, "_2x2_single"); \
+  algebra::register_benchmark<mat22_eig_d_t>(CFG, "_2x2_double"); \
+  algebra::register_benchmark<mat33_eig_f_t>(CFG, "_3x3_single"); \
+  algebra::register_benchmark<mat33_eig_d_t>(CFG, "_3x3_double");
+
 }  // namespace algebra
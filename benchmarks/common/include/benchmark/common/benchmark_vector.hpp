@@ -8,6 +8,7 @@
 #pragma once
 
 // Project include(s)
+#include "algebra/math/precision.hpp"
 #include "benchmark_base.hpp"
 #include "register_benchmark.hpp"
 
@@ -176,6 +177,30 @@ ALGEBRA_PLUGINS_BENCH_VECTOR(perp, algebra::traits::scalar_t<vector_t>)
 ALGEBRA_PLUGINS_BENCH_VECTOR(norm, algebra::traits::scalar_t<vector_t>)
 ALGEBRA_PLUGINS_BENCH_VECTOR(normalize, vector_t)
 
+// Macro for declaring vector unary ops with a precision policy
+#define ALGEBRA_PLUGINS_BENCH_VECTOR_PRECISION(OP, RES, PREC)    \
+  struct OP##_##PREC {                                           \
+    static constexpr std::string_view name{#OP "_" #PREC};       \
+    template <concepts::vector vector_t>                         \
+    constexpr RES operator()(const vector_t &a) const {          \
+      return algebra::vector::OP(a, algebra::precision::PREC{}); \
+    }                                                            \
+  };
+
+ALGEBRA_PLUGINS_BENCH_VECTOR_PRECISION(phi,
+                                       algebra::traits::scalar_t<vector_t>,
+                                       fast)
+ALGEBRA_PLUGINS_BENCH_VECTOR_PRECISION(theta,
+                                       algebra::traits::scalar_t<vector_t>,
+                                       fast)
+ALGEBRA_PLUGINS_BENCH_VECTOR_PRECISION(eta,
+                                       algebra::traits::scalar_t<vector_t>,
+                                       fast)
+ALGEBRA_PLUGINS_BENCH_VECTOR_PRECISION(norm,
+                                       algebra::traits::scalar_t<vector_t>,
+                                       fast)
+ALGEBRA_PLUGINS_BENCH_VECTOR_PRECISION(normalize, vector_t, fast)
+
 }  // namespace bench_op
 
 // Macro for registering all vector benchmarks
@@ -202,4 +227,17 @@ ALGEBRA_PLUGINS_BENCH_VECTOR(normalize, vector_t)
   algebra::register_benchmark<eta_f_t>(CFG, "_single");    \
   algebra::register_benchmark<eta_d_t>(CFG, "_double");
 
+// Macro for registering the vector benchmarks in the fast precision mode
+#define ALGEBRA_PLUGINS_REGISTER_FAST_VECTOR_BENCH(CFG)         \
+  algebra::register_benchmark<normlz_fast_f_t>(CFG, "_single"); \
+  algebra::register_benchmark<normlz_fast_d_t>(CFG, "_double"); \
+  algebra::register_benchmark<phi_fast_f_t>(CFG, "_single");    \
+  algebra::register_benchmark<phi_fast_d_t>(CFG, "_double");    \
+  algebra::register_benchmark<theta_fast_f_t>(CFG, "_single");  \
+  algebra::register_benchmark<theta_fast_d_t>(CFG, "_double");  \
+  algebra::register_benchmark<norm_fast_f_t>(CFG, "_single");   \
+  algebra::register_benchmark<norm_fast_d_t>(CFG, "_double");   \
+  algebra::register_benchmark<eta_fast_f_t>(CFG, "_single");    \
+  algebra::register_benchmark<eta_fast_d_t>(CFG, "_double");
+
 }  // namespace algebra
@@ -13,11 +13,40 @@
 // Benchmark include
 #include <benchmark/benchmark.h>
 
+// Eigen include(s)
+#include <Eigen/Eigenvalues>
+
 // System include(s)
 #include <iostream>
+#include <string_view>
+#include <utility>
 
 using namespace algebra;
 
+namespace algebra::bench_op {
+
+/// Eigen decomposition with the iterative Eigen solver, for comparison
+struct self_adjoint_eigen_solver {
+  static constexpr std::string_view name{"self_adjoint_eigen_solver"};
+  template <concepts::matrix matrix_t>
+  auto operator()(const matrix_t& a) const {
+    const Eigen::SelfAdjointEigenSolver<matrix_t> solver{a};
+    return std::make_pair(solver.eigenvalues(), solver.eigenvectors());
+  }
+};
+/// Eigen decomposition with the closed-form Eigen solver, for comparison
+struct self_adjoint_eigen_solver_direct {
+  static constexpr std::string_view name{"self_adjoint_eigen_solver_direct"};
+  template <concepts::matrix matrix_t>
+  auto operator()(const matrix_t& a) const {
+    Eigen::SelfAdjointEigenSolver<matrix_t> solver;
+    solver.computeDirect(a);
+    return std::make_pair(solver.eigenvalues(), solver.eigenvectors());
+  }
+};
+
+}  // namespace algebra::bench_op
+
 /// Run vector benchmarks
 int main(int argc, char** argv) {
 
@@ -105,6 +134,43 @@ int main(int argc, char** argv) {
   using mat88_vec_d_t = matrix_vector_bm<eigen::matrix_type<double, 8, 8>,
                                          eigen::vector_type<double, 8>>;
 
+  using mat22_eig_f_t =
+      matrix_symmetric_eigen_bm<eigen::matrix_type<float, 2, 2>,
+                                bench_op::symmetric_eigen>;
+  using mat22_eig_d_t =
+      matrix_symmetric_eigen_bm<eigen::matrix_type<double, 2, 2>,
+                                bench_op::symmetric_eigen>;
+  using mat33_eig_f_t =
+      matrix_symmetric_eigen_bm<eigen::matrix_type<float, 3, 3>,
+                                bench_op::symmetric_eigen>;
+  using mat33_eig_d_t =
+      matrix_symmetric_eigen_bm<eigen::matrix_type<double, 3, 3>,
+                                bench_op::symmetric_eigen>;
+  using mat22_eig_solver_f_t =
+      matrix_symmetric_eigen_bm<eigen::matrix_type<float, 2, 2>,
+                                bench_op::self_adjoint_eigen_solver>;
+  using mat22_eig_solver_d_t =
+      matrix_symmetric_eigen_bm<eigen::matrix_type<double, 2, 2>,
+                                bench_op::self_adjoint_eigen_solver>;
+  using mat22_eig_solver_direct_f_t =
+      matrix_symmetric_eigen_bm<eigen::matrix_type<float, 2, 2>,
+                                bench_op::self_adjoint_eigen_solver_direct>;
+  using mat22_eig_solver_direct_d_t =
+      matrix_symmetric_eigen_bm<eigen::matrix_type<double, 2, 2>,
+                                bench_op::self_adjoint_eigen_solver_direct>;
+  using mat33_eig_solver_f_t =
+      matrix_symmetric_eigen_bm<eigen::matrix_type<float, 3, 3>,
+                                bench_op::self_adjoint_eigen_solver>;
+  using mat33_eig_solver_d_t =
+      matrix_symmetric_eigen_bm<eigen::matrix_type<double, 3, 3>,
+                                bench_op::self_adjoint_eigen_solver>;
+  using mat33_eig_solver_direct_f_t =
+      matrix_symmetric_eigen_bm<eigen::matrix_type<float, 3, 3>,
+                                bench_op::self_adjoint_eigen_solver_direct>;
+  using mat33_eig_solver_direct_d_t =
+      matrix_symmetric_eigen_bm<eigen::matrix_type<double, 3, 3>,
+                                bench_op::self_adjoint_eigen_solver_direct>;
+
   std::cout << "------------------------------------------\n"
             << "Algebra-Plugins 'matrix' benchmark (Eigen)\n"
             << "------------------------------------------\n\n"
@@ -114,6 +180,17 @@ int main(int argc, char** argv) {
   // Register all benchmarks
   //
   ALGEBRA_PLUGINS_REGISTER_MATRIX_BENCH(cfg)
+  ALGEBRA_PLUGINS_REGISTER_SYMMETRIC_EIGEN_BENCH(cfg)
+
+  // Compare the symmetric eigen decomposition with the Eigen solvers
+  algebra::register_benchmark<mat22_eig_solver_f_t>(cfg, "_2x2_single");
+  algebra::register_benchmark<mat22_eig_solver_d_t>(cfg, "_2x2_double");
+  algebra::register_benchmark<mat33_eig_solver_f_t>(cfg, "_3x3_single");
+  algebra::register_benchmark<mat33_eig_solver_d_t>(cfg, "_3x3_double");
+  algebra::register_benchmark<mat22_eig_solver_direct_f_t>(cfg, "_2x2_single");
+  algebra::register_benchmark<mat22_eig_solver_direct_d_t>(cfg, "_2x2_double");
+  algebra::register_benchmark<mat33_eig_solver_direct_f_t>(cfg, "_3x3_single");
+  algebra::register_benchmark<mat33_eig_solver_direct_d_t>(cfg, "_3x3_double");
 
   ::benchmark::Initialize(&argc, argv);
   ::benchmark::RunSpecifiedBenchmarks();
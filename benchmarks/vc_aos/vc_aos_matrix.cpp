@@ -105,6 +105,58 @@ int main(int argc, char** argv) {
   using mat88_vec_d_t = matrix_vector_bm<vc_aos::matrix_type<double, 8, 8>,
                                          vc_aos::vector_type<double, 8>>;
 
+  using mat33_inv_f_t =
+      matrix_unaryOP_bm<vc_aos::matrix_type<float, 3, 3>, bench_op::invert>;
+  using mat33_inv_d_t =
+      matrix_unaryOP_bm<vc_aos::matrix_type<double, 3, 3>, bench_op::invert>;
+  using mat55_inv_f_t =
+      matrix_unaryOP_bm<vc_aos::matrix_type<float, 5, 5>, bench_op::invert>;
+  using mat55_inv_d_t =
+      matrix_unaryOP_bm<vc_aos::matrix_type<double, 5, 5>, bench_op::invert>;
+
+  using mat33_inv_lud_f_t =
+      matrix_unaryOP_bm<vc_aos::matrix_type<float, 3, 3>, bench_op::invert_lud>;
+  using mat33_inv_lud_d_t = matrix_unaryOP_bm<vc_aos::matrix_type<double, 3, 3>,
+                                              bench_op::invert_lud>;
+  using mat44_inv_lud_f_t =
+      matrix_unaryOP_bm<vc_aos::matrix_type<float, 4, 4>, bench_op::invert_lud>;
+  using mat44_inv_lud_d_t = matrix_unaryOP_bm<vc_aos::matrix_type<double, 4, 4>,
+                                              bench_op::invert_lud>;
+  using mat55_inv_lud_f_t =
+      matrix_unaryOP_bm<vc_aos::matrix_type<float, 5, 5>, bench_op::invert_lud>;
+  using mat55_inv_lud_d_t = matrix_unaryOP_bm<vc_aos::matrix_type<double, 5, 5>,
+                                              bench_op::invert_lud>;
+  using mat66_inv_lud_f_t =
+      matrix_unaryOP_bm<vc_aos::matrix_type<float, 6, 6>, bench_op::invert_lud>;
+  using mat66_inv_lud_d_t = matrix_unaryOP_bm<vc_aos::matrix_type<double, 6, 6>,
+                                              bench_op::invert_lud>;
+
+  using mat33_det_f_t = matrix_unaryOP_bm<vc_aos::matrix_type<float, 3, 3>,
+                                          bench_op::determinant>;
+  using mat33_det_d_t = matrix_unaryOP_bm<vc_aos::matrix_type<double, 3, 3>,
+                                          bench_op::determinant>;
+  using mat55_det_f_t = matrix_unaryOP_bm<vc_aos::matrix_type<float, 5, 5>,
+                                          bench_op::determinant>;
+  using mat55_det_d_t = matrix_unaryOP_bm<vc_aos::matrix_type<double, 5, 5>,
+                                          bench_op::determinant>;
+
+  using mat33_det_lud_f_t = matrix_unaryOP_bm<vc_aos::matrix_type<float, 3, 3>,
+                                              bench_op::determinant_lud>;
+  using mat33_det_lud_d_t = matrix_unaryOP_bm<vc_aos::matrix_type<double, 3, 3>,
+                                              bench_op::determinant_lud>;
+  using mat44_det_lud_f_t = matrix_unaryOP_bm<vc_aos::matrix_type<float, 4, 4>,
+                                              bench_op::determinant_lud>;
+  using mat44_det_lud_d_t = matrix_unaryOP_bm<vc_aos::matrix_type<double, 4, 4>,
+                                              bench_op::determinant_lud>;
+  using mat55_det_lud_f_t = matrix_unaryOP_bm<vc_aos::matrix_type<float, 5, 5>,
+                                              bench_op::determinant_lud>;
+  using mat55_det_lud_d_t = matrix_unaryOP_bm<vc_aos::matrix_type<double, 5, 5>,
+                                              bench_op::determinant_lud>;
+  using mat66_det_lud_f_t = matrix_unaryOP_bm<vc_aos::matrix_type<float, 6, 6>,
+                                              bench_op::determinant_lud>;
+  using mat66_det_lud_d_t = matrix_unaryOP_bm<vc_aos::matrix_type<double, 6, 6>,
+                                              bench_op::determinant_lud>;
+
   std::cout << "-------------------------------------------\n"
             << "Algebra-Plugins 'matrix' benchmark (Vc AoS)\n"
             << "-------------------------------------------\n\n"
@@ -114,6 +166,7 @@ int main(int argc, char** argv) {
   // Register all benchmarks
   //
   ALGEBRA_PLUGINS_REGISTER_MATRIX_BENCH(cfg)
+  ALGEBRA_PLUGINS_REGISTER_MATRIX_ALGORITHM_BENCH(cfg)
 
   ::benchmark::Initialize(&argc, argv);
   ::benchmark::RunSpecifiedBenchmarks();
@@ -0,0 +1,120 @@
+/** Algebra plugins library, part of the ACTS project
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "algebra/vc_soa.hpp"
+#include "benchmark/common/benchmark_base.hpp"
+#include "benchmark/vc_soa/data_generator.hpp"
+
+// Benchmark include
+#include <benchmark/benchmark.h>
+
+// System include(s)
+#include <random>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace algebra {
+
+/// Benchmark for the construction of SoA transforms from randomly indexed
+/// entries of an AoS transform table (e.g. the surfaces of a detector)
+///
+/// @tparam GATHER use the gather constructor, otherwise insert the transforms
+///                lane by lane
+template <concepts::value value_t, bool GATHER = true>
+struct transform3_gather_bm : public benchmark_base {
+
+  using transform3_t = vc_soa::transform3<value_t>;
+  using aos_transform3_t =
+      vc_aos::math::transform3<vc_aos::storage_type, value_t>;
+  using index_t = Vc::SimdArray<int, Vc::Vector<value_t>::Size>;
+
+  /// Prefix for the benchmark name
+  static constexpr std::string_view bm_name{"transform3"};
+  /// Number of transforms in the table
+  static constexpr std::size_t n_table{10000u};
+
+  std::vector<aos_transform3_t> table;
+  std::vector<index_t> indices;
+
+  /// No default construction: Cannot prepare data
+  transform3_gather_bm() = delete;
+  /// Construct from an externally provided configuration @param cfg
+  explicit transform3_gather_bm(benchmark_base::configuration cfg)
+      : benchmark_base{cfg} {
+
+    constexpr std::size_t width{index_t::size()};
+
+    // Fill the table from the lanes of random SoA transforms
+    std::vector<transform3_t> trfs;
+    trfs.reserve(n_table / width);
+    fill_random_trf(trfs);
+
+    table.reserve(trfs.size() * width);
+    for (const transform3_t& trf : trfs) {
+      for (std::size_t i = 0u; i < width; ++i) {
+        table.push_back(vc_soa::lane_access<transform3_t>::get(trf, i));
+      }
+    }
+
+    // Random table positions
+    std::mt19937 gen{42u};
+    std::uniform_int_distribution<int> dist(
+        0, static_cast<int>(table.size()) - 1);
+
+    indices.resize(this->m_cfg.n_samples());
+    for (index_t& idx : indices) {
+      for (std::size_t i = 0u; i < width; ++i) {
+        idx[i] = dist(gen);
+      }
+    }
+  }
+  transform3_gather_bm(const transform3_gather_bm& bm) = default;
+  transform3_gather_bm& operator=(transform3_gather_bm& other) = default;
+
+  /// Clear state
+  ~transform3_gather_bm() override {
+    table.clear();
+    indices.clear();
+  }
+
+  constexpr std::string name() const override {
+    return std::string{bm_name} + (GATHER ? "_gather" : "_insert");
+  }
+
+  /// Benchmark case
+  inline void operator()(::benchmark::State& state) const override {
+
+    const std::span<const aos_transform3_t> trf_table{table};
+
+    // Run the benchmark
+    for (auto _ : state) {
+      for (const index_t& idx : indices) {
+
+        if constexpr (GATHER) {
+          transform3_t result{trf_table, idx};
+
+          ::benchmark::DoNotOptimize(result);
+        } else {
+          transform3_t result{};
+          for (std::size_t i = 0u; i < index_t::size(); ++i) {
+            vc_soa::lane_access<transform3_t>::set(
+                result, i, trf_table[static_cast<std::size_t>(idx[i])]);
+          }
+
+          ::benchmark::DoNotOptimize(result);
+        }
+      }
+    }
+  }
+};
+
+}  // namespace algebra
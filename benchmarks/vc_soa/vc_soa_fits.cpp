@@ -0,0 +1,69 @@
+/** Algebra plugins library, part of the ACTS project
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "algebra/vc_soa.hpp"
+#include "benchmark/common/benchmark_fits.hpp"
+#include "benchmark/vc_soa/data_generator.hpp"
+
+// Benchmark include
+#include <benchmark/benchmark.h>
+
+// System include(s)
+#include <iostream>
+
+using namespace algebra;
+
+/// Run the line and circle fit benchmarks
+int main(int argc, char** argv) {
+
+  constexpr std::size_t n_samples{100000};
+
+  //
+  // Prepare benchmarks
+  //
+  algebra::benchmark_base::configuration cfg_s{};
+  // Reduce the number of samples, since a single SoA struct contains the hits
+  // of multiple fit candidates (compare with the scalar 'array' benchmark)
+  cfg_s.n_samples(n_samples / Vc::float_v::Size);
+
+  // For double precision we need more samples (less candidates per SoA)
+  algebra::benchmark_base::configuration cfg_d{cfg_s};
+  cfg_d.n_samples(n_samples / Vc::double_v::Size);
+
+  using fit_3_line_f_t = fit_bm<plugin::vc_soa<float>, 3, bench_op::line_fit>;
+  using fit_3_line_d_t =
+      fit_bm<plugin::vc_soa<double>, 3, bench_op::line_fit>;
+  using fit_10_line_f_t =
+      fit_bm<plugin::vc_soa<float>, 10, bench_op::line_fit>;
+  using fit_10_line_d_t =
+      fit_bm<plugin::vc_soa<double>, 10, bench_op::line_fit>;
+  using fit_3_circle_f_t =
+      fit_bm<plugin::vc_soa<float>, 3, bench_op::circle_fit>;
+  using fit_3_circle_d_t =
+      fit_bm<plugin::vc_soa<double>, 3, bench_op::circle_fit>;
+  using fit_10_circle_f_t =
+      fit_bm<plugin::vc_soa<float>, 10, bench_op::circle_fit>;
+  using fit_10_circle_d_t =
+      fit_bm<plugin::vc_soa<double>, 10, bench_op::circle_fit>;
+
+  std::cout << "-------------------------------------------\n"
+            << "Algebra-Plugins 'fit' benchmark (Vc SoA)\n"
+            << "-------------------------------------------\n\n"
+            << "(single)\n"
+            << cfg_s << "(double)\n"
+            << cfg_d;
+
+  //
+  // Register all benchmarks
+  //
+  ALGEBRA_PLUGINS_REGISTER_FIT_BENCH(cfg_s, cfg_d)
+
+  ::benchmark::Initialize(&argc, argv);
+  ::benchmark::RunSpecifiedBenchmarks();
+  ::benchmark::Shutdown();
+}
@@ -49,6 +49,13 @@ int main(int argc, char** argv) {
   using normlz_f_t =
       vector_unaryOP_bm<vc_soa::vector3, float, bench_op::normalize>;
 
+  using normlz_fast_f_t =
+      vector_unaryOP_bm<vc_soa::vector3, float, bench_op::normalize_fast>;
+  using norm_fast_f_t =
+      vector_unaryOP_bm<vc_soa::vector3, float, bench_op::norm_fast>;
+  using eta_fast_f_t =
+      vector_unaryOP_bm<vc_soa::vector3, float, bench_op::eta_fast>;
+
   using phi_d_t = vector_unaryOP_bm<vc_soa::vector3, double, bench_op::phi>;
   using theta_d_t = vector_unaryOP_bm<vc_soa::vector3, double, bench_op::theta>;
   using perp_d_t = vector_unaryOP_bm<vc_soa::vector3, double, bench_op::perp>;
@@ -63,6 +70,13 @@ int main(int argc, char** argv) {
   using normlz_d_t =
       vector_unaryOP_bm<vc_soa::vector3, double, bench_op::normalize>;
 
+  using normlz_fast_d_t =
+      vector_unaryOP_bm<vc_soa::vector3, double, bench_op::normalize_fast>;
+  using norm_fast_d_t =
+      vector_unaryOP_bm<vc_soa::vector3, double, bench_op::norm_fast>;
+  using eta_fast_d_t =
+      vector_unaryOP_bm<vc_soa::vector3, double, bench_op::eta_fast>;
+
   std::cout << "-------------------------------------------\n"
             << "Algebra-Plugins 'vector' benchmark (Vc SoA)\n"
             << "-------------------------------------------\n\n"
@@ -95,6 +109,13 @@ int main(int argc, char** argv) {
   algebra::register_benchmark<eta_f_t>(cfg_s, "_single");
   algebra::register_benchmark<eta_d_t>(cfg_d, "_double");
 
+  algebra::register_benchmark<normlz_fast_f_t>(cfg_s, "_single");
+  algebra::register_benchmark<normlz_fast_d_t>(cfg_d, "_double");
+  algebra::register_benchmark<norm_fast_f_t>(cfg_s, "_single");
+  algebra::register_benchmark<norm_fast_d_t>(cfg_d, "_double");
+  algebra::register_benchmark<eta_fast_f_t>(cfg_s, "_single");
+  algebra::register_benchmark<eta_fast_d_t>(cfg_d, "_double");
+
   ::benchmark::Initialize(&argc, argv);
   ::benchmark::RunSpecifiedBenchmarks();
   ::benchmark::Shutdown();
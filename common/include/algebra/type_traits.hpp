@@ -64,9 +64,13 @@ using vector_t = typename vector<M>::type;
 template <class M, index_t<M> N, typename T>
 using get_vector_t = typename vector<M>::template other_type<T, N>;
 
+/// Matrix type that owns its elements (differs from @c M for views)
 template <class M>
 struct matrix {};
 
+template <class M>
+using matrix_t = typename matrix<M>::type;
+
 template <class M, index_t<M> ROWS, index_t<M> COLS, typename T>
 using get_matrix_t = typename matrix<M>::template other_type<T, ROWS, COLS>;
 /// @}
@@ -119,6 +123,15 @@ inline constexpr bool is_matrix{dimensions<std::remove_cvref_t<M>>::dim == 2};
 
 template <class M>
 inline constexpr bool is_square{(rows<M> == columns<M>)};
+
+/// Whether the elements are stored densely packed in column major order
+/// (specialized by the storage backends)
+template <class M>
+struct column_major : public std::false_type {};
+
+template <class M>
+inline constexpr bool is_column_major{
+    column_major<std::remove_cvref_t<M>>::value};
 /// @}
 
 /// Getter types
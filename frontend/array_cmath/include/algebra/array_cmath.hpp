@@ -33,6 +33,11 @@ using cmath::storage::element;
 using cmath::storage::set_block;
 using cmath::storage::vector;
 
+using storage::block;
+using storage::element;
+using storage::lazy_block;
+using storage::set_block;
+
 /// @}
 
 }  // namespace getter
@@ -58,28 +63,6 @@ using cmath::theta;
 
 }  // namespace vector
 
-// Use special algorithms for 4 dimensional matrices
-namespace generic {
-
-// Determinant algorithms
-template <concepts::scalar T, auto ROWS, auto COLS>
-struct determinant_selector<4, array::matrix_type<T, ROWS, COLS>,
-                            array::element_getter> {
-  using type =
-      matrix::determinant::hard_coded<array::matrix_type<T, ROWS, COLS>,
-                                      array::element_getter>;
-};
-
-// Inversion algorithms
-template <concepts::scalar T, auto ROWS, auto COLS>
-struct inversion_selector<4, array::matrix_type<T, ROWS, COLS>,
-                          array::element_getter> {
-  using type = matrix::inverse::hard_coded<array::matrix_type<T, ROWS, COLS>,
-                                           array::element_getter>;
-};
-
-}  // namespace generic
-
 namespace matrix {
 
 /// @name Matrix functions on @c algebra::array::storage_type
@@ -95,6 +78,15 @@ using cmath::determinant;
 using cmath::inverse;
 using cmath::transpose;
 
+using generic::math::determinant;
+using generic::math::inverse;
+using generic::math::transpose;
+
+using storage::lazy_transpose;
+
+using generic::math::condition_number;
+using generic::math::least_squares;
+using generic::math::pseudo_inverse;
 using generic::math::set_inplace_product_left;
 using generic::math::set_inplace_product_left_transpose;
 using generic::math::set_inplace_product_right;
@@ -102,6 +94,12 @@ using generic::math::set_inplace_product_right_transpose;
 using generic::math::set_product;
 using generic::math::set_product_left_transpose;
 using generic::math::set_product_right_transpose;
+using generic::math::similarity;
+using generic::math::solve_lower;
+using generic::math::solve_upper;
+using generic::math::symmetric_eigen;
+using generic::math::trmm;
+using generic::math::trmv;
 
 /// @}
 
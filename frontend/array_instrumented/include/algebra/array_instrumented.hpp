@@ -0,0 +1,49 @@
+/** Algebra plugins library, part of the ACTS project
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// The math overloads for the instrumented scalar need to be declared before
+// the (qualified) calls in the generic algorithms are parsed
+#include "algebra/utils/instrumented.hpp"
+
+// Project include(s).
+#include "algebra/array_cmath.hpp"
+
+namespace algebra {
+
+namespace plugin {
+
+/// Define the plugin types
+///
+/// Same as @c algebra::plugin::array, but with an operation counting scalar
+/// type (see @c algebra::instrumented)
+/// @{
+template <concepts::value V>
+struct array_instrumented {
+  /// Define scalar type
+  using value_type = V;
+
+  template <concepts::value T>
+  using simd = algebra::instrumented<T>;
+
+  using boolean = bool;
+  using scalar = algebra::instrumented<value_type>;
+  using size_type = algebra::array::size_type;
+  using transform3D = algebra::array::transform3<scalar>;
+  using point2D = algebra::array::point2<scalar>;
+  using point3D = algebra::array::point3<scalar>;
+  using vector3D = algebra::array::vector3<scalar>;
+
+  template <std::size_t ROWS, std::size_t COLS>
+  using matrix = algebra::array::matrix_type<scalar, ROWS, COLS>;
+};
+/// @}
+
+}  // namespace plugin
+
+}  // namespace algebra
@@ -71,6 +71,9 @@ using generic::math::set_zero;
 using generic::math::transpose;
 using generic::math::zero;
 
+using generic::math::condition_number;
+using generic::math::least_squares;
+using generic::math::pseudo_inverse;
 using generic::math::set_inplace_product_left;
 using generic::math::set_inplace_product_left_transpose;
 using generic::math::set_inplace_product_right;
@@ -78,6 +81,12 @@ using generic::math::set_inplace_product_right_transpose;
 using generic::math::set_product;
 using generic::math::set_product_left_transpose;
 using generic::math::set_product_right_transpose;
+using generic::math::similarity;
+using generic::math::solve_lower;
+using generic::math::solve_upper;
+using generic::math::symmetric_eigen;
+using generic::math::trmm;
+using generic::math::trmv;
 
 /// @}
 
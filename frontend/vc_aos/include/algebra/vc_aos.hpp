@@ -51,28 +51,6 @@ using vc_aos::math::theta;
 
 }  // namespace vector
 
-// Use special algorithms for 4 dimensional matrices
-namespace generic {
-
-// Determinant algorithms
-template <concepts::scalar T, auto ROWS, auto COLS>
-struct determinant_selector<4, vc_aos::matrix_type<T, ROWS, COLS>,
-                            vc_aos::element_getter> {
-  using type =
-      matrix::determinant::hard_coded<vc_aos::matrix_type<T, ROWS, COLS>,
-                                      vc_aos::element_getter>;
-};
-
-// Inversion algorithms
-template <concepts::scalar T, auto ROWS, auto COLS>
-struct inversion_selector<4, vc_aos::matrix_type<T, ROWS, COLS>,
-                          vc_aos::element_getter> {
-  using type = matrix::inverse::hard_coded<vc_aos::matrix_type<T, ROWS, COLS>,
-                                           vc_aos::element_getter>;
-};
-
-}  // namespace generic
-
 namespace matrix {
 
 /// @name Matrix functions on @c algebra::vc_aos types
@@ -86,6 +64,9 @@ using vc_aos::math::set_zero;
 using vc_aos::math::transpose;
 using vc_aos::math::zero;
 
+using generic::math::condition_number;
+using generic::math::least_squares;
+using generic::math::pseudo_inverse;
 using generic::math::set_inplace_product_left;
 using generic::math::set_inplace_product_left_transpose;
 using generic::math::set_inplace_product_right;
@@ -93,6 +74,12 @@ using generic::math::set_inplace_product_right_transpose;
 using generic::math::set_product;
 using generic::math::set_product_left_transpose;
 using generic::math::set_product_right_transpose;
+using generic::math::similarity;
+using generic::math::solve_lower;
+using generic::math::solve_upper;
+using generic::math::symmetric_eigen;
+using generic::math::trmm;
+using generic::math::trmv;
 
 /// @}
 
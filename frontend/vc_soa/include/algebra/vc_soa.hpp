@@ -10,6 +10,7 @@
 // Project include(s).
 #include "algebra/math/impl/generic_matrix.hpp"
 #include "algebra/math/impl/vc_aos_transform3.hpp"
+#include "algebra/math/impl/vc_soa_aosoa.hpp"
 #include "algebra/math/vc_soa.hpp"
 #include "algebra/storage/vc_soa.hpp"
 
@@ -72,6 +73,9 @@ using vc_soa::math::set_zero;
 using vc_soa::math::transpose;
 using vc_soa::math::zero;
 
+using generic::math::condition_number;
+using generic::math::least_squares;
+using generic::math::pseudo_inverse;
 using generic::math::set_inplace_product_left;
 using generic::math::set_inplace_product_left_transpose;
 using generic::math::set_inplace_product_right;
@@ -79,6 +83,12 @@ using generic::math::set_inplace_product_right_transpose;
 using generic::math::set_product;
 using generic::math::set_product_left_transpose;
 using generic::math::set_product_right_transpose;
+using generic::math::similarity;
+using generic::math::solve_lower;
+using generic::math::solve_upper;
+using generic::math::symmetric_eigen;
+using generic::math::trmm;
+using generic::math::trmv;
 
 }  // namespace matrix
 
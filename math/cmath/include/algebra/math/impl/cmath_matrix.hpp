@@ -75,7 +75,7 @@ ALGEBRA_HOST_DEVICE constexpr scalar_t determinant(
   return algebra::generic::math::determinant(m);
 }
 
-/// @returns the determinant of @param m
+/// @returns the inverse of @param m
 template <std::size_t ROWS, std::size_t COLS, concepts::scalar scalar_t,
           template <typename, std::size_t> class array_t>
 ALGEBRA_HOST_DEVICE constexpr auto inverse(
@@ -83,4 +83,24 @@ ALGEBRA_HOST_DEVICE constexpr auto inverse(
   return algebra::generic::math::inverse(m);
 }
 
+/// @returns the determinant of @param m, computed with the algorithm given by
+/// the policy @tparam policy_t
+template <std::size_t ROWS, std::size_t COLS, concepts::scalar scalar_t,
+          template <typename, std::size_t> class array_t,
+          algebra::generic::matrix::policy::algorithm_policy policy_t>
+ALGEBRA_HOST_DEVICE constexpr scalar_t determinant(
+    const array_t<array_t<scalar_t, ROWS>, COLS> &m, policy_t p) {
+  return algebra::generic::math::determinant(m, p);
+}
+
+/// @returns the inverse of @param m, computed with the algorithm given by the
+/// policy @tparam policy_t
+template <std::size_t ROWS, std::size_t COLS, concepts::scalar scalar_t,
+          template <typename, std::size_t> class array_t,
+          algebra::generic::matrix::policy::algorithm_policy policy_t>
+ALGEBRA_HOST_DEVICE constexpr auto inverse(
+    const array_t<array_t<scalar_t, ROWS>, COLS> &m, policy_t p) {
+  return algebra::generic::math::inverse(m, p);
+}
+
 }  // namespace algebra::cmath
@@ -11,6 +11,8 @@
 #include "algebra/concepts.hpp"
 #include "algebra/math/common.hpp"
 #include "algebra/math/generic.hpp"
+#include "algebra/math/precision.hpp"
+#include "algebra/math/vec.hpp"
 #include "algebra/qualifiers.hpp"
 
 namespace algebra::cmath {
@@ -26,6 +28,19 @@ requires(N >= 2) ALGEBRA_HOST_DEVICE constexpr scalar_t
   return algebra::generic::math::phi(v);
 }
 
+/// This method retrieves phi from a vector with rows >= 2
+///
+/// @param v the input vector
+/// @param p the precision policy
+template <concepts::index size_type,
+          template <typename, size_type> class array_t,
+          concepts::scalar scalar_t, size_type N,
+          concepts::precision_policy precision_t>
+requires(N >= 2) ALGEBRA_HOST_DEVICE constexpr scalar_t
+    phi(const array_t<scalar_t, N> &v, precision_t p) {
+  return algebra::generic::math::phi(v, p);
+}
+
 /// This method retrieves the perpendicular magnitude of a vector with rows >= 2
 ///
 /// @param v the input vector
@@ -48,6 +63,19 @@ requires(N >= 2) ALGEBRA_HOST_DEVICE constexpr scalar_t
   return algebra::generic::math::theta(v);
 }
 
+/// This method retrieves theta from a vector with rows >= 3
+///
+/// @param v the input vector
+/// @param p the precision policy
+template <concepts::index size_type,
+          template <typename, size_type> class array_t,
+          concepts::scalar scalar_t, size_type N,
+          concepts::precision_policy precision_t>
+requires(N >= 2) ALGEBRA_HOST_DEVICE constexpr scalar_t
+    theta(const array_t<scalar_t, N> &v, precision_t p) {
+  return algebra::generic::math::theta(v, p);
+}
+
 /// Cross product between two input vectors - 3 Dim
 ///
 /// @tparam size_type the index type for this plugin
@@ -180,6 +208,22 @@ requires(N >= 2) ALGEBRA_HOST_DEVICE constexpr scalar_t
   return algebra::math::sqrt(dot(v, v));
 }
 
+/// This method retrieves the norm of a vector, no dimension restriction
+///
+/// @param v the input vector
+///
+/// @note A single square root is cheaper than the refined reciprocal square
+/// root estimate, so the norm is computed exactly in both precision modes
+template <concepts::index size_type,
+          template <typename, size_type> class array_t,
+          concepts::scalar scalar_t, size_type N,
+          concepts::precision_policy precision_t>
+requires(N >= 2) ALGEBRA_HOST_DEVICE constexpr scalar_t
+    norm(const array_t<scalar_t, N> &v, precision_t) {
+
+  return norm(v);
+}
+
 /// This method retrieves the pseudo-rapidity from a vector or vector base with
 /// rows >= 3
 ///
@@ -193,6 +237,26 @@ requires(N >= 3) ALGEBRA_HOST_DEVICE constexpr scalar_t
   return algebra::math::atanh(v[2] / norm(v));
 }
 
+/// This method retrieves the pseudo-rapidity from a vector or vector base with
+/// rows >= 3
+///
+/// @param v the input vector
+/// @param p the precision policy
+template <concepts::index size_type,
+          template <typename, size_type> class array_t,
+          concepts::scalar scalar_t, size_type N,
+          concepts::precision_policy precision_t>
+requires(N >= 3) ALGEBRA_HOST_DEVICE constexpr scalar_t
+    eta(const array_t<scalar_t, N> &v, precision_t p) noexcept {
+
+  if constexpr (std::same_as<precision_t, precision::fast>) {
+    return algebra::math::vec::atanh(v[2] *
+                                     algebra::math::rsqrt(dot(v, v), p));
+  } else {
+    return eta(v);
+  }
+}
+
 /// Get a normalized version of the input vector
 ///
 /// @param v the input vector
@@ -205,4 +269,22 @@ ALGEBRA_HOST_DEVICE constexpr array_t<scalar_t, N> normalize(
   return (static_cast<scalar_t>(1.) / norm(v)) * v;
 }
 
+/// Get a normalized version of the input vector
+///
+/// @param v the input vector
+/// @param p the precision policy
+template <concepts::index size_type,
+          template <typename, size_type> class array_t,
+          concepts::scalar scalar_t, size_type N,
+          concepts::precision_policy precision_t>
+ALGEBRA_HOST_DEVICE constexpr array_t<scalar_t, N> normalize(
+    const array_t<scalar_t, N> &v, precision_t p) {
+
+  if constexpr (std::same_as<precision_t, precision::fast>) {
+    return algebra::math::rsqrt(dot(v, v), p) * v;
+  } else {
+    return normalize(v);
+  }
+}
+
 }  // namespace algebra::cmath
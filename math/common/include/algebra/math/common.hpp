@@ -7,6 +7,9 @@
 
 #pragma once
 
+// Project include(s).
+#include "algebra/qualifiers.hpp"
+
 // SYCL include(s).
 #if defined(CL_SYCL_LANGUAGE_VERSION) || defined(SYCL_LANGUAGE_VERSION)
 #include <sycl/sycl.hpp>
@@ -15,6 +18,8 @@
 // System include(s).
 #include <algorithm>
 #include <cmath>
+#include <concepts>
+#include <utility>
 
 namespace algebra {
 
@@ -29,4 +34,28 @@ using namespace std;
 }
 #endif  // SYCL
 
+namespace math {
+
+/// @returns the sine and cosine of @param x
+///
+/// @note On the host, the compilers fuse the two calls into a single
+/// @c sincos call of the math library
+template <std::floating_point T>
+ALGEBRA_HOST_DEVICE inline std::pair<T, T> sincos(const T x) {
+#if defined(__CUDA_ARCH__)
+  T s{};
+  T c{};
+  if constexpr (std::same_as<T, float>) {
+    ::sincosf(x, &s, &c);
+  } else {
+    ::sincos(x, &s, &c);
+  }
+  return {s, c};
+#else
+  return {algebra::math::sin(x), algebra::math::cos(x)};
+#endif
+}
+
+}  // namespace math
+
 }  // namespace algebra
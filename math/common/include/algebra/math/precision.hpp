@@ -0,0 +1,99 @@
+/** Algebra plugins library, part of the ACTS project
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "algebra/math/common.hpp"
+#include "algebra/qualifiers.hpp"
+
+// System include(s).
+#include <concepts>
+#include <type_traits>
+
+#if !defined(__CUDA_ARCH__) && !defined(__SYCL_DEVICE_ONLY__) && \
+    (defined(__SSE__) || defined(_M_X64) ||                     \
+     (defined(_M_IX86_FP) && _M_IX86_FP >= 1))
+#define ALGEBRA_PLUGINS_HAVE_SSE_RSQRT
+#include <xmmintrin.h>
+#endif
+
+namespace algebra {
+
+/// Precision policies for the vector operations (@c phi, @c theta, @c eta,
+/// @c norm and @c normalize)
+namespace precision {
+
+/// Correctly rounded square root and division, libm transcendental functions
+/// (default)
+struct exact {};
+
+/// Hardware reciprocal square root estimate, refined by one Newton-Raphson
+/// step: Close to full single precision accuracy, but considerably cheaper
+/// than a division and a square root. The transcendental functions are
+/// evaluated with the vectorizable approximations in @c algebra::math::vec
+struct fast {};
+
+}  // namespace precision
+
+namespace concepts {
+
+/// Precision policy tag
+template <typename T>
+concept precision_policy = std::same_as<T, algebra::precision::exact> ||
+                           std::same_as<T, algebra::precision::fast>;
+
+}  // namespace concepts
+
+namespace math {
+
+/// One Newton-Raphson step to refine the estimate @param y of the reciprocal
+/// square root of @param x
+template <typename scalar_t>
+ALGEBRA_HOST_DEVICE constexpr scalar_t rsqrt_newton_raphson(const scalar_t &x,
+                                                            const scalar_t &y) {
+  const scalar_t half{0.5f};
+  const scalar_t three_halfs{1.5f};
+
+  return y * (three_halfs - half * x * y * y);
+}
+
+/// @returns the reciprocal square root of @param x
+template <typename scalar_t>
+ALGEBRA_HOST_DEVICE constexpr scalar_t rsqrt(const scalar_t &x,
+                                             algebra::precision::exact) {
+  return static_cast<scalar_t>(1) / algebra::math::sqrt(x);
+}
+
+/// @returns the reciprocal square root of @param x
+///
+/// @note The estimate instruction is only available in single precision. For
+/// other scalar types this falls back to the exact computation.
+template <typename scalar_t>
+ALGEBRA_HOST_DEVICE inline scalar_t rsqrt(const scalar_t &x,
+                                          algebra::precision::fast) {
+#if defined(__CUDA_ARCH__)
+  if constexpr (std::same_as<scalar_t, float>) {
+    return ::rsqrtf(x);
+  } else if constexpr (std::same_as<scalar_t, double>) {
+    return ::rsqrt(x);
+  }
+#elif defined(__SYCL_DEVICE_ONLY__)
+  if constexpr (std::is_floating_point_v<scalar_t>) {
+    return ::sycl::rsqrt(x);
+  }
+#elif defined(ALGEBRA_PLUGINS_HAVE_SSE_RSQRT)
+  if constexpr (std::same_as<scalar_t, float>) {
+    return rsqrt_newton_raphson(x, _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(x))));
+  }
+#endif
+  return rsqrt(x, algebra::precision::exact{});
+}
+
+}  // namespace math
+
+}  // namespace algebra
@@ -0,0 +1,155 @@
+/** Algebra plugins library, part of the ACTS project
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "algebra/math/common.hpp"
+#include "algebra/math/vec.hpp"
+#include "algebra/qualifiers.hpp"
+
+// System include(s).
+#include <array>
+#include <concepts>
+#include <utility>
+
+/// Construction of 3D rotation matrices from axis-angle pairs, rotation
+/// vectors and Euler angles
+///
+/// The matrices are returned as their columns (the rotated coordinate axes),
+/// so that the plugins can fill them into their transforms. The computations
+/// are branch-free in the angles, so that they also work for SoA types.
+namespace algebra::math {
+
+/// Columns of a 3x3 rotation matrix
+template <typename T>
+using rotation3 = std::array<std::array<T, 3>, 3>;
+
+namespace detail {
+
+/// Below this squared angle, the truncated series of the small-angle
+/// expansion are exact within the rounding errors
+template <typename value_t>
+inline constexpr value_t small_angle2{std::same_as<value_t, float>
+                                          ? static_cast<value_t>(1e-2)
+                                          : static_cast<value_t>(1e-4)};
+
+/// @returns the sine and cosine of @param x: the math library for floating
+/// point values and the polynomial approximation for simd types
+template <vec::vectorizable T>
+ALGEBRA_HOST_DEVICE constexpr std::pair<T, T> rotation_sincos(const T &x) {
+  if constexpr (std::floating_point<T>) {
+    return algebra::math::sincos(x);
+  } else {
+    return vec::sincos(x);
+  }
+}
+
+/// @returns the rotation matrix c * I + s * [w]_x + v * w * w^T
+template <typename T>
+ALGEBRA_HOST_DEVICE constexpr rotation3<T> rotation_matrix(
+    const T &c, const T &s, const T &v, const T &wx, const T &wy,
+    const T &wz) {
+  return {{{c + v * wx * wx, s * wz + v * wy * wx, -s * wy + v * wz * wx},
+           {-s * wz + v * wx * wy, c + v * wy * wy, s * wx + v * wz * wy},
+           {s * wy + v * wx * wz, -s * wx + v * wy * wz, c + v * wz * wz}}};
+}
+
+}  // namespace detail
+
+/// @returns the rotation by @param angle around the unit vector
+/// (@param nx, @param ny, @param nz), following the right hand rule
+///
+/// Rodrigues' formula R = cos(a) * I + sin(a) * [n]_x + (1 - cos(a)) * n * n^T
+/// is evaluated from the half angle, which keeps 1 - cos(a) accurate for small
+/// angles
+template <vec::vectorizable T>
+ALGEBRA_HOST_DEVICE constexpr rotation3<T> rotation_from_axis_angle(
+    const T &nx, const T &ny, const T &nz, const T &angle) {
+
+  using value_t = typename vec::simd_ops<T>::value_type;
+
+  const T one{static_cast<value_t>(1)};
+  const T two{static_cast<value_t>(2)};
+
+  const auto [s, c] = detail::rotation_sincos(T{static_cast<value_t>(0.5)} *
+                                              angle);
+  const T v{two * s * s};
+
+  return detail::rotation_matrix(one - v, two * s * c, v, nx, ny, nz);
+}
+
+/// @returns the rotation by the angle |w| around the axis w / |w| for the
+/// rotation vector w = (@param wx, @param wy, @param wz)
+///
+/// Uses R = I + sin(a) / a * [w]_x + (1 - cos(a)) / a^2 * [w]_x^2 with a = |w|
+/// for large angles and the series expansion of the coefficients for small
+/// angles, which needs neither the trigonometric functions nor the norm.
+/// For floating point values, the exact formula is only evaluated for large
+/// angles, for simd types it is selected per lane.
+template <vec::vectorizable T>
+ALGEBRA_HOST_DEVICE constexpr rotation3<T> rotation_from_rotation_vector(
+    const T &wx, const T &wy, const T &wz) {
+
+  using ops = vec::simd_ops<T>;
+  using value_t = typename ops::value_type;
+
+  const T one{static_cast<value_t>(1)};
+  const T two{static_cast<value_t>(2)};
+  const T half{static_cast<value_t>(0.5)};
+
+  const T theta2{wx * wx + wy * wy + wz * wz};
+
+  // sin(a) / a = 1 - a^2 / 6 * (1 - a^2 / 20) + O(a^6) and
+  // (1 - cos(a)) / a^2 = 1/2 * (1 - a^2 / 12 * (1 - a^2 / 30)) + O(a^6)
+  const T s_small{one - theta2 * T{static_cast<value_t>(1. / 6.)} *
+                            (one - theta2 * T{static_cast<value_t>(0.05)})};
+  const T v_small{half * (one - theta2 * T{static_cast<value_t>(1. / 12.)} *
+                                    (one - theta2 * T{static_cast<value_t>(
+                                                        1. / 30.)}))};
+
+  const auto small = theta2 < T{detail::small_angle2<value_t>};
+
+  if constexpr (std::floating_point<T>) {
+    if (small) {
+      return detail::rotation_matrix(one - v_small * theta2, s_small, v_small,
+                                     wx, wy, wz);
+    }
+  }
+
+  // Avoid the division by zero in the lanes that use the expansion
+  const T theta{ops::sqrt(ops::select(small, one, theta2))};
+  const T inv_theta{one / theta};
+
+  const auto [s_half, c_half] = detail::rotation_sincos(half * theta);
+  const T s_exact{two * s_half * c_half * inv_theta};
+  const T v_exact{two * s_half * s_half * inv_theta * inv_theta};
+
+  const T s{ops::select(small, s_small, s_exact)};
+  const T v{ops::select(small, v_small, v_exact)};
+
+  // cos(a) = 1 - (1 - cos(a)) / a^2 * a^2
+  return detail::rotation_matrix(one - v * theta2, s, v, wx, wy, wz);
+}
+
+/// @returns the rotation R = R_z(@param gamma) * R_y(@param beta) *
+/// R_x(@param alpha), i.e. the rotations around the fixed x, y and z axes,
+/// in this order
+template <vec::vectorizable T>
+ALGEBRA_HOST_DEVICE constexpr rotation3<T> rotation_from_euler(
+    const T &alpha, const T &beta, const T &gamma) {
+
+  const auto [sa, ca] = detail::rotation_sincos(alpha);
+  const auto [sb, cb] = detail::rotation_sincos(beta);
+  const auto [sg, cg] = detail::rotation_sincos(gamma);
+
+  return {{{cg * cb, sg * cb, -sb},
+           {cg * sb * sa - sg * ca, sg * sb * sa + cg * ca, cb * sa},
+           {cg * sb * ca + sg * sa, sg * sb * ca - cg * sa, cb * ca}}};
+}
+
+}  // namespace algebra::math
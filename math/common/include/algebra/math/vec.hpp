@@ -0,0 +1,573 @@
+/** Algebra plugins library, part of the ACTS project
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "algebra/math/common.hpp"
+#include "algebra/qualifiers.hpp"
+
+// System include(s).
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numbers>
+#include <type_traits>
+#include <utility>
+
+#if !defined(__CUDACC__) && !defined(CL_SYCL_LANGUAGE_VERSION) && \
+    !defined(SYCL_LANGUAGE_VERSION) && __has_include(<experimental/simd>)
+#include <experimental/simd>
+#if defined(__cpp_lib_experimental_parallel_simd)
+#define ALGEBRA_PLUGINS_HAVE_STD_SIMD
+#endif
+#endif
+
+/// Branch-free polynomial approximations of the transcendental functions
+///
+/// Other than the libm calls, these are inline and only made of arithmetic
+/// operations and selects, so that compilers can vectorize loops over them.
+/// The same implementation is used for floating point values, @c Vc::Vector
+/// and @c std::experimental::simd, through the primitive operations that are
+/// defined in @c algebra::math::vec::simd_ops for each of them.
+///
+/// @note GCC only if-converts the selects of the scalar versions, which is
+/// needed to vectorize the loops, with @c -fno-trapping-math (which is also
+/// implied by @c -ffast-math).
+///
+/// The stated accuracies were measured against the long double libm results
+/// in single and double precision.
+namespace algebra::math::vec {
+
+/// Primitive operations on the (simd) type @tparam T that the approximations
+/// are built from. Specialized here for the floating point types and for
+/// @c std::experimental::simd, and in "algebra/math/impl/vc_soa_math.hpp" for
+/// the Vc types.
+template <typename T>
+struct simd_ops;
+
+/// Primitive operations on floating point values
+///
+/// @note Bit manipulations instead of libm calls, so that they vectorize
+template <std::floating_point T>
+struct simd_ops<T> {
+
+  using value_type = T;
+  using mask_type = bool;
+
+  /// @returns @param a where @param m is set, @param b otherwise
+  ALGEBRA_HOST_DEVICE static constexpr T select(const mask_type m, const T a,
+                                                const T b) {
+    return m ? a : b;
+  }
+
+  ALGEBRA_HOST_DEVICE static constexpr T abs(const T x) {
+    return std::bit_cast<T>(std::bit_cast<uint_type>(x) & ~sign_mask);
+  }
+
+  ALGEBRA_HOST_DEVICE static constexpr T copysign(const T mag, const T sgn) {
+    return std::bit_cast<T>((std::bit_cast<uint_type>(mag) & ~sign_mask) |
+                            (std::bit_cast<uint_type>(sgn) & sign_mask));
+  }
+
+  ALGEBRA_HOST_DEVICE static constexpr T sqrt(const T x) {
+    return algebra::math::sqrt(x);
+  }
+
+  /// Round to the nearest integer, halfway cases away from zero
+  ALGEBRA_HOST_DEVICE static constexpr T round(const T x) {
+    return trunc(x + copysign(static_cast<T>(0.5), x));
+  }
+
+  /// Round downwards
+  ALGEBRA_HOST_DEVICE static constexpr T floor(const T x) {
+    const T t{trunc(x)};
+    return select(t > x, t - static_cast<T>(1), t);
+  }
+
+  /// @returns x * 2^n for an integer valued @param n, as long as the result
+  /// is a normal number
+  ALGEBRA_HOST_DEVICE static constexpr T ldexp(const T x, const T n) {
+    // Split the exponent, so that 2^n1 and 2^n2 are always normal numbers
+    const T n1{round(static_cast<T>(0.5) * n)};
+    return x * pow2(n1) * pow2(n - n1);
+  }
+
+  /// @returns the mantissa of the positive, finite @param x in [0.5, 1) and
+  /// its exponent in @param e, such that x = m * 2^e
+  ALGEBRA_HOST_DEVICE static constexpr T frexp(const T x, T &e) {
+    // Scale subnormal numbers into the normal range first
+    const bool subnormal{x < std::numeric_limits<T>::min()};
+    const T xs{select(subnormal, x * pow2(static_cast<T>(mantissa_bits)), x)};
+
+    const uint_type bits{std::bit_cast<uint_type>(xs)};
+    e = static_cast<T>(
+            static_cast<std::int32_t>((bits & exponent_mask) >> mantissa_bits) -
+            (exponent_bias - 1)) -
+        select(subnormal, static_cast<T>(mantissa_bits), static_cast<T>(0));
+
+    return std::bit_cast<T>(
+        (bits & ~exponent_mask) |
+        (static_cast<uint_type>(exponent_bias - 1) << mantissa_bits));
+  }
+
+ private:
+  using uint_type =
+      std::conditional_t<sizeof(T) == 4u, std::uint32_t, std::uint64_t>;
+  using int_type =
+      std::conditional_t<sizeof(T) == 4u, std::int32_t, std::int64_t>;
+
+  static constexpr std::int32_t mantissa_bits{
+      std::numeric_limits<T>::digits - 1};
+  static constexpr std::int32_t exponent_bias{
+      std::numeric_limits<T>::max_exponent - 1};
+  static constexpr uint_type sign_mask{uint_type{1u}
+                                       << (8u * sizeof(T) - 1u)};
+  static constexpr uint_type exponent_mask{
+      std::bit_cast<uint_type>(std::numeric_limits<T>::infinity())};
+
+  /// @returns @param x rounded towards zero
+  ///
+  /// @note Values with |x| >= 2^mantissa_bits, infinities and NaN have no
+  /// fractional part and are returned unchanged, which also keeps them out
+  /// of the conversion to an integer
+  ALGEBRA_HOST_DEVICE static constexpr T trunc(const T x) {
+    const bool fractional{abs(x) < pow2(static_cast<T>(mantissa_bits))};
+    const T t{static_cast<T>(
+        static_cast<int_type>(select(fractional, x, static_cast<T>(0))))};
+    return select(fractional, copysign(t, x), x);
+  }
+
+  /// @returns 2^n for an integer valued @param n in the normal range
+  ALGEBRA_HOST_DEVICE static constexpr T pow2(const T n) {
+    return std::bit_cast<T>(
+        static_cast<uint_type>(static_cast<std::int32_t>(n) + exponent_bias)
+        << mantissa_bits);
+  }
+};
+
+#if defined(ALGEBRA_PLUGINS_HAVE_STD_SIMD)
+/// Primitive operations on @c std::experimental::simd types
+template <std::floating_point V, typename Abi>
+struct simd_ops<std::experimental::simd<V, Abi>> {
+
+  using simd_t = std::experimental::simd<V, Abi>;
+  using value_type = V;
+  using mask_type = typename simd_t::mask_type;
+
+  static simd_t select(const mask_type &m, const simd_t &a, const simd_t &b) {
+    simd_t r{b};
+    std::experimental::where(m, r) = a;
+    return r;
+  }
+
+  static simd_t abs(const simd_t &x) { return std::experimental::abs(x); }
+
+  static simd_t copysign(const simd_t &mag, const simd_t &sgn) {
+    return std::experimental::copysign(mag, sgn);
+  }
+
+  static simd_t sqrt(const simd_t &x) { return std::experimental::sqrt(x); }
+
+  static simd_t round(const simd_t &x) { return std::experimental::round(x); }
+
+  static simd_t floor(const simd_t &x) { return std::experimental::floor(x); }
+
+  static simd_t ldexp(const simd_t &x, const simd_t &n) {
+    return std::experimental::ldexp(
+        x, std::experimental::static_simd_cast<int_simd_t>(n));
+  }
+
+  static simd_t frexp(const simd_t &x, simd_t &e) {
+    int_simd_t n{};
+    const simd_t m{std::experimental::frexp(x, &n)};
+    e = std::experimental::static_simd_cast<simd_t>(n);
+    return m;
+  }
+
+ private:
+  using int_simd_t = std::experimental::fixed_size_simd<int, simd_t::size()>;
+};
+#endif  // ALGEBRA_PLUGINS_HAVE_STD_SIMD
+
+/// Types that the approximations can be evaluated for
+template <typename T>
+concept vectorizable = requires {
+  typename simd_ops<T>::value_type;
+};
+
+namespace detail {
+
+/// ln(2) = ln2_hi + ln2_lo, where n * ln2_hi is exact for all exponents n of
+/// the value type
+/// @{
+template <typename value_t>
+inline constexpr value_t ln2_hi{
+    std::same_as<value_t, float>
+        ? static_cast<value_t>(0.693359375)
+        : static_cast<value_t>(6.93147180369123816490e-01)};
+
+template <typename value_t>
+inline constexpr value_t ln2_lo{
+    std::same_as<value_t, float>
+        ? static_cast<value_t>(-2.12194440e-4)
+        : static_cast<value_t>(1.90821492927058770002e-10)};
+/// @}
+
+/// Evaluate the polynomial with the coefficients @param c (highest order
+/// first) at @param x, using the Horner scheme
+template <typename T, typename value_t, std::size_t N>
+ALGEBRA_HOST_DEVICE constexpr T horner(const T &x,
+                                       const std::array<value_t, N> &c) {
+  T r{c[0]};
+  for (std::size_t i = 1u; i < N; ++i) {
+    r = r * x + T{c[i]};
+  }
+  return r;
+}
+
+/// @returns atan(x) for @param x >= 0
+template <typename T>
+ALGEBRA_HOST_DEVICE constexpr T atan_positive(const T &x) {
+
+  using ops = simd_ops<T>;
+  using value_t = typename ops::value_type;
+
+  constexpr value_t pi_2{std::numbers::pi_v<value_t> / 2};
+  constexpr value_t pi_4{std::numbers::pi_v<value_t> / 4};
+  // tan(3pi/8)
+  constexpr value_t tan_3pi_8{static_cast<value_t>(2.41421356237309504880)};
+
+  const T one{static_cast<value_t>(1)};
+  const T zero{static_cast<value_t>(0)};
+
+  if constexpr (std::same_as<value_t, float>) {
+    // Cephes atanf: Reduce to |t| <= tan(pi/8) and evaluate a minimax
+    // polynomial
+    constexpr std::array<value_t, 4> c{8.05374449538e-2f, -1.38776856032e-1f,
+                                       1.99777106478e-1f, -3.33329491539e-1f};
+    constexpr value_t tan_pi_8{0.4142135623730950f};
+
+    const auto big = x > T{tan_3pi_8};
+    const auto mid = x > T{tan_pi_8};
+
+    const T t{ops::select(big, -one, ops::select(mid, x - one, x)) /
+              ops::select(big, x, ops::select(mid, x + one, one))};
+    const T y0{ops::select(big, T{pi_2}, ops::select(mid, T{pi_4}, zero))};
+
+    const T z{t * t};
+    return y0 + (horner(z, c) * z * t + t);
+  } else {
+    // Cephes atan: Reduce to |t| <= 0.66 and evaluate a rational function
+    constexpr std::array<value_t, 5> p{
+        -8.750608600031904122785e-01, -1.615753718733365076637e+01,
+        -7.500855792314704667340e+01, -1.228866684490136173410e+02,
+        -6.485021904942025371773e+01};
+    constexpr std::array<value_t, 6> q{
+        1.,
+        2.485846490142306297962e+01,
+        1.650270098316988542046e+02,
+        4.328810604912902668951e+02,
+        4.853903996359136964868e+02,
+        1.945506571482613964425e+02};
+    // pi/2 = pi_2 + more_bits
+    constexpr value_t more_bits{6.123233995736765886130e-17};
+
+    const auto big = x > T{tan_3pi_8};
+    const auto mid = x > T{static_cast<value_t>(0.66)};
+
+    const T t{ops::select(big, -one, ops::select(mid, x - one, x)) /
+              ops::select(big, x, ops::select(mid, x + one, one))};
+    const T y0{ops::select(big, T{pi_2}, ops::select(mid, T{pi_4}, zero))};
+    const T corr{ops::select(
+        big, T{more_bits},
+        ops::select(mid, T{static_cast<value_t>(0.5) * more_bits}, zero))};
+
+    const T z{t * t};
+    return y0 + ((z * horner(z, p) / horner(z, q)) * t + t + corr);
+  }
+}
+
+}  // namespace detail
+
+/// @returns e^x
+///
+/// @note Within 1.5 ulp; returns 0 below the subnormal range
+template <vectorizable T>
+ALGEBRA_HOST_DEVICE constexpr T exp(const T &x) {
+
+  using ops = simd_ops<T>;
+  using value_t = typename ops::value_type;
+
+  // Taylor polynomials on |r| <= ln(2)/2
+  constexpr auto c = []() {
+    if constexpr (std::same_as<value_t, float>) {
+      return std::array<value_t, 8>{1.f / 5040.f, 1.f / 720.f, 1.f / 120.f,
+                                    1.f / 24.f,   1.f / 6.f,   1.f / 2.f,
+                                    1.f,          1.f};
+    } else {
+      std::array<value_t, 15> coeffs{};
+      value_t fact{1.};
+      for (std::size_t k = 0u; k < coeffs.size(); ++k) {
+        fact *= (k == 0u) ? 1. : static_cast<value_t>(k);
+        coeffs[coeffs.size() - 1u - k] = 1. / fact;
+      }
+      return coeffs;
+    }
+  }();
+
+  // Largest and smallest arguments with a finite, non-zero result
+  constexpr value_t max_arg{std::same_as<value_t, float>
+                                ? static_cast<value_t>(88.72283905206835)
+                                : static_cast<value_t>(709.782712893384)};
+  constexpr value_t min_arg{std::same_as<value_t, float>
+                                ? static_cast<value_t>(-103.972077083991796)
+                                : static_cast<value_t>(-745.1332191019411)};
+
+  const T xc{ops::select(x > T{max_arg}, T{max_arg},
+                         ops::select(x < T{min_arg}, T{min_arg}, x))};
+
+  // x = n * ln(2) + r
+  const T n{ops::round(xc * T{std::numbers::log2e_v<value_t>})};
+  const T r{(xc - n * T{detail::ln2_hi<value_t>}) -
+            n * T{detail::ln2_lo<value_t>}};
+
+  T res{ops::ldexp(detail::horner(r, c), n)};
+  res = ops::select(x > T{max_arg},
+                    T{std::numeric_limits<value_t>::infinity()}, res);
+  res = ops::select(x < T{min_arg}, T{static_cast<value_t>(0)}, res);
+  // Propagate NaN
+  return ops::select(x != x, x, res);
+}
+
+/// @returns the natural logarithm of @param x
+///
+/// @note Within 2 ulp
+template <vectorizable T>
+ALGEBRA_HOST_DEVICE constexpr T log(const T &x) {
+
+  using ops = simd_ops<T>;
+  using value_t = typename ops::value_type;
+
+  // Taylor coefficients of 2 * atanh(s) / s - 2 in s^2
+  constexpr auto c = []() {
+    constexpr std::size_t n_coeffs{std::same_as<value_t, float> ? 4u : 9u};
+    std::array<value_t, n_coeffs> coeffs{};
+    for (std::size_t k = 0u; k < n_coeffs; ++k) {
+      coeffs[n_coeffs - 1u - k] =
+          static_cast<value_t>(2.) / static_cast<value_t>(2u * k + 3u);
+    }
+    return coeffs;
+  }();
+
+  const T one{static_cast<value_t>(1)};
+
+  // x = m * 2^e, with m in [sqrt(0.5), sqrt(2))
+  T e{};
+  T m{ops::frexp(x, e)};
+  const auto small = m < T{std::numbers::sqrt2_v<value_t> / 2};
+  m = ops::select(small, m + m, m);
+  e = ops::select(small, e - one, e);
+
+  // log(m) = 2 * atanh(s), with |s| <= 0.172
+  const T s{(m - one) / (m + one)};
+  const T z{s * s};
+  const T log_m{T{static_cast<value_t>(2)} * s + s * z * detail::horner(z, c)};
+
+  T res{e * T{detail::ln2_hi<value_t>} +
+        (log_m + e * T{detail::ln2_lo<value_t>})};
+  res = ops::select(x == T{std::numeric_limits<value_t>::infinity()}, x, res);
+  res = ops::select(x == T{static_cast<value_t>(0)},
+                    T{-std::numeric_limits<value_t>::infinity()}, res);
+  // Negative arguments and NaN
+  return ops::select((x < T{static_cast<value_t>(0)}) | (x != x),
+                     T{std::numeric_limits<value_t>::quiet_NaN()}, res);
+}
+
+/// @returns atan2(y, x) in [-pi, pi]
+///
+/// @note Within 3 ulp for finite arguments; atan2(+-0, -0) returns +-0
+/// instead of +-pi
+template <vectorizable T>
+ALGEBRA_HOST_DEVICE constexpr T atan2(const T &y, const T &x) {
+
+  using ops = simd_ops<T>;
+  using value_t = typename ops::value_type;
+
+  const T zero{static_cast<value_t>(0)};
+
+  const T t{y / x};
+  T res{ops::copysign(detail::atan_positive(ops::abs(t)), t)};
+  res = ops::select((x == zero) & (y == zero), ops::copysign(zero, y), res);
+
+  // Quadrants II and III
+  return res + ops::select(x < zero,
+                           ops::copysign(T{std::numbers::pi_v<value_t>}, y),
+                           zero);
+}
+
+/// @returns acos(x) in [0, pi] for @param x in [-1, 1]
+///
+/// @note Within 4 ulp
+template <vectorizable T>
+ALGEBRA_HOST_DEVICE constexpr T acos(const T &x) {
+
+  using ops = simd_ops<T>;
+  using value_t = typename ops::value_type;
+
+  const T one{static_cast<value_t>(1)};
+
+  // Other than pi/2 - asin(x), this stays accurate for x close to 1
+  return vec::atan2(ops::sqrt((one - x) * (one + x)), x);
+}
+
+/// @returns atanh(x) for @param x in [-1, 1]
+///
+/// @note Within 5 ulp
+template <vectorizable T>
+ALGEBRA_HOST_DEVICE constexpr T atanh(const T &x) {
+
+  using ops = simd_ops<T>;
+  using value_t = typename ops::value_type;
+
+  const T one{static_cast<value_t>(1)};
+
+  // atanh(|x|) = 0.5 * log1p(2|x| / (1 - |x|))
+  const T a{ops::abs(x)};
+  const T u{T{static_cast<value_t>(2)} * a / (one - a)};
+
+  // log1p(u) from log(1 + u), corrected for the rounding error in 1 + u
+  // (D. Goldberg, "What Every Computer Scientist Should Know About
+  // Floating-Point Arithmetic", Theorem 4)
+  const T w{one + u};
+  T log1p_u{vec::log(w) * (u / (w - one))};
+  log1p_u = ops::select(w == one, u, log1p_u);
+  // atanh(1) = inf
+  log1p_u = ops::select(
+      w == T{std::numeric_limits<value_t>::infinity()}, w, log1p_u);
+
+  return ops::copysign(T{static_cast<value_t>(0.5)} * log1p_u, x);
+}
+
+/// @returns the sine and cosine of @param x
+///
+/// @note Within 2 ulp for |x| < pi. The absolute error stays below the
+/// machine epsilon for |x| < 8192 in single and |x| < 2^29 in double
+/// precision. The argument reduction breaks down beyond |x| = 2^17 in single
+/// and |x| = 2^31 in double precision, where NaN is returned instead
+template <vectorizable T>
+ALGEBRA_HOST_DEVICE constexpr std::pair<T, T> sincos(const T &x) {
+
+  using ops = simd_ops<T>;
+  using value_t = typename ops::value_type;
+
+  // Cephes sin/cos minimax polynomials on |r| <= pi/4
+  constexpr auto sin_c = []() {
+    if constexpr (std::same_as<value_t, float>) {
+      return std::array<value_t, 3>{-1.9515295891e-4f, 8.3321608736e-3f,
+                                    -1.6666654611e-1f};
+    } else {
+      return std::array<value_t, 6>{
+          1.58962301576546568060e-10, -2.50507477628578072866e-8,
+          2.75573136213857245213e-6,  -1.98412698295895385996e-4,
+          8.33333333332211858878e-3,  -1.66666666666666307295e-1};
+    }
+  }();
+  constexpr auto cos_c = []() {
+    if constexpr (std::same_as<value_t, float>) {
+      return std::array<value_t, 3>{2.443315711809948e-5f,
+                                    -1.388731625493765e-3f,
+                                    4.166664568298827e-2f};
+    } else {
+      return std::array<value_t, 6>{
+          -1.13585365213876817300e-11, 2.08757008419747316778e-9,
+          -2.75573141792967388112e-7,  2.48015872888517045348e-5,
+          -1.38888888888730564116e-3,  4.16666666666665929218e-2};
+    }
+  }();
+
+  // pi/2 = pio2_1 + pio2_2 + pio2_3, where n * pio2_1 and n * pio2_2 are
+  // exact in the valid range
+  constexpr std::array<value_t, 3> pio2 = []() {
+    if constexpr (std::same_as<value_t, float>) {
+      return std::array<value_t, 3>{1.5703125f, 4.837512969970703125e-4f,
+                                    7.54978995489188216e-8f};
+    } else {
+      return std::array<value_t, 3>{1.57079625129699707031e+00,
+                                    7.54978941586159635336e-08,
+                                    5.39030285815811905290e-15};
+    }
+  }();
+
+  // Largest argument that the reduction is accurate for
+  constexpr value_t max_arg{std::same_as<value_t, float> ? 131072.f
+                                                         : 2147483648.};
+
+  const T one{static_cast<value_t>(1)};
+  const T half{static_cast<value_t>(0.5)};
+
+  // Also false for infinite and NaN arguments
+  const auto valid = ops::abs(x) < T{max_arg};
+  const T xv{ops::select(valid, x, T{static_cast<value_t>(0)})};
+
+  // x = n * pi/2 + r
+  const T n{ops::round(xv * T{std::numbers::inv_pi_v<value_t> * 2})};
+  const T r{((xv - n * T{pio2[0]}) - n * T{pio2[1]}) - n * T{pio2[2]}};
+
+  const T z{r * r};
+  const T s{r + r * z * detail::horner(z, sin_c)};
+  const T c{(z * z * detail::horner(z, cos_c) - half * z) + one};
+
+  // Quadrant: n mod 4
+  const T q{n - T{static_cast<value_t>(4)} *
+                    ops::floor(T{static_cast<value_t>(0.25)} * n)};
+  const T two{static_cast<value_t>(2)};
+
+  const auto odd = (q == one) | (q == T{static_cast<value_t>(3)});
+  T sin_x{ops::select(odd, c, s)};
+  T cos_x{ops::select(odd, s, c)};
+  sin_x = ops::select(q >= two, -sin_x, sin_x);
+  cos_x = ops::select((q == one) | (q == two), -cos_x, cos_x);
+
+  const T nan{std::numeric_limits<value_t>::quiet_NaN()};
+  return {ops::select(valid, sin_x, nan), ops::select(valid, cos_x, nan)};
+}
+
+/// @returns the sine of @param x (see @c sincos)
+template <vectorizable T>
+ALGEBRA_HOST_DEVICE constexpr T sin(const T &x) {
+  return vec::sincos(x).first;
+}
+
+/// @returns the cosine of @param x (see @c sincos)
+template <vectorizable T>
+ALGEBRA_HOST_DEVICE constexpr T cos(const T &x) {
+  return vec::sincos(x).second;
+}
+
+}  // namespace algebra::math::vec
+
+#if defined(ALGEBRA_PLUGINS_HAVE_STD_SIMD)
+namespace algebra::math {
+
+/// @returns the sine and cosine of @param x
+///
+/// @note There is no @c sincos in @c std::experimental: Use the polynomial
+/// approximation, which evaluates both for the cost of one of the library
+/// functions
+template <typename T, typename Abi>
+inline std::pair<std::experimental::simd<T, Abi>,
+                 std::experimental::simd<T, Abi>>
+sincos(const std::experimental::simd<T, Abi> &x) {
+  return algebra::math::vec::sincos(x);
+}
+
+}  // namespace algebra::math
+#endif  // ALGEBRA_PLUGINS_HAVE_STD_SIMD
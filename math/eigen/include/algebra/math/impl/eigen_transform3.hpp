@@ -8,6 +8,7 @@
 #pragma once
 
 // Project include(s).
+#include "algebra/math/rotation.hpp"
 #include "algebra/qualifiers.hpp"
 #include "algebra/storage/impl/eigen_array.hpp"
 #include "algebra/utils/approximately_equal.hpp"
@@ -176,6 +177,47 @@ struct transform3 {
   transform3(const transform3 &rhs) = default;
   ~transform3() = default;
 
+  /// Rotation by @param angle around the unit vector @param axis
+  ///
+  /// @note the inverse is the transposed rotation, no inversion is needed
+  ALGEBRA_HOST_DEVICE
+  static transform3 rotation_from_axis_angle(const vector3 &axis,
+                                             const scalar_type angle) {
+    return from_rotation(algebra::math::rotation_from_axis_angle(
+        axis[0], axis[1], axis[2], angle));
+  }
+
+  /// Rotation R_z(@param gamma) * R_y(@param beta) * R_x(@param alpha)
+  ///
+  /// @note the inverse is the transposed rotation, no inversion is needed
+  ALGEBRA_HOST_DEVICE
+  static transform3 rotation_from_euler(const scalar_type alpha,
+                                        const scalar_type beta,
+                                        const scalar_type gamma) {
+    return from_rotation(
+        algebra::math::rotation_from_euler(alpha, beta, gamma));
+  }
+
+  /// Apply an alignment correction: Rotate the frame around its origin by
+  /// the rotation vector @param domega and shift it by @param dt (both in
+  /// global coordinates)
+  ///
+  /// The inverse is updated with the transposed correction, instead of being
+  /// recomputed: (dR * R)^-1 = R^-1 * dR^T
+  ALGEBRA_HOST_DEVICE
+  void apply_delta(const vector3 &dt, const vector3 &domega) {
+
+    const rotation_matrix dr = to_matrix(
+        algebra::math::rotation_from_rotation_vector(domega[0], domega[1],
+                                                     domega[2]));
+
+    _data.linear() = dr * _data.linear();
+    _data.translation() += dt;
+
+    _data_inv.linear() = _data_inv.linear() * dr.transpose();
+    _data_inv.translation() = -_data_inv.linear() * _data.translation();
+  }
+
   /// Equality operator
   ALGEBRA_HOST_DEVICE
   constexpr bool operator==(const transform3 &rhs) const {
@@ -279,6 +321,36 @@ struct transform3 {
           const Eigen::MatrixBase<derived_type> &v) const {
     return (_data_inv.linear() * v);
   }
+
+ private:
+  /// 3x3 rotation matrix type
+  using rotation_matrix = Eigen::Matrix<scalar_type, 3, 3>;
+
+  /// @returns the rotation matrix with the columns @param r
+  ALGEBRA_HOST_DEVICE
+  static rotation_matrix to_matrix(
+      const algebra::math::rotation3<scalar_type> &r) {
+    rotation_matrix m;
+    for (int j = 0; j < 3; ++j) {
+      for (int i = 0; i < 3; ++i) {
+        m(i, j) = r[j][i];
+      }
+    }
+    return m;
+  }
+
+  /// @returns the transform for the rotation matrix with the columns @param r
+  ALGEBRA_HOST_DEVICE
+  static transform3 from_rotation(
+      const algebra::math::rotation3<scalar_type> &r) {
+    const rotation_matrix m = to_matrix(r);
+
+    transform3 trf{};
+    trf._data.linear() = m;
+    trf._data_inv.linear() = m.transpose();
+
+    return trf;
+  }
 };  // struct transform3
 
 }  // namespace algebra::eigen::math
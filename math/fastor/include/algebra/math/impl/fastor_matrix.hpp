@@ -87,4 +87,82 @@ ALGEBRA_HOST_DEVICE constexpr matrix_type<scalar_t, COLS, ROWS> inverse(
   return Fastor::inverse(m);
 }
 
+/// @returns the transpose of the diagonal matrix @param m (itself)
+template <typename matrix_t>
+ALGEBRA_HOST_DEVICE constexpr algebra::storage::diagonal_matrix<matrix_t>
+transpose(const algebra::storage::diagonal_matrix<matrix_t> &m) {
+  return m;
+}
+
+/// @returns the determinant of the diagonal matrix @param m
+template <typename matrix_t>
+ALGEBRA_HOST_DEVICE constexpr algebra::traits::scalar_t<matrix_t> determinant(
+    const algebra::storage::diagonal_matrix<matrix_t> &m) {
+  return algebra::storage::determinant(m);
+}
+
+/// @returns the inverse of the diagonal matrix @param m
+template <typename matrix_t>
+ALGEBRA_HOST_DEVICE constexpr algebra::storage::diagonal_matrix<matrix_t>
+inverse(const algebra::storage::diagonal_matrix<matrix_t> &m) {
+  return algebra::storage::inverse(m);
+}
+
+/// @returns the transpose of the projection matrix @param m
+template <typename matrix_t, bool TRANSPOSED>
+ALGEBRA_HOST_DEVICE constexpr auto transpose(
+    const algebra::storage::projection_matrix<matrix_t, TRANSPOSED> &m) {
+  return algebra::storage::transpose(m);
+}
+
+/// @returns the transpose of the triangular matrix @param m
+template <typename matrix_t, bool UPPER>
+ALGEBRA_HOST_DEVICE constexpr algebra::storage::triangular_matrix<matrix_t,
+                                                                  !UPPER>
+transpose(const algebra::storage::triangular_matrix<matrix_t, UPPER> &m) {
+  return algebra::storage::transpose(m);
+}
+
+/// @returns the determinant of the triangular matrix @param m
+template <typename matrix_t, bool UPPER>
+ALGEBRA_HOST_DEVICE constexpr algebra::traits::scalar_t<matrix_t> determinant(
+    const algebra::storage::triangular_matrix<matrix_t, UPPER> &m) {
+  return algebra::storage::determinant(m);
+}
+
+/// @returns the inverse of the triangular matrix @param m
+template <typename matrix_t, bool UPPER>
+ALGEBRA_HOST_DEVICE constexpr algebra::storage::triangular_matrix<matrix_t,
+                                                                  UPPER>
+inverse(const algebra::storage::triangular_matrix<matrix_t, UPPER> &m) {
+  return algebra::storage::inverse(m);
+}
+
+/// @returns the transpose of the block diagonal matrix @param m
+template <typename... block_ts>
+ALGEBRA_HOST_DEVICE constexpr algebra::storage::block_diagonal_matrix<
+    block_ts...>
+transpose(const algebra::storage::block_diagonal_matrix<block_ts...> &m) {
+  return algebra::storage::transpose(m);
+}
+
+/// @returns the determinant of the block diagonal matrix @param m, i.e. the
+/// product of the determinants of its blocks
+template <typename... block_ts>
+ALGEBRA_HOST_DEVICE constexpr auto determinant(
+    const algebra::storage::block_diagonal_matrix<block_ts...> &m) {
+  return algebra::storage::detail::blockwise_product(
+      m, [](const auto &b) { return determinant(b); });
+}
+
+/// @returns the inverse of the block diagonal matrix @param m, which is
+/// computed block by block
+template <typename... block_ts>
+ALGEBRA_HOST_DEVICE constexpr algebra::storage::block_diagonal_matrix<
+    block_ts...>
+inverse(const algebra::storage::block_diagonal_matrix<block_ts...> &m) {
+  return algebra::storage::detail::blockwise(
+      m, [](const auto &b) { return inverse(b); });
+}
+
 }  // namespace algebra::fastor::math
@@ -0,0 +1,132 @@
+/** Algebra plugins library, part of the ACTS project
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "algebra/concepts.hpp"
+#include "algebra/math/common.hpp"
+#include "algebra/qualifiers.hpp"
+#include "algebra/type_traits.hpp"
+
+namespace algebra::generic::matrix::decomposition {
+
+/// "Cholesky Decomposition" A = L * L^T of a symmetric positive definite
+/// N X N matrix
+///
+/// Only the lower triangle of the input matrix is read. The factor L is
+/// returned in the lower triangle of a dense matrix, with zeros above the
+/// diagonal.
+template <concepts::square_matrix matrix_t, class element_getter_t>
+struct cholesky {
+
+  using scalar_type = algebra::traits::value_t<matrix_t>;
+  using size_type = algebra::traits::index_t<matrix_t>;
+
+  /// Matrix type that owns its elements (differs from @c matrix_t for views)
+  using matrix_type = algebra::traits::matrix_t<matrix_t>;
+
+  /// Function (object) used for accessing a matrix element
+  using element_getter = element_getter_t;
+
+  ALGEBRA_HOST_DEVICE constexpr matrix_type operator()(
+      const matrix_t& m) const {
+
+    constexpr size_type N{algebra::traits::rank<matrix_t>};
+
+    matrix_type L;
+
+    for (size_type j = 0; j < N; j++) {
+
+      // L[j][j] = sqrt(m[j][j] - sum_k L[j][k]^2)
+      scalar_type d = element_getter_t()(m, j, j);
+      for (size_type k = 0; k < j; k++) {
+        d -= element_getter_t()(L, j, k) * element_getter_t()(L, j, k);
+      }
+      const scalar_type l_jj = algebra::math::sqrt(d);
+      element_getter_t()(L, j, j) = l_jj;
+
+      // L[i][j] = (m[i][j] - sum_k L[i][k] * L[j][k]) / L[j][j]
+      for (size_type i = j + 1; i < N; i++) {
+        scalar_type s = element_getter_t()(m, i, j);
+        for (size_type k = 0; k < j; k++) {
+          s -= element_getter_t()(L, i, k) * element_getter_t()(L, j, k);
+        }
+        element_getter_t()(L, i, j) = s / l_jj;
+      }
+
+      for (size_type i = 0; i < j; i++) {
+        element_getter_t()(L, i, j) = static_cast<scalar_type>(0.0);
+      }
+    }
+
+    return L;
+  }
+};
+
+namespace detail {
+
+/// Rank-1 modification of a Cholesky factor L to the factor of
+/// L * L^T + v * v^T (or L * L^T - v * v^T for @tparam DOWNDATE) in O(N^2),
+/// using a sequence of (hyperbolic) Givens rotations
+template <concepts::square_matrix matrix_t, class element_getter_t,
+          bool DOWNDATE>
+struct cholesky_rank_one {
+
+  using scalar_type = algebra::traits::value_t<matrix_t>;
+  using size_type = algebra::traits::index_t<matrix_t>;
+  using vector_type = algebra::traits::vector_t<matrix_t>;
+
+  /// Matrix type that owns its elements (differs from @c matrix_t for views)
+  using matrix_type = algebra::traits::matrix_t<matrix_t>;
+
+  /// Function (object) used for accessing a matrix element
+  using element_getter = element_getter_t;
+
+  /// Update the factor @param L in place with the vector @param v
+  ALGEBRA_HOST_DEVICE constexpr void operator()(matrix_type& L,
+                                                vector_type v) const {
+
+    constexpr size_type N{algebra::traits::rank<matrix_t>};
+    const scalar_type sign{static_cast<scalar_type>(DOWNDATE ? -1.0 : 1.0)};
+
+    for (size_type k = 0; k < N; k++) {
+      const scalar_type l_kk = element_getter_t()(L, k, k);
+      const scalar_type r =
+          algebra::math::sqrt(l_kk * l_kk + sign * v[k] * v[k]);
+      const scalar_type c = r / l_kk;
+      const scalar_type s = v[k] / l_kk;
+
+      element_getter_t()(L, k, k) = r;
+
+      for (size_type i = k + 1; i < N; i++) {
+        // L[i][k] = (L[i][k] + sign * s * v[i]) / c
+        element_getter_t()(L, i, k) += sign * s * v[i];
+        element_getter_t()(L, i, k) /= c;
+
+        v[i] = c * v[i] - s * element_getter_t()(L, i, k);
+      }
+    }
+  }
+};
+
+}  // namespace detail
+
+/// Rank-1 update of the Cholesky factor L of A to the factor of A + v * v^T
+template <concepts::square_matrix matrix_t, class element_getter_t>
+using cholesky_update =
+    detail::cholesky_rank_one<matrix_t, element_getter_t, false>;
+
+/// Rank-1 downdate of the Cholesky factor L of A to the factor of A - v * v^T
+///
+/// @note A - v * v^T has to be positive definite, otherwise the result
+/// contains NaNs
+template <concepts::square_matrix matrix_t, class element_getter_t>
+using cholesky_downdate =
+    detail::cholesky_rank_one<matrix_t, element_getter_t, true>;
+
+}  // namespace algebra::generic::matrix::decomposition
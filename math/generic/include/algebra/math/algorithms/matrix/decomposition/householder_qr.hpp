@@ -0,0 +1,208 @@
+/** Algebra plugins library, part of the ACTS project
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "algebra/concepts.hpp"
+#include "algebra/math/vec.hpp"
+#include "algebra/qualifiers.hpp"
+#include "algebra/storage/triangular_matrix.hpp"
+#include "algebra/type_traits.hpp"
+
+// System include(s).
+#include <array>
+
+namespace algebra::generic::matrix::decomposition {
+
+/// "Householder QR Decomposition" A = Q * R of a M X N matrix with M >= N
+///
+/// The reflections are computed without branches on the matrix elements: The
+/// signs are chosen with selects.
+template <concepts::matrix matrix_t, class element_getter_t>
+requires(algebra::traits::rows<matrix_t> >=
+         algebra::traits::columns<matrix_t>) struct householder_qr {
+
+  using scalar_type = algebra::traits::scalar_t<matrix_t>;
+  using value_type = algebra::traits::value_t<matrix_t>;
+  using size_type = algebra::traits::index_t<matrix_t>;
+
+  /// Matrix type that owns its elements (differs from @c matrix_t for views)
+  using matrix_type = algebra::traits::matrix_t<matrix_t>;
+
+  /// Function (object) used for accessing a matrix element
+  using element_getter = element_getter_t;
+
+  static constexpr size_type M{algebra::traits::rows<matrix_t>};
+  static constexpr size_type N{algebra::traits::columns<matrix_t>};
+
+  /// Vector types of the right hand side and of the solution
+  using rhs_vector_type =
+      algebra::traits::get_vector_t<matrix_type, M, value_type>;
+  using vector_type = algebra::traits::get_vector_t<matrix_type, N, value_type>;
+
+  /// Function (object) used for accessing a vector element
+  using vector_getter = algebra::traits::element_getter_t<rhs_vector_type>;
+
+  /// Type of the thin Q (equal to the full Q for square matrices)
+  using q_matrix_type = matrix_type;
+
+  /// Type of the triangular factor R
+  using r_matrix_type = algebra::storage::upper_triangular<
+      algebra::traits::get_matrix_t<matrix_type, N, N, value_type>>;
+
+  /// Compact QR decomposition (as in LAPACK)
+  struct qrd {
+    // R in the upper triangle, the Householder vectors v_k below the
+    // diagonal (normalized to v_k[k] = 1, which is not stored)
+    matrix_type qr;
+
+    // Scaling factors of the reflections H_k = I - tau_k * v_k * v_k^T
+    std::array<scalar_type, N> tau;
+  };
+
+  ALGEBRA_HOST_DEVICE constexpr qrd operator()(const matrix_t& m) const {
+
+    using ops = algebra::math::vec::simd_ops<scalar_type>;
+
+    const scalar_type zero{static_cast<value_type>(0.0)};
+    const scalar_type one{static_cast<value_type>(1.0)};
+    const scalar_type two{static_cast<value_type>(2.0)};
+
+    qrd res{m, {}};
+    matrix_type& a = res.qr;
+
+    for (size_type k = 0; k < N; k++) {
+
+      // Norm of the column below the diagonal
+      scalar_type sigma{zero};
+      for (size_type i = k + 1; i < M; i++) {
+        sigma += element_getter_t()(a, i, k) * element_getter_t()(a, i, k);
+      }
+
+      // Reflect the column onto -sign(a_kk) * |a_k| e_k, which avoids the
+      // cancellation in v_k[k] = a_kk - alpha
+      const scalar_type a_kk = element_getter_t()(a, k, k);
+      const scalar_type alpha =
+          -ops::copysign(ops::sqrt(a_kk * a_kk + sigma), a_kk);
+      const scalar_type v_k = a_kk - alpha;
+      const scalar_type vtv = v_k * v_k + sigma;
+
+      // A zero column needs no reflection
+      const auto nonzero = vtv > zero;
+      const scalar_type inv_v_k = ops::select(nonzero, one / v_k, zero);
+      res.tau[k] = ops::select(nonzero, two * v_k * v_k / vtv, zero);
+
+      element_getter_t()(a, k, k) = ops::select(nonzero, alpha, a_kk);
+      for (size_type i = k + 1; i < M; i++) {
+        element_getter_t()(a, i, k) *= inv_v_k;
+      }
+
+      // Apply the reflection to the remaining columns
+      for (size_type j = k + 1; j < N; j++) {
+        scalar_type w = element_getter_t()(a, k, j);
+        for (size_type i = k + 1; i < M; i++) {
+          w += element_getter_t()(a, i, k) * element_getter_t()(a, i, j);
+        }
+        w *= res.tau[k];
+
+        element_getter_t()(a, k, j) -= w;
+        for (size_type i = k + 1; i < M; i++) {
+          element_getter_t()(a, i, j) -= element_getter_t()(a, i, k) * w;
+        }
+      }
+    }
+
+    return res;
+  }
+
+  /// @returns Q^T * b for the decomposition @param d
+  ALGEBRA_HOST_DEVICE static constexpr rhs_vector_type apply_qt(
+      const qrd& d, rhs_vector_type b) {
+
+    for (size_type k = 0; k < N; k++) {
+      scalar_type w = vector_getter()(b, k);
+      for (size_type i = k + 1; i < M; i++) {
+        w += element_getter_t()(d.qr, i, k) * vector_getter()(b, i);
+      }
+      w *= d.tau[k];
+
+      vector_getter()(b, k) -= w;
+      for (size_type i = k + 1; i < M; i++) {
+        vector_getter()(b, i) -= element_getter_t()(d.qr, i, k) * w;
+      }
+    }
+
+    return b;
+  }
+
+  /// @returns the first N columns of Q for the decomposition @param d
+  ALGEBRA_HOST_DEVICE static constexpr q_matrix_type thin_q(const qrd& d) {
+
+    const scalar_type zero{static_cast<value_type>(0.0)};
+    const scalar_type one{static_cast<value_type>(1.0)};
+
+    q_matrix_type q;
+    for (size_type j = 0; j < N; j++) {
+      for (size_type i = 0; i < M; i++) {
+        element_getter_t()(q, i, j) = (i == j) ? one : zero;
+      }
+    }
+
+    // Q = H_0 * ... * H_{N-1} * I, starting with the last reflection
+    for (size_type l = 0; l < N; l++) {
+      const size_type k{N - 1 - l};
+
+      for (size_type j = k; j < N; j++) {
+        scalar_type w = element_getter_t()(q, k, j);
+        for (size_type i = k + 1; i < M; i++) {
+          w += element_getter_t()(d.qr, i, k) * element_getter_t()(q, i, j);
+        }
+        w *= d.tau[k];
+
+        element_getter_t()(q, k, j) -= w;
+        for (size_type i = k + 1; i < M; i++) {
+          element_getter_t()(q, i, j) -= element_getter_t()(d.qr, i, k) * w;
+        }
+      }
+    }
+
+    return q;
+  }
+
+  /// @returns the triangular factor R of the decomposition @param d
+  ALGEBRA_HOST_DEVICE static constexpr r_matrix_type r(const qrd& d) {
+
+    r_matrix_type r_mat;
+    for (size_type j = 0; j < N; j++) {
+      for (size_type i = 0; i <= j; i++) {
+        r_mat.element(i, j) = element_getter_t()(d.qr, i, j);
+      }
+    }
+
+    return r_mat;
+  }
+
+  /// @returns the solution x of the least squares problem min |A * x - b|
+  /// for the decomposition @param d of A and the right hand side @param b
+  ALGEBRA_HOST_DEVICE static constexpr vector_type solve(
+      const qrd& d, const rhs_vector_type& b) {
+
+    const rhs_vector_type qtb = apply_qt(d, b);
+
+    vector_type y;
+    for (size_type i = 0; i < N; i++) {
+      algebra::traits::element_getter_t<vector_type>()(y, i) =
+          vector_getter()(qtb, i);
+    }
+
+    // R * x = (Q^T * b)[0:N]
+    return algebra::storage::solve_upper(r(d), y);
+  }
+};
+
+}  // namespace algebra::generic::matrix::decomposition
@@ -0,0 +1,284 @@
+/** Algebra plugins library, part of the ACTS project
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "algebra/concepts.hpp"
+#include "algebra/math/vec.hpp"
+#include "algebra/qualifiers.hpp"
+#include "algebra/type_traits.hpp"
+
+// System include(s).
+#include <array>
+#include <limits>
+
+namespace algebra::generic::matrix::decomposition {
+
+/// "One-sided Jacobi Singular Value Decomposition" A = U * diag(sigma) * V^T
+/// of a M X N matrix with M >= N and N <= 8
+///
+/// Plane rotations are applied to the columns of A until they are mutually
+/// orthogonal (Hestenes' method), which gives A * V = U * diag(sigma), with
+/// the singular values being the norms of the columns. The number of sweeps
+/// is fixed, the loops are unrolled and the rotations are computed without
+/// branches on the matrix elements.
+///
+/// The singular values are sorted in decreasing order. The columns of U that
+/// belong to vanishing singular values are set to zero.
+template <concepts::matrix matrix_t, class element_getter_t>
+requires(algebra::traits::rows<matrix_t> >=
+             algebra::traits::columns<matrix_t> &&
+         algebra::traits::columns<matrix_t> <= 8) struct jacobi_svd {
+
+  using scalar_type = algebra::traits::scalar_t<matrix_t>;
+  using value_type = algebra::traits::value_t<matrix_t>;
+  using size_type = algebra::traits::index_t<matrix_t>;
+
+  /// Matrix type that owns its elements (differs from @c matrix_t for views)
+  using matrix_type = algebra::traits::matrix_t<matrix_t>;
+
+  /// Function (object) used for accessing a matrix element
+  using element_getter = element_getter_t;
+
+  static constexpr size_type M{algebra::traits::rows<matrix_t>};
+  static constexpr size_type N{algebra::traits::columns<matrix_t>};
+
+  /// Vector type of the singular values
+  using vector_type = algebra::traits::get_vector_t<matrix_type, N, value_type>;
+
+  /// Function (object) used for accessing a vector element
+  using vector_getter = algebra::traits::element_getter_t<vector_type>;
+
+  /// Types of the (thin) left and of the right singular vectors
+  using u_matrix_type = matrix_type;
+  using v_matrix_type =
+      algebra::traits::get_matrix_t<matrix_type, N, N, value_type>;
+
+  /// Type of the pseudo-inverse
+  using pinv_matrix_type =
+      algebra::traits::get_matrix_t<matrix_type, N, M, value_type>;
+
+  /// Number of Jacobi sweeps: A single rotation orthogonalizes two columns.
+  /// Beyond that the convergence is quadratic, with the number of sweeps
+  /// needed to reach the rounding errors growing slowly with N
+  static constexpr size_type n_sweeps{N <= 2 ? N - 1 : (N < 8 ? N + 1 : 8)};
+
+  /// Singular values and vectors
+  struct svd {
+    vector_type sigma;
+    u_matrix_type u;
+    v_matrix_type v;
+  };
+
+  ALGEBRA_HOST_DEVICE constexpr svd operator()(const matrix_t& m) const {
+
+    using ops = algebra::math::vec::simd_ops<scalar_type>;
+
+    const scalar_type zero{static_cast<value_type>(0.0)};
+    const scalar_type one{static_cast<value_type>(1.0)};
+    const scalar_type two{static_cast<value_type>(2.0)};
+    const scalar_type four{static_cast<value_type>(4.0)};
+    const scalar_type eps{std::numeric_limits<value_type>::epsilon()};
+
+    // Work on local copies of the columns, so that the loops can be fully
+    // unrolled
+    std::array<std::array<scalar_type, M>, N> a;
+    std::array<std::array<scalar_type, N>, N> v;
+    ALGEBRA_UNROLL_N(N)
+    for (size_type j = 0; j < N; j++) {
+      ALGEBRA_UNROLL_N(M)
+      for (size_type i = 0; i < M; i++) {
+        a[j][i] = element_getter_t()(m, i, j);
+      }
+      ALGEBRA_UNROLL_N(N)
+      for (size_type i = 0; i < N; i++) {
+        v[j][i] = (i == j) ? one : zero;
+      }
+    }
+
+    // Squared column norms
+    std::array<scalar_type, N> norm2;
+    const auto update_norms = [&a, &norm2, &zero]() {
+      ALGEBRA_UNROLL_N(N)
+      for (size_type j = 0; j < N; j++) {
+        norm2[j] = zero;
+        ALGEBRA_UNROLL_N(M)
+        for (size_type i = 0; i < M; i++) {
+          norm2[j] += a[j][i] * a[j][i];
+        }
+      }
+    };
+
+    for (size_type sweep = 0; sweep < n_sweeps; sweep++) {
+
+      // The norms are updated with the rotations and recomputed once per
+      // sweep, so that the rounding errors do not accumulate
+      update_norms();
+
+      ALGEBRA_UNROLL_N(N)
+      for (size_type p = 0; p < N - 1; p++) {
+        ALGEBRA_UNROLL_N(N)
+        for (size_type q = p + 1; q < N; q++) {
+
+          scalar_type gamma{zero};
+          ALGEBRA_UNROLL_N(M)
+          for (size_type i = 0; i < M; i++) {
+            gamma += a[p][i] * a[q][i];
+          }
+
+          // Columns that are orthogonal within the rounding errors are not
+          // rotated, which also keeps the squares from underflowing
+          gamma = ops::select(ops::abs(gamma) > eps * ops::sqrt(norm2[p]) *
+                                                    ops::sqrt(norm2[q]),
+                              gamma, zero);
+
+          // Rotation that diagonalizes the 2 X 2 Gram matrix of the columns
+          // p and q (see the symmetric eigen decomposition), without a
+          // division by zero for orthogonal columns. The elements of the
+          // Gram matrix are divided by the larger squared norm, which bounds
+          // them by one, so that their squares can neither overflow nor
+          // underflow
+          const scalar_type scale =
+              ops::select(norm2[p] > norm2[q], norm2[p], norm2[q]);
+          const scalar_type inv_scale =
+              one / ops::select(scale > zero, scale, one);
+
+          const scalar_type diff = (norm2[q] - norm2[p]) * inv_scale;
+          const scalar_type gamma_s = gamma * inv_scale;
+          const scalar_type h =
+              ops::sqrt(diff * diff + four * gamma_s * gamma_s);
+          const scalar_type w = ops::abs(diff) + h;
+          const scalar_type hw = two * h * w;
+
+          const auto rotate = hw > zero;
+          const scalar_type inv = one / ops::sqrt(ops::select(rotate, hw, one));
+
+          const scalar_type c = ops::select(rotate, w * inv, one);
+          const scalar_type s = two * ops::copysign(one, diff) * gamma_s * inv;
+          const scalar_type t = two * h * s * inv;
+
+          norm2[p] -= t * gamma;
+          norm2[q] += t * gamma;
+
+          ALGEBRA_UNROLL_N(M)
+          for (size_type i = 0; i < M; i++) {
+            const scalar_type a_ip = a[p][i];
+            const scalar_type a_iq = a[q][i];
+            a[p][i] = c * a_ip - s * a_iq;
+            a[q][i] = s * a_ip + c * a_iq;
+          }
+          ALGEBRA_UNROLL_N(N)
+          for (size_type i = 0; i < N; i++) {
+            const scalar_type v_ip = v[p][i];
+            const scalar_type v_iq = v[q][i];
+            v[p][i] = c * v_ip - s * v_iq;
+            v[q][i] = s * v_ip + c * v_iq;
+          }
+        }
+      }
+    }
+
+    update_norms();
+
+    // Sort the columns by decreasing norm with a (branch-free) bubble sort
+    ALGEBRA_UNROLL_N(N)
+    for (size_type k = 0; k < N - 1; k++) {
+      ALGEBRA_UNROLL_N(N)
+      for (size_type j = 0; j < N - 1 - k; j++) {
+        const auto swap = norm2[j] < norm2[j + 1];
+
+        const scalar_type n_j = norm2[j];
+        norm2[j] = ops::select(swap, norm2[j + 1], n_j);
+        norm2[j + 1] = ops::select(swap, n_j, norm2[j + 1]);
+
+        ALGEBRA_UNROLL_N(M)
+        for (size_type i = 0; i < M; i++) {
+          const scalar_type a_ij = a[j][i];
+          a[j][i] = ops::select(swap, a[j + 1][i], a_ij);
+          a[j + 1][i] = ops::select(swap, a_ij, a[j + 1][i]);
+        }
+        ALGEBRA_UNROLL_N(N)
+        for (size_type i = 0; i < N; i++) {
+          const scalar_type v_ij = v[j][i];
+          v[j][i] = ops::select(swap, v[j + 1][i], v_ij);
+          v[j + 1][i] = ops::select(swap, v_ij, v[j + 1][i]);
+        }
+      }
+    }
+
+    svd res;
+    ALGEBRA_UNROLL_N(N)
+    for (size_type j = 0; j < N; j++) {
+      const scalar_type sigma = ops::sqrt(norm2[j]);
+      const auto nonzero = sigma > zero;
+      const scalar_type inv_sigma =
+          ops::select(nonzero, one / ops::select(nonzero, sigma, one), zero);
+
+      vector_getter()(res.sigma, j) = sigma;
+      ALGEBRA_UNROLL_N(M)
+      for (size_type i = 0; i < M; i++) {
+        element_getter_t()(res.u, i, j) = a[j][i] * inv_sigma;
+      }
+      ALGEBRA_UNROLL_N(N)
+      for (size_type i = 0; i < N; i++) {
+        element_getter_t()(res.v, i, j) = v[j][i];
+      }
+    }
+
+    return res;
+  }
+
+  /// @returns the Moore-Penrose pseudo-inverse V * diag(1 / sigma) * U^T for
+  /// the decomposition @param d, where the singular values below
+  /// @param rcond times the largest one are treated as zero
+  ALGEBRA_HOST_DEVICE static constexpr pinv_matrix_type pseudo_inverse(
+      const svd& d, const value_type rcond) {
+
+    using ops = algebra::math::vec::simd_ops<scalar_type>;
+
+    const scalar_type zero{static_cast<value_type>(0.0)};
+    const scalar_type one{static_cast<value_type>(1.0)};
+
+    const scalar_type cutoff{rcond * vector_getter()(d.sigma, 0)};
+
+    std::array<scalar_type, N> inv_sigma;
+    ALGEBRA_UNROLL_N(N)
+    for (size_type k = 0; k < N; k++) {
+      const scalar_type sigma = vector_getter()(d.sigma, k);
+      const auto keep = sigma > cutoff;
+      inv_sigma[k] =
+          ops::select(keep, one / ops::select(keep, sigma, one), zero);
+    }
+
+    pinv_matrix_type pinv;
+    ALGEBRA_UNROLL_N(M)
+    for (size_type j = 0; j < M; j++) {
+      ALGEBRA_UNROLL_N(N)
+      for (size_type i = 0; i < N; i++) {
+        scalar_type sum{zero};
+        ALGEBRA_UNROLL_N(N)
+        for (size_type k = 0; k < N; k++) {
+          sum += element_getter_t()(d.v, i, k) * inv_sigma[k] *
+                 element_getter_t()(d.u, j, k);
+        }
+        element_getter_t()(pinv, i, j) = sum;
+      }
+    }
+
+    return pinv;
+  }
+
+  /// @returns the condition number sigma_max / sigma_min (in the 2-norm) for
+  /// the decomposition @param d, which is infinite for singular matrices
+  ALGEBRA_HOST_DEVICE static constexpr scalar_type condition_number(
+      const svd& d) {
+    return vector_getter()(d.sigma, 0) / vector_getter()(d.sigma, N - 1);
+  }
+};
+
+}  // namespace algebra::generic::matrix::decomposition
@@ -25,6 +25,9 @@ struct partial_pivot_lud {
   using size_type = algebra::traits::index_t<matrix_t>;
   using vector_type = algebra::traits::vector_t<matrix_t>;
 
+  /// Matrix type that owns its elements (differs from @c matrix_t for views)
+  using matrix_type = algebra::traits::matrix_t<matrix_t>;
+
   /// Function (object) used for accessing a matrix element
   using element_getter = element_getter_t;
 
@@ -32,7 +35,7 @@ struct partial_pivot_lud {
   struct lud {
     // LU decomposition matrix, equal to (L - I) + U, where the diagonal
     // components of L is always 1
-    matrix_t lu;
+    matrix_type lu;
 
     // Permutation vector
     vector_type P;
@@ -47,7 +50,7 @@ struct partial_pivot_lud {
     constexpr size_type N{algebra::traits::rank<matrix_t>};
 
     // LU decomposition matrix
-    matrix_t lu = m;
+    matrix_type lu = m;
 
     // Permutation
     vector_type P;
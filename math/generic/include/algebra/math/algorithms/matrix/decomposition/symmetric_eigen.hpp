@@ -0,0 +1,184 @@
+/** Algebra plugins library, part of the ACTS project
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "algebra/concepts.hpp"
+#include "algebra/math/vec.hpp"
+#include "algebra/qualifiers.hpp"
+#include "algebra/type_traits.hpp"
+
+// System include(s).
+#include <array>
+#include <limits>
+
+namespace algebra::generic::matrix::decomposition {
+
+/// "Symmetric Eigen Decomposition" A = V * diag(lambda) * V^T of a symmetric
+/// 2 X 2 or 3 X 3 matrix, using cyclic Jacobi rotations
+///
+/// Only the lower triangle of the input matrix is read. The number of sweeps
+/// is fixed and the rotations are computed without branches on the matrix
+/// elements.
+///
+/// The eigenvalues are sorted in increasing order and the eigenvectors are
+/// the columns of V (as for the @c Eigen::SelfAdjointEigenSolver).
+template <concepts::square_matrix matrix_t, class element_getter_t>
+requires(algebra::traits::rank<matrix_t> == 2 ||
+         algebra::traits::rank<matrix_t> == 3) struct symmetric_eigen {
+
+  using scalar_type = algebra::traits::scalar_t<matrix_t>;
+  using value_type = algebra::traits::value_t<matrix_t>;
+  using size_type = algebra::traits::index_t<matrix_t>;
+
+  /// Matrix type that owns its elements (differs from @c matrix_t for views)
+  using matrix_type = algebra::traits::matrix_t<matrix_t>;
+
+  /// Function (object) used for accessing a matrix element
+  using element_getter = element_getter_t;
+
+  static constexpr size_type N{algebra::traits::rank<matrix_t>};
+
+  /// Vector type of the eigenvalues
+  using vector_type = algebra::traits::get_vector_t<matrix_type, N, value_type>;
+
+  /// Function (object) used for accessing a vector element
+  using vector_getter = algebra::traits::element_getter_t<vector_type>;
+
+  /// Number of Jacobi sweeps: A single rotation diagonalizes a 2 X 2 matrix.
+  /// For 3 X 3 matrices the convergence is quadratic, and four sweeps bring
+  /// the off-diagonal elements below the rounding errors in single and double
+  /// precision
+  static constexpr size_type n_sweeps{N == 2 ? 1 : 4};
+
+  /// Eigenvalues and eigenvectors
+  struct eigensystem {
+    vector_type values;
+    matrix_type vectors;
+  };
+
+  ALGEBRA_HOST_DEVICE constexpr eigensystem operator()(
+      const matrix_t& m) const {
+
+    using ops = algebra::math::vec::simd_ops<scalar_type>;
+
+    const scalar_type zero{static_cast<value_type>(0.0)};
+    const scalar_type one{static_cast<value_type>(1.0)};
+    const scalar_type two{static_cast<value_type>(2.0)};
+    const scalar_type four{static_cast<value_type>(4.0)};
+    const scalar_type eps{std::numeric_limits<value_type>::epsilon()};
+
+    // Work on local copies, so that the loops can be fully unrolled
+    std::array<std::array<scalar_type, N>, N> a;
+    std::array<std::array<scalar_type, N>, N> v;
+    for (size_type j = 0; j < N; j++) {
+      for (size_type i = j; i < N; i++) {
+        a[i][j] = element_getter_t()(m, i, j);
+        a[j][i] = a[i][j];
+      }
+      for (size_type i = 0; i < N; i++) {
+        v[i][j] = (i == j) ? one : zero;
+      }
+    }
+
+    for (size_type sweep = 0; sweep < n_sweeps; sweep++) {
+      for (size_type p = 0; p < N - 1; p++) {
+        for (size_type q = p + 1; q < N; q++) {
+
+          // Off-diagonal elements below the rounding errors of the diagonal
+          // are dropped, which also keeps their squares from underflowing
+          const scalar_type a_pq = ops::select(
+              ops::abs(a[p][q]) > eps * (ops::abs(a[p][p]) + ops::abs(a[q][q])),
+              a[p][q], zero);
+
+          // Rotation that annihilates a[p][q]: t = tan(phi) is the smaller
+          // root of t^2 + 2 * theta * t - 1 = 0, with
+          // theta = (a[q][q] - a[p][p]) / (2 * a[p][q]). Written in terms of
+          // h = sqrt(diff^2 + 4 * a[p][q]^2) and w = |diff| + h, such that
+          // a[p][q] = 0 gives the identity without a division by zero.
+          // The rotation only depends on the ratio of diff and a[p][q], which
+          // are scaled to at most one, so that the squares can neither
+          // overflow nor underflow
+          const scalar_type diff_pq = a[q][q] - a[p][p];
+          const scalar_type abs_diff = ops::abs(diff_pq);
+          const scalar_type abs_a_pq = ops::abs(a_pq);
+          const scalar_type scale =
+              ops::select(abs_diff > abs_a_pq, abs_diff, abs_a_pq);
+          const scalar_type inv_scale =
+              one / ops::select(scale > zero, scale, one);
+
+          const scalar_type diff = diff_pq * inv_scale;
+          const scalar_type a_pq_s = a_pq * inv_scale;
+          const scalar_type h = ops::sqrt(diff * diff + four * a_pq_s * a_pq_s);
+          const scalar_type w = ops::abs(diff) + h;
+          const scalar_type hw = two * h * w;
+
+          const auto rotate = hw > zero;
+          const scalar_type inv = one / ops::sqrt(ops::select(rotate, hw, one));
+
+          // c = w / sqrt(2 * h * w), s = t * c, t = 2 * sgn(diff) * a[p][q] / w
+          const scalar_type c = ops::select(rotate, w * inv, one);
+          const scalar_type s = two * ops::copysign(one, diff) * a_pq_s * inv;
+          const scalar_type t = two * h * s * inv;
+
+          a[p][p] -= t * a_pq;
+          a[q][q] += t * a_pq;
+          a[p][q] = zero;
+          a[q][p] = zero;
+
+          for (size_type r = 0; r < N; r++) {
+            if (r != p && r != q) {
+              const scalar_type a_rp = a[r][p];
+              const scalar_type a_rq = a[r][q];
+              a[r][p] = c * a_rp - s * a_rq;
+              a[r][q] = s * a_rp + c * a_rq;
+              a[p][r] = a[r][p];
+              a[q][r] = a[r][q];
+            }
+          }
+
+          for (size_type r = 0; r < N; r++) {
+            const scalar_type v_rp = v[r][p];
+            const scalar_type v_rq = v[r][q];
+            v[r][p] = c * v_rp - s * v_rq;
+            v[r][q] = s * v_rp + c * v_rq;
+          }
+        }
+      }
+    }
+
+    // Sort the eigenpairs with a (branch-free) bubble sort
+    for (size_type k = 0; k < N - 1; k++) {
+      for (size_type j = 0; j < N - 1 - k; j++) {
+        const auto swap = a[j + 1][j + 1] < a[j][j];
+
+        const scalar_type l_j = a[j][j];
+        a[j][j] = ops::select(swap, a[j + 1][j + 1], l_j);
+        a[j + 1][j + 1] = ops::select(swap, l_j, a[j + 1][j + 1]);
+
+        for (size_type r = 0; r < N; r++) {
+          const scalar_type v_rj = v[r][j];
+          v[r][j] = ops::select(swap, v[r][j + 1], v_rj);
+          v[r][j + 1] = ops::select(swap, v_rj, v[r][j + 1]);
+        }
+      }
+    }
+
+    eigensystem res;
+    for (size_type j = 0; j < N; j++) {
+      vector_getter()(res.values, j) = a[j][j];
+      for (size_type i = 0; i < N; i++) {
+        element_getter_t()(res.vectors, i, j) = v[i][j];
+      }
+    }
+
+    return res;
+  }
+};
+
+}  // namespace algebra::generic::matrix::decomposition
@@ -24,6 +24,9 @@ struct cofactor {
   using scalar_type = algebra::traits::value_t<matrix_t>;
   using size_type = algebra::traits::index_t<matrix_t>;
 
+  /// Matrix type that owns its elements (differs from @c matrix_t for views)
+  using matrix_type = algebra::traits::matrix_t<matrix_t>;
+
   /// Function (object) used for accessing a matrix element
   using element_getter = element_getter_t;
 
@@ -54,7 +57,7 @@ struct cofactor {
       scalar_type D = 0;
 
       // To store cofactors
-      matrix_t temp;
+      matrix_type temp;
 
       // To store sign multiplier
       int sign = 1;
@@ -74,9 +77,9 @@ struct cofactor {
     }
 
     template <class input_matrix_type>
-    ALGEBRA_HOST_DEVICE constexpr void get_cofactor(const input_matrix_type &m,
-                                                    matrix_t &temp, size_type p,
-                                                    size_type q) const {
+    ALGEBRA_HOST_DEVICE constexpr void get_cofactor(
+        const input_matrix_type &m, matrix_type &temp, size_type p,
+        size_type q) const {
 
       size_type i = 0;
       size_type j = 0;
@@ -24,6 +24,9 @@ struct hard_coded {
   using scalar_type = algebra::traits::value_t<matrix_t>;
   using size_type = algebra::traits::index_t<matrix_t>;
 
+  /// Matrix type that owns its elements (differs from @c matrix_t for views)
+  using matrix_type = algebra::traits::matrix_t<matrix_t>;
+
   /// Function (object) used for accessing a matrix element
   using element_getter = element_getter_t;
 
@@ -37,60 +40,104 @@ struct hard_coded {
            element_getter()(m, 0, 1) * element_getter()(m, 1, 0);
   }
 
+  // 3 X 3 matrix determinant
+  template <typename M = matrix_t>
+  requires(algebra::traits::rank<M> == 3) ALGEBRA_HOST_DEVICE
+      constexpr scalar_type
+      operator()(const matrix_t &m) const {
+
+    return element_getter()(m, 0, 0) *
+               (element_getter()(m, 1, 1) * element_getter()(m, 2, 2) -
+                element_getter()(m, 1, 2) * element_getter()(m, 2, 1)) -
+           element_getter()(m, 1, 0) *
+               (element_getter()(m, 0, 1) * element_getter()(m, 2, 2) -
+                element_getter()(m, 0, 2) * element_getter()(m, 2, 1)) +
+           element_getter()(m, 2, 0) *
+               (element_getter()(m, 0, 1) * element_getter()(m, 1, 2) -
+                element_getter()(m, 0, 2) * element_getter()(m, 1, 1));
+  }
+
   // 4 X 4 matrix determinant
+  //
+  // Laplace expansion in the 2 X 2 minors of the first two and the last two
+  // rows
   template <typename M = matrix_t>
   requires(algebra::traits::rank<M> == 4) ALGEBRA_HOST_DEVICE
       constexpr scalar_type
       operator()(const matrix_t &m) const {
 
-    return element_getter()(m, 0, 3) * element_getter()(m, 1, 2) *
-               element_getter()(m, 2, 1) * element_getter()(m, 3, 0) -
-           element_getter()(m, 0, 2) * element_getter()(m, 1, 3) *
-               element_getter()(m, 2, 1) * element_getter()(m, 3, 0) -
-           element_getter()(m, 0, 3) * element_getter()(m, 1, 1) *
-               element_getter()(m, 2, 2) * element_getter()(m, 3, 0) +
-           element_getter()(m, 0, 1) * element_getter()(m, 1, 3) *
-               element_getter()(m, 2, 2) * element_getter()(m, 3, 0) +
-           element_getter()(m, 0, 2) * element_getter()(m, 1, 1) *
-               element_getter()(m, 2, 3) * element_getter()(m, 3, 0) -
-           element_getter()(m, 0, 1) * element_getter()(m, 1, 2) *
-               element_getter()(m, 2, 3) * element_getter()(m, 3, 0) -
-           element_getter()(m, 0, 3) * element_getter()(m, 1, 2) *
-               element_getter()(m, 2, 0) * element_getter()(m, 3, 1) +
-           element_getter()(m, 0, 2) * element_getter()(m, 1, 3) *
-               element_getter()(m, 2, 0) * element_getter()(m, 3, 1) +
-           element_getter()(m, 0, 3) * element_getter()(m, 1, 0) *
-               element_getter()(m, 2, 2) * element_getter()(m, 3, 1) -
-           element_getter()(m, 0, 0) * element_getter()(m, 1, 3) *
-               element_getter()(m, 2, 2) * element_getter()(m, 3, 1) -
-           element_getter()(m, 0, 2) * element_getter()(m, 1, 0) *
-               element_getter()(m, 2, 3) * element_getter()(m, 3, 1) +
-           element_getter()(m, 0, 0) * element_getter()(m, 1, 2) *
-               element_getter()(m, 2, 3) * element_getter()(m, 3, 1) +
-           element_getter()(m, 0, 3) * element_getter()(m, 1, 1) *
-               element_getter()(m, 2, 0) * element_getter()(m, 3, 2) -
-           element_getter()(m, 0, 1) * element_getter()(m, 1, 3) *
-               element_getter()(m, 2, 0) * element_getter()(m, 3, 2) -
-           element_getter()(m, 0, 3) * element_getter()(m, 1, 0) *
-               element_getter()(m, 2, 1) * element_getter()(m, 3, 2) +
-           element_getter()(m, 0, 0) * element_getter()(m, 1, 3) *
-               element_getter()(m, 2, 1) * element_getter()(m, 3, 2) +
-           element_getter()(m, 0, 1) * element_getter()(m, 1, 0) *
-               element_getter()(m, 2, 3) * element_getter()(m, 3, 2) -
-           element_getter()(m, 0, 0) * element_getter()(m, 1, 1) *
-               element_getter()(m, 2, 3) * element_getter()(m, 3, 2) -
-           element_getter()(m, 0, 2) * element_getter()(m, 1, 1) *
-               element_getter()(m, 2, 0) * element_getter()(m, 3, 3) +
-           element_getter()(m, 0, 1) * element_getter()(m, 1, 2) *
-               element_getter()(m, 2, 0) * element_getter()(m, 3, 3) +
-           element_getter()(m, 0, 2) * element_getter()(m, 1, 0) *
-               element_getter()(m, 2, 1) * element_getter()(m, 3, 3) -
-           element_getter()(m, 0, 0) * element_getter()(m, 1, 2) *
-               element_getter()(m, 2, 1) * element_getter()(m, 3, 3) -
-           element_getter()(m, 0, 1) * element_getter()(m, 1, 0) *
-               element_getter()(m, 2, 2) * element_getter()(m, 3, 3) +
-           element_getter()(m, 0, 0) * element_getter()(m, 1, 1) *
-               element_getter()(m, 2, 2) * element_getter()(m, 3, 3);
+    const scalar_type s0 =
+        element_getter()(m, 0, 0) * element_getter()(m, 1, 1) -
+        element_getter()(m, 1, 0) * element_getter()(m, 0, 1);
+    const scalar_type s1 =
+        element_getter()(m, 0, 0) * element_getter()(m, 1, 2) -
+        element_getter()(m, 1, 0) * element_getter()(m, 0, 2);
+    const scalar_type s2 =
+        element_getter()(m, 0, 0) * element_getter()(m, 1, 3) -
+        element_getter()(m, 1, 0) * element_getter()(m, 0, 3);
+    const scalar_type s3 =
+        element_getter()(m, 0, 1) * element_getter()(m, 1, 2) -
+        element_getter()(m, 1, 1) * element_getter()(m, 0, 2);
+    const scalar_type s4 =
+        element_getter()(m, 0, 1) * element_getter()(m, 1, 3) -
+        element_getter()(m, 1, 1) * element_getter()(m, 0, 3);
+    const scalar_type s5 =
+        element_getter()(m, 0, 2) * element_getter()(m, 1, 3) -
+        element_getter()(m, 1, 2) * element_getter()(m, 0, 3);
+
+    const scalar_type c5 =
+        element_getter()(m, 2, 2) * element_getter()(m, 3, 3) -
+        element_getter()(m, 3, 2) * element_getter()(m, 2, 3);
+    const scalar_type c4 =
+        element_getter()(m, 2, 1) * element_getter()(m, 3, 3) -
+        element_getter()(m, 3, 1) * element_getter()(m, 2, 3);
+    const scalar_type c3 =
+        element_getter()(m, 2, 1) * element_getter()(m, 3, 2) -
+        element_getter()(m, 3, 1) * element_getter()(m, 2, 2);
+    const scalar_type c2 =
+        element_getter()(m, 2, 0) * element_getter()(m, 3, 3) -
+        element_getter()(m, 3, 0) * element_getter()(m, 2, 3);
+    const scalar_type c1 =
+        element_getter()(m, 2, 0) * element_getter()(m, 3, 2) -
+        element_getter()(m, 3, 0) * element_getter()(m, 2, 2);
+    const scalar_type c0 =
+        element_getter()(m, 2, 0) * element_getter()(m, 3, 1) -
+        element_getter()(m, 3, 0) * element_getter()(m, 2, 1);
+
+    return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+  }
+
+  // 5 X 5 and 6 X 6 matrix determinant
+  //
+  // Successive Schur complements of the leading element, i.e. Gaussian
+  // elimination without pivoting: The loops have fixed trip counts and no
+  // data dependent branches. The leading principal minors must not vanish,
+  // which holds e.g. for positive definite (covariance) matrices. Use the
+  // partial_pivot_lud algorithm for general matrices that may violate this.
+  template <typename M = matrix_t>
+  requires(algebra::traits::rank<M> == 5 || algebra::traits::rank<M> == 6)
+      ALGEBRA_HOST_DEVICE constexpr scalar_type
+      operator()(const matrix_t &m) const {
+
+    constexpr size_type N{algebra::traits::rank<matrix_t>};
+
+    matrix_type a = m;
+    scalar_type det = element_getter()(a, 0, 0);
+
+    for (size_type k = 0; k < N - 1; ++k) {
+      const scalar_type inv_pivot =
+          static_cast<scalar_type>(1.) / element_getter()(a, k, k);
+
+      for (size_type i = k + 1; i < N; ++i) {
+        const scalar_type f = element_getter()(a, i, k) * inv_pivot;
+        for (size_type j = k + 1; j < N; ++j) {
+          element_getter()(a, i, j) -= f * element_getter()(a, k, j);
+        }
+      }
+      det *= element_getter()(a, k + 1, k + 1);
+    }
+
+    return det;
   }
 };
 
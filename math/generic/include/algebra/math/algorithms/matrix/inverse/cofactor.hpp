@@ -27,10 +27,14 @@ struct cofactor {
   using scalar_type = algebra::traits::value_t<matrix_t>;
   using size_type = algebra::traits::index_t<matrix_t>;
 
+  /// Matrix type that owns its elements (differs from @c matrix_t for views)
+  using matrix_type = algebra::traits::matrix_t<matrix_t>;
+
   /// Function (object) used for accessing a matrix element
   using element_getter = element_getter_t;
 
-  ALGEBRA_HOST_DEVICE constexpr matrix_t operator()(const matrix_t &m) const {
+  ALGEBRA_HOST_DEVICE constexpr matrix_type operator()(
+      const matrix_t &m) const {
     return adjoint_getter_helper<algebra::traits::rank<matrix_t>>()(m);
   }
 
@@ -39,9 +43,9 @@ struct cofactor {
 
   template <size_type N>
   struct adjoint_getter_helper<N, typename std::enable_if_t<N == 1>> {
-    ALGEBRA_HOST_DEVICE constexpr matrix_t operator()(
+    ALGEBRA_HOST_DEVICE constexpr matrix_type operator()(
         const matrix_t & /*m*/) const {
-      matrix_t ret;
+      matrix_type ret;
       element_getter()(ret, 0, 0) = 1;
       return ret;
     }
@@ -53,15 +57,16 @@ struct cofactor {
     using determinant_getter =
         determinant::cofactor<matrix_t, element_getter_t>;
 
-    ALGEBRA_HOST_DEVICE constexpr matrix_t operator()(const matrix_t &m) const {
+    ALGEBRA_HOST_DEVICE constexpr matrix_type operator()(
+        const matrix_t &m) const {
 
-      matrix_t adj;
+      matrix_type adj;
 
       // temp is used to store cofactors of m
       int sign = 1;
 
       // To store cofactors
-      matrix_t temp;
+      matrix_type temp;
 
       for (size_type i = 0; i < N; i++) {
         for (size_type j = 0; j < N; j++) {
@@ -98,6 +103,9 @@ struct cofactor {
   using scalar_type = algebra::traits::value_t<matrix_t>;
   using size_type = algebra::traits::index_t<matrix_t>;
 
+  /// Matrix type that owns its elements (differs from @c matrix_t for views)
+  using matrix_type = algebra::traits::matrix_t<matrix_t>;
+
   /// Function (object) used for accessing a matrix element
   using element_getter = element_getter_t;
 
@@ -105,11 +113,12 @@ struct cofactor {
 
   using adjoint_getter = adjoint::cofactor<matrix_t, element_getter_t>;
 
-  ALGEBRA_HOST_DEVICE constexpr matrix_t operator()(const matrix_t &m) const {
+  ALGEBRA_HOST_DEVICE constexpr matrix_type operator()(
+      const matrix_t &m) const {
 
     constexpr size_type N{algebra::traits::rank<matrix_t>};
 
-    matrix_t ret;
+    matrix_type ret;
 
     // Find determinant of A
     scalar_type det = determinant_getter()(m);
@@ -25,6 +25,9 @@ struct hard_coded {
   using scalar_type = algebra::traits::value_t<matrix_t>;
   using size_type = algebra::traits::index_t<matrix_t>;
 
+  /// Matrix type that owns its elements (differs from @c matrix_t for views)
+  using matrix_type = algebra::traits::matrix_t<matrix_t>;
+
   /// Function (object) used for accessing a matrix element
   using element_getter = element_getter_t;
 
@@ -33,10 +36,11 @@ struct hard_coded {
 
   // 2 X 2 matrix inverse
   template <typename M = matrix_t>
-  requires(algebra::traits::rank<M> == 2) ALGEBRA_HOST_DEVICE constexpr matrix_t
-  operator()(const matrix_t &m) const {
+  requires(algebra::traits::rank<M> == 2) ALGEBRA_HOST_DEVICE
+      constexpr matrix_type
+      operator()(const matrix_t &m) const {
 
-    matrix_t ret;
+    matrix_type ret;
 
     scalar_type det = determinant_getter()(m);
 
@@ -48,227 +52,221 @@ struct hard_coded {
     return ret;
   }
 
+  // 3 X 3 matrix inverse
+  template <typename M = matrix_t>
+  requires(algebra::traits::rank<M> == 3) ALGEBRA_HOST_DEVICE
+      constexpr matrix_type
+      operator()(const matrix_t &m) const {
+
+    const scalar_type a00 = element_getter()(m, 0, 0);
+    const scalar_type a01 = element_getter()(m, 0, 1);
+    const scalar_type a02 = element_getter()(m, 0, 2);
+    const scalar_type a10 = element_getter()(m, 1, 0);
+    const scalar_type a11 = element_getter()(m, 1, 1);
+    const scalar_type a12 = element_getter()(m, 1, 2);
+    const scalar_type a20 = element_getter()(m, 2, 0);
+    const scalar_type a21 = element_getter()(m, 2, 1);
+    const scalar_type a22 = element_getter()(m, 2, 2);
+
+    // Cofactors of the first column
+    const scalar_type c00 = a11 * a22 - a12 * a21;
+    const scalar_type c10 = a12 * a20 - a10 * a22;
+    const scalar_type c20 = a10 * a21 - a11 * a20;
+
+    const scalar_type idet =
+        static_cast<scalar_type>(1.) / (a00 * c00 + a01 * c10 + a02 * c20);
+
+    matrix_type ret;
+    element_getter()(ret, 0, 0) = c00 * idet;
+    element_getter()(ret, 0, 1) = (a02 * a21 - a01 * a22) * idet;
+    element_getter()(ret, 0, 2) = (a01 * a12 - a02 * a11) * idet;
+    element_getter()(ret, 1, 0) = c10 * idet;
+    element_getter()(ret, 1, 1) = (a00 * a22 - a02 * a20) * idet;
+    element_getter()(ret, 1, 2) = (a02 * a10 - a00 * a12) * idet;
+    element_getter()(ret, 2, 0) = c20 * idet;
+    element_getter()(ret, 2, 1) = (a01 * a20 - a00 * a21) * idet;
+    element_getter()(ret, 2, 2) = (a00 * a11 - a01 * a10) * idet;
+
+    return ret;
+  }
+
   // 4 X 4 matrix inverse
+  //
+  // Adjugate from the 2 X 2 minors of the first two and the last two rows
   template <typename M = matrix_t>
-  requires(algebra::traits::rank<M> == 4) ALGEBRA_HOST_DEVICE constexpr matrix_t
-  operator()(const matrix_t &m) const {
-
-    matrix_t ret;
-    element_getter()(ret, 0, 0) =
-        element_getter()(m, 1, 2) * element_getter()(m, 2, 3) *
-            element_getter()(m, 3, 1) -
-        element_getter()(m, 1, 3) * element_getter()(m, 2, 2) *
-            element_getter()(m, 3, 1) +
-        element_getter()(m, 1, 3) * element_getter()(m, 2, 1) *
-            element_getter()(m, 3, 2) -
-        element_getter()(m, 1, 1) * element_getter()(m, 2, 3) *
-            element_getter()(m, 3, 2) -
-        element_getter()(m, 1, 2) * element_getter()(m, 2, 1) *
-            element_getter()(m, 3, 3) +
-        element_getter()(m, 1, 1) * element_getter()(m, 2, 2) *
-            element_getter()(m, 3, 3);
-    element_getter()(ret, 0, 1) =
-        element_getter()(m, 0, 3) * element_getter()(m, 2, 2) *
-            element_getter()(m, 3, 1) -
-        element_getter()(m, 0, 2) * element_getter()(m, 2, 3) *
-            element_getter()(m, 3, 1) -
-        element_getter()(m, 0, 3) * element_getter()(m, 2, 1) *
-            element_getter()(m, 3, 2) +
-        element_getter()(m, 0, 1) * element_getter()(m, 2, 3) *
-            element_getter()(m, 3, 2) +
-        element_getter()(m, 0, 2) * element_getter()(m, 2, 1) *
-            element_getter()(m, 3, 3) -
-        element_getter()(m, 0, 1) * element_getter()(m, 2, 2) *
-            element_getter()(m, 3, 3);
-    element_getter()(ret, 0, 2) =
-        element_getter()(m, 0, 2) * element_getter()(m, 1, 3) *
-            element_getter()(m, 3, 1) -
-        element_getter()(m, 0, 3) * element_getter()(m, 1, 2) *
-            element_getter()(m, 3, 1) +
-        element_getter()(m, 0, 3) * element_getter()(m, 1, 1) *
-            element_getter()(m, 3, 2) -
-        element_getter()(m, 0, 1) * element_getter()(m, 1, 3) *
-            element_getter()(m, 3, 2) -
-        element_getter()(m, 0, 2) * element_getter()(m, 1, 1) *
-            element_getter()(m, 3, 3) +
-        element_getter()(m, 0, 1) * element_getter()(m, 1, 2) *
-            element_getter()(m, 3, 3);
-    element_getter()(ret, 0, 3) =
-        element_getter()(m, 0, 3) * element_getter()(m, 1, 2) *
-            element_getter()(m, 2, 1) -
-        element_getter()(m, 0, 2) * element_getter()(m, 1, 3) *
-            element_getter()(m, 2, 1) -
-        element_getter()(m, 0, 3) * element_getter()(m, 1, 1) *
-            element_getter()(m, 2, 2) +
-        element_getter()(m, 0, 1) * element_getter()(m, 1, 3) *
-            element_getter()(m, 2, 2) +
-        element_getter()(m, 0, 2) * element_getter()(m, 1, 1) *
-            element_getter()(m, 2, 3) -
-        element_getter()(m, 0, 1) * element_getter()(m, 1, 2) *
-            element_getter()(m, 2, 3);
-    element_getter()(ret, 1, 0) =
-        element_getter()(m, 1, 3) * element_getter()(m, 2, 2) *
-            element_getter()(m, 3, 0) -
-        element_getter()(m, 1, 2) * element_getter()(m, 2, 3) *
-            element_getter()(m, 3, 0) -
-        element_getter()(m, 1, 3) * element_getter()(m, 2, 0) *
-            element_getter()(m, 3, 2) +
-        element_getter()(m, 1, 0) * element_getter()(m, 2, 3) *
-            element_getter()(m, 3, 2) +
-        element_getter()(m, 1, 2) * element_getter()(m, 2, 0) *
-            element_getter()(m, 3, 3) -
-        element_getter()(m, 1, 0) * element_getter()(m, 2, 2) *
-            element_getter()(m, 3, 3);
-    element_getter()(ret, 1, 1) =
-        element_getter()(m, 0, 2) * element_getter()(m, 2, 3) *
-            element_getter()(m, 3, 0) -
-        element_getter()(m, 0, 3) * element_getter()(m, 2, 2) *
-            element_getter()(m, 3, 0) +
-        element_getter()(m, 0, 3) * element_getter()(m, 2, 0) *
-            element_getter()(m, 3, 2) -
-        element_getter()(m, 0, 0) * element_getter()(m, 2, 3) *
-            element_getter()(m, 3, 2) -
-        element_getter()(m, 0, 2) * element_getter()(m, 2, 0) *
-            element_getter()(m, 3, 3) +
-        element_getter()(m, 0, 0) * element_getter()(m, 2, 2) *
-            element_getter()(m, 3, 3);
-    element_getter()(ret, 1, 2) =
-        element_getter()(m, 0, 3) * element_getter()(m, 1, 2) *
-            element_getter()(m, 3, 0) -
-        element_getter()(m, 0, 2) * element_getter()(m, 1, 3) *
-            element_getter()(m, 3, 0) -
-        element_getter()(m, 0, 3) * element_getter()(m, 1, 0) *
-            element_getter()(m, 3, 2) +
-        element_getter()(m, 0, 0) * element_getter()(m, 1, 3) *
-            element_getter()(m, 3, 2) +
-        element_getter()(m, 0, 2) * element_getter()(m, 1, 0) *
-            element_getter()(m, 3, 3) -
-        element_getter()(m, 0, 0) * element_getter()(m, 1, 2) *
-            element_getter()(m, 3, 3);
-    element_getter()(ret, 1, 3) =
-        element_getter()(m, 0, 2) * element_getter()(m, 1, 3) *
-            element_getter()(m, 2, 0) -
-        element_getter()(m, 0, 3) * element_getter()(m, 1, 2) *
-            element_getter()(m, 2, 0) +
-        element_getter()(m, 0, 3) * element_getter()(m, 1, 0) *
-            element_getter()(m, 2, 2) -
-        element_getter()(m, 0, 0) * element_getter()(m, 1, 3) *
-            element_getter()(m, 2, 2) -
-        element_getter()(m, 0, 2) * element_getter()(m, 1, 0) *
-            element_getter()(m, 2, 3) +
-        element_getter()(m, 0, 0) * element_getter()(m, 1, 2) *
-            element_getter()(m, 2, 3);
-    element_getter()(ret, 2, 0) =
-        element_getter()(m, 1, 1) * element_getter()(m, 2, 3) *
-            element_getter()(m, 3, 0) -
-        element_getter()(m, 1, 3) * element_getter()(m, 2, 1) *
-            element_getter()(m, 3, 0) +
-        element_getter()(m, 1, 3) * element_getter()(m, 2, 0) *
-            element_getter()(m, 3, 1) -
-        element_getter()(m, 1, 0) * element_getter()(m, 2, 3) *
-            element_getter()(m, 3, 1) -
-        element_getter()(m, 1, 1) * element_getter()(m, 2, 0) *
-            element_getter()(m, 3, 3) +
-        element_getter()(m, 1, 0) * element_getter()(m, 2, 1) *
-            element_getter()(m, 3, 3);
-    element_getter()(ret, 2, 1) =
-        element_getter()(m, 0, 3) * element_getter()(m, 2, 1) *
-            element_getter()(m, 3, 0) -
-        element_getter()(m, 0, 1) * element_getter()(m, 2, 3) *
-            element_getter()(m, 3, 0) -
-        element_getter()(m, 0, 3) * element_getter()(m, 2, 0) *
-            element_getter()(m, 3, 1) +
-        element_getter()(m, 0, 0) * element_getter()(m, 2, 3) *
-            element_getter()(m, 3, 1) +
-        element_getter()(m, 0, 1) * element_getter()(m, 2, 0) *
-            element_getter()(m, 3, 3) -
-        element_getter()(m, 0, 0) * element_getter()(m, 2, 1) *
-            element_getter()(m, 3, 3);
-    element_getter()(ret, 2, 2) =
-        element_getter()(m, 0, 1) * element_getter()(m, 1, 3) *
-            element_getter()(m, 3, 0) -
-        element_getter()(m, 0, 3) * element_getter()(m, 1, 1) *
-            element_getter()(m, 3, 0) +
-        element_getter()(m, 0, 3) * element_getter()(m, 1, 0) *
-            element_getter()(m, 3, 1) -
-        element_getter()(m, 0, 0) * element_getter()(m, 1, 3) *
-            element_getter()(m, 3, 1) -
-        element_getter()(m, 0, 1) * element_getter()(m, 1, 0) *
-            element_getter()(m, 3, 3) +
-        element_getter()(m, 0, 0) * element_getter()(m, 1, 1) *
-            element_getter()(m, 3, 3);
-    element_getter()(ret, 2, 3) =
-        element_getter()(m, 0, 3) * element_getter()(m, 1, 1) *
-            element_getter()(m, 2, 0) -
-        element_getter()(m, 0, 1) * element_getter()(m, 1, 3) *
-            element_getter()(m, 2, 0) -
-        element_getter()(m, 0, 3) * element_getter()(m, 1, 0) *
-            element_getter()(m, 2, 1) +
-        element_getter()(m, 0, 0) * element_getter()(m, 1, 3) *
-            element_getter()(m, 2, 1) +
-        element_getter()(m, 0, 1) * element_getter()(m, 1, 0) *
-            element_getter()(m, 2, 3) -
-        element_getter()(m, 0, 0) * element_getter()(m, 1, 1) *
-            element_getter()(m, 2, 3);
-    element_getter()(ret, 3, 0) =
-        element_getter()(m, 1, 2) * element_getter()(m, 2, 1) *
-            element_getter()(m, 3, 0) -
-        element_getter()(m, 1, 1) * element_getter()(m, 2, 2) *
-            element_getter()(m, 3, 0) -
-        element_getter()(m, 1, 2) * element_getter()(m, 2, 0) *
-            element_getter()(m, 3, 1) +
-        element_getter()(m, 1, 0) * element_getter()(m, 2, 2) *
-            element_getter()(m, 3, 1) +
-        element_getter()(m, 1, 1) * element_getter()(m, 2, 0) *
-            element_getter()(m, 3, 2) -
-        element_getter()(m, 1, 0) * element_getter()(m, 2, 1) *
-            element_getter()(m, 3, 2);
-    element_getter()(ret, 3, 1) =
-        element_getter()(m, 0, 1) * element_getter()(m, 2, 2) *
-            element_getter()(m, 3, 0) -
-        element_getter()(m, 0, 2) * element_getter()(m, 2, 1) *
-            element_getter()(m, 3, 0) +
-        element_getter()(m, 0, 2) * element_getter()(m, 2, 0) *
-            element_getter()(m, 3, 1) -
-        element_getter()(m, 0, 0) * element_getter()(m, 2, 2) *
-            element_getter()(m, 3, 1) -
-        element_getter()(m, 0, 1) * element_getter()(m, 2, 0) *
-            element_getter()(m, 3, 2) +
-        element_getter()(m, 0, 0) * element_getter()(m, 2, 1) *
-            element_getter()(m, 3, 2);
-    element_getter()(ret, 3, 2) =
-        element_getter()(m, 0, 2) * element_getter()(m, 1, 1) *
-            element_getter()(m, 3, 0) -
-        element_getter()(m, 0, 1) * element_getter()(m, 1, 2) *
-            element_getter()(m, 3, 0) -
-        element_getter()(m, 0, 2) * element_getter()(m, 1, 0) *
-            element_getter()(m, 3, 1) +
-        element_getter()(m, 0, 0) * element_getter()(m, 1, 2) *
-            element_getter()(m, 3, 1) +
-        element_getter()(m, 0, 1) * element_getter()(m, 1, 0) *
-            element_getter()(m, 3, 2) -
-        element_getter()(m, 0, 0) * element_getter()(m, 1, 1) *
-            element_getter()(m, 3, 2);
-    element_getter()(ret, 3, 3) =
-        element_getter()(m, 0, 1) * element_getter()(m, 1, 2) *
-            element_getter()(m, 2, 0) -
-        element_getter()(m, 0, 2) * element_getter()(m, 1, 1) *
-            element_getter()(m, 2, 0) +
-        element_getter()(m, 0, 2) * element_getter()(m, 1, 0) *
-            element_getter()(m, 2, 1) -
-        element_getter()(m, 0, 0) * element_getter()(m, 1, 2) *
-            element_getter()(m, 2, 1) -
-        element_getter()(m, 0, 1) * element_getter()(m, 1, 0) *
-            element_getter()(m, 2, 2) +
-        element_getter()(m, 0, 0) * element_getter()(m, 1, 1) *
-            element_getter()(m, 2, 2);
-
-    scalar_type idet = static_cast<scalar_type>(1.) / determinant_getter()(ret);
-    for (unsigned int c = 0; c < 4; ++c) {
-      for (unsigned int r = 0; r < 4; ++r) {
-        element_getter()(ret, c, r) *= idet;
+  requires(algebra::traits::rank<M> == 4) ALGEBRA_HOST_DEVICE
+      constexpr matrix_type
+      operator()(const matrix_t &m) const {
+
+    const scalar_type a00 = element_getter()(m, 0, 0);
+    const scalar_type a01 = element_getter()(m, 0, 1);
+    const scalar_type a02 = element_getter()(m, 0, 2);
+    const scalar_type a03 = element_getter()(m, 0, 3);
+    const scalar_type a10 = element_getter()(m, 1, 0);
+    const scalar_type a11 = element_getter()(m, 1, 1);
+    const scalar_type a12 = element_getter()(m, 1, 2);
+    const scalar_type a13 = element_getter()(m, 1, 3);
+    const scalar_type a20 = element_getter()(m, 2, 0);
+    const scalar_type a21 = element_getter()(m, 2, 1);
+    const scalar_type a22 = element_getter()(m, 2, 2);
+    const scalar_type a23 = element_getter()(m, 2, 3);
+    const scalar_type a30 = element_getter()(m, 3, 0);
+    const scalar_type a31 = element_getter()(m, 3, 1);
+    const scalar_type a32 = element_getter()(m, 3, 2);
+    const scalar_type a33 = element_getter()(m, 3, 3);
+
+    const scalar_type s0 = a00 * a11 - a10 * a01;
+    const scalar_type s1 = a00 * a12 - a10 * a02;
+    const scalar_type s2 = a00 * a13 - a10 * a03;
+    const scalar_type s3 = a01 * a12 - a11 * a02;
+    const scalar_type s4 = a01 * a13 - a11 * a03;
+    const scalar_type s5 = a02 * a13 - a12 * a03;
+
+    const scalar_type c5 = a22 * a33 - a32 * a23;
+    const scalar_type c4 = a21 * a33 - a31 * a23;
+    const scalar_type c3 = a21 * a32 - a31 * a22;
+    const scalar_type c2 = a20 * a33 - a30 * a23;
+    const scalar_type c1 = a20 * a32 - a30 * a22;
+    const scalar_type c0 = a20 * a31 - a30 * a21;
+
+    const scalar_type idet =
+        static_cast<scalar_type>(1.) /
+        (s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0);
+
+    matrix_type ret;
+    element_getter()(ret, 0, 0) = (a11 * c5 - a12 * c4 + a13 * c3) * idet;
+    element_getter()(ret, 0, 1) = (-a01 * c5 + a02 * c4 - a03 * c3) * idet;
+    element_getter()(ret, 0, 2) = (a31 * s5 - a32 * s4 + a33 * s3) * idet;
+    element_getter()(ret, 0, 3) = (-a21 * s5 + a22 * s4 - a23 * s3) * idet;
+    element_getter()(ret, 1, 0) = (-a10 * c5 + a12 * c2 - a13 * c1) * idet;
+    element_getter()(ret, 1, 1) = (a00 * c5 - a02 * c2 + a03 * c1) * idet;
+    element_getter()(ret, 1, 2) = (-a30 * s5 + a32 * s2 - a33 * s1) * idet;
+    element_getter()(ret, 1, 3) = (a20 * s5 - a22 * s2 + a23 * s1) * idet;
+    element_getter()(ret, 2, 0) = (a10 * c4 - a11 * c2 + a13 * c0) * idet;
+    element_getter()(ret, 2, 1) = (-a00 * c4 + a01 * c2 - a03 * c0) * idet;
+    element_getter()(ret, 2, 2) = (a30 * s4 - a31 * s2 + a33 * s0) * idet;
+    element_getter()(ret, 2, 3) = (-a20 * s4 + a21 * s2 - a23 * s0) * idet;
+    element_getter()(ret, 3, 0) = (-a10 * c3 + a11 * c1 - a12 * c0) * idet;
+    element_getter()(ret, 3, 1) = (a00 * c3 - a01 * c1 + a02 * c0) * idet;
+    element_getter()(ret, 3, 2) = (-a30 * s3 + a31 * s1 - a32 * s0) * idet;
+    element_getter()(ret, 3, 3) = (a20 * s3 - a21 * s1 + a22 * s0) * idet;
+
+    return ret;
+  }
+
+  // 5 X 5 and 6 X 6 matrix inverse
+  //
+  // Blockwise inversion: The matrix is split into the blocks
+  // | A B |
+  // | C D |
+  // with A of size K X K and D of size L X L (K = 2, L = 3 for N = 5 and
+  // K = L = 3 for N = 6), which are inverted by the closed form expressions
+  // above. With the Schur complement S = D - C A^-1 B, the inverse is
+  // | A^-1 + A^-1 B S^-1 C A^-1    -A^-1 B S^-1 |
+  // |          -S^-1 C A^-1             S^-1   |
+  //
+  // The block A and its Schur complement S must be regular, which holds e.g.
+  // for positive definite (covariance) matrices. Use the partial_pivot_lud
+  // algorithm for general matrices that may violate this.
+  template <typename M = matrix_t>
+  requires(algebra::traits::rank<M> == 5 || algebra::traits::rank<M> == 6)
+      ALGEBRA_HOST_DEVICE constexpr matrix_type
+      operator()(const matrix_t &m) const {
+
+    constexpr size_type K{algebra::traits::rank<matrix_t> / 2};
+    constexpr size_type L{algebra::traits::rank<matrix_t> - K};
+
+    using block_a_t =
+        algebra::traits::get_matrix_t<matrix_t, K, K, scalar_type>;
+    using block_b_t =
+        algebra::traits::get_matrix_t<matrix_t, K, L, scalar_type>;
+    using block_c_t =
+        algebra::traits::get_matrix_t<matrix_t, L, K, scalar_type>;
+    using block_d_t =
+        algebra::traits::get_matrix_t<matrix_t, L, L, scalar_type>;
+
+    // A^-1
+    block_a_t a;
+    for (size_type j = 0; j < K; ++j) {
+      for (size_type i = 0; i < K; ++i) {
+        element_getter()(a, i, j) = element_getter()(m, i, j);
+      }
+    }
+    const block_a_t a_inv = hard_coded<block_a_t, element_getter_t>()(a);
+
+    // A^-1 B and C A^-1
+    block_b_t a_inv_b;
+    for (size_type j = 0; j < L; ++j) {
+      for (size_type i = 0; i < K; ++i) {
+        scalar_type sum{0};
+        for (size_type k = 0; k < K; ++k) {
+          sum += element_getter()(a_inv, i, k) * element_getter()(m, k, K + j);
+        }
+        element_getter()(a_inv_b, i, j) = sum;
+      }
+    }
+    block_c_t c_a_inv;
+    for (size_type j = 0; j < K; ++j) {
+      for (size_type i = 0; i < L; ++i) {
+        scalar_type sum{0};
+        for (size_type k = 0; k < K; ++k) {
+          sum += element_getter()(m, K + i, k) * element_getter()(a_inv, k, j);
+        }
+        element_getter()(c_a_inv, i, j) = sum;
+      }
+    }
+
+    // S^-1 = (D - C A^-1 B)^-1
+    block_d_t s;
+    for (size_type j = 0; j < L; ++j) {
+      for (size_type i = 0; i < L; ++i) {
+        scalar_type sum{element_getter()(m, K + i, K + j)};
+        for (size_type k = 0; k < K; ++k) {
+          sum -= element_getter()(c_a_inv, i, k) *
+                 element_getter()(m, k, K + j);
+        }
+        element_getter()(s, i, j) = sum;
       }
     }
+    const block_d_t s_inv = hard_coded<block_d_t, element_getter_t>()(s);
+
+    matrix_type ret;
+
+    // Lower right and upper right blocks
+    for (size_type j = 0; j < L; ++j) {
+      for (size_type i = 0; i < L; ++i) {
+        element_getter()(ret, K + i, K + j) = element_getter()(s_inv, i, j);
+      }
+      for (size_type i = 0; i < K; ++i) {
+        scalar_type sum{0};
+        for (size_type k = 0; k < L; ++k) {
+          sum -= element_getter()(a_inv_b, i, k) *
+                 element_getter()(s_inv, k, j);
+        }
+        element_getter()(ret, i, K + j) = sum;
+      }
+    }
+
+    // Lower left and upper left blocks
+    for (size_type j = 0; j < K; ++j) {
+      for (size_type i = 0; i < L; ++i) {
+        scalar_type sum{0};
+        for (size_type k = 0; k < L; ++k) {
+          sum -= element_getter()(s_inv, i, k) *
+                 element_getter()(c_a_inv, k, j);
+        }
+        element_getter()(ret, K + i, j) = sum;
+      }
+      for (size_type i = 0; i < K; ++i) {
+        scalar_type sum{element_getter()(a_inv, i, j)};
+        for (size_type k = 0; k < L; ++k) {
+          sum -= element_getter()(ret, i, K + k) *
+                 element_getter()(c_a_inv, k, j);
+        }
+        element_getter()(ret, i, j) = sum;
+      }
+    }
+
     return ret;
   }
 };
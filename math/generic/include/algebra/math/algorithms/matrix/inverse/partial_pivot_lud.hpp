@@ -22,6 +22,9 @@ struct partial_pivot_lud {
   using scalar_type = algebra::traits::value_t<matrix_t>;
   using size_type = algebra::traits::index_t<matrix_t>;
 
+  /// Matrix type that owns its elements (differs from @c matrix_t for views)
+  using matrix_type = algebra::traits::matrix_t<matrix_t>;
+
   /// Function (object) used for accessing a matrix element
   using element_getter = element_getter_t;
 
@@ -29,7 +32,8 @@ struct partial_pivot_lud {
       typename algebra::generic::matrix::decomposition::partial_pivot_lud<
           matrix_t, element_getter_t>;
 
-  ALGEBRA_HOST_DEVICE constexpr matrix_t operator()(const matrix_t& m) const {
+  ALGEBRA_HOST_DEVICE constexpr matrix_type operator()(
+      const matrix_t& m) const {
 
     constexpr size_type N{algebra::traits::rank<matrix_t>};
 
@@ -42,23 +46,27 @@ struct partial_pivot_lud {
     // Permutation vector
     const auto& P = decomp_res.P;
 
-    // Inverse matrix
-    matrix_t inv;
-
-    // Calculate inv(A) = inv(U) * inv(L) * P;
+    // Calculate inv(A) = inv(U) * inv(L) * P column by column and in place,
+    // reading the triangles of the LU matrix directly (the unit diagonal of
+    // L is not read)
+    matrix_type inv;
     for (size_type j = 0; j < N; j++) {
+
+      // Forward substitution L * y = P * e_j, with the permutation applied
+      // while loading the right hand side
       for (size_type i = 0; i < N; i++) {
         element_getter_t()(inv, i, j) = static_cast<size_type>(P[i]) == j
                                             ? static_cast<scalar_type>(1.0)
                                             : static_cast<scalar_type>(0.0);
-
         for (size_type k = 0; k < i; k++) {
           element_getter_t()(inv, i, j) -=
               element_getter_t()(lu, i, k) * element_getter_t()(inv, k, j);
         }
       }
 
-      for (size_type i = N - 1; int(i) >= 0; i--) {
+      // Back substitution U * x = y
+      for (size_type r = 0; r < N; r++) {
+        const size_type i{N - 1 - r};
         for (size_type k = i + 1; k < N; k++) {
           element_getter_t()(inv, i, j) -=
               element_getter_t()(lu, i, k) * element_getter_t()(inv, k, j);
@@ -8,13 +8,44 @@
 #pragma once
 
 // Project include(s).
+#include "algebra/math/algorithms/matrix/determinant/cofactor.hpp"
 #include "algebra/math/algorithms/matrix/determinant/hard_coded.hpp"
 #include "algebra/math/algorithms/matrix/determinant/partial_pivot_lud.hpp"
+#include "algebra/math/algorithms/matrix/inverse/cofactor.hpp"
 #include "algebra/math/algorithms/matrix/inverse/hard_coded.hpp"
 #include "algebra/math/algorithms/matrix/inverse/partial_pivot_lud.hpp"
 
+// System include(s).
+#include <concepts>
+
 namespace algebra::generic {
 
+/// Policies to override the algorithm that is selected by matrix dimension
+namespace matrix::policy {
+
+/// Select the algorithm according to the matrix dimension (default)
+struct automatic {};
+
+/// Closed form and blockwise expressions without pivoting (rank 2 to 6)
+///
+/// @note Ranks 5 and 6 require non-vanishing leading principal minors (e.g.
+/// positive definite matrices), so they are only used on request
+struct hard_coded {};
+
+/// Cofactor expansion
+struct cofactor {};
+
+/// LU decomposition with partial pivoting
+struct partial_pivot_lud {};
+
+/// The policies above
+template <typename T>
+concept algorithm_policy =
+    std::same_as<T, automatic> || std::same_as<T, hard_coded> ||
+    std::same_as<T, cofactor> || std::same_as<T, partial_pivot_lud>;
+
+}  // namespace matrix::policy
+
 /// Get the type of determinant algorithm acording to matrix dimension
 /// @{
 
@@ -24,17 +55,45 @@ struct determinant_selector {
   using type = matrix::determinant::partial_pivot_lud<Args...>;
 };
 
-/// Always use hard coded implementation for very small matrices
-template <typename... Args>
-struct determinant_selector<2, Args...> {
+/// Use the branch-free closed form expressions for small matrices
+template <std::size_t N, typename... Args>
+requires(N >= 2u && N <= 4u) struct determinant_selector<N, Args...> {
   using type = matrix::determinant::hard_coded<Args...>;
 };
 
+/// Get the type of determinant algorithm according to the policy
+template <typename policy_t, typename M, typename... Args>
+struct determinant_policy;
+
+template <typename M, typename... Args>
+struct determinant_policy<matrix::policy::automatic, M, Args...> {
+  using type = typename determinant_selector<algebra::traits::rank<M>, M,
+                                             Args...>::type;
+};
+
+template <typename M, typename... Args>
+struct determinant_policy<matrix::policy::hard_coded, M, Args...> {
+  using type = matrix::determinant::hard_coded<M, Args...>;
+};
+
+template <typename M, typename... Args>
+struct determinant_policy<matrix::policy::cofactor, M, Args...> {
+  using type = matrix::determinant::cofactor<M, Args...>;
+};
+
+template <typename M, typename... Args>
+struct determinant_policy<matrix::policy::partial_pivot_lud, M, Args...> {
+  using type = matrix::determinant::partial_pivot_lud<M, Args...>;
+};
+
 /// @tparam M matrix type
-template <concepts::square_matrix M>
+/// @tparam policy_t algorithm policy
+template <concepts::square_matrix M,
+          matrix::policy::algorithm_policy policy_t =
+              matrix::policy::automatic>
 using determinant_t =
-    typename determinant_selector<algebra::traits::rank<M>, M,
-                                  algebra::traits::element_getter_t<M>>::type;
+    typename determinant_policy<policy_t, M,
+                                algebra::traits::element_getter_t<M>>::type;
 /// @}
 
 /// Get the type of inversion algorithm acording to matrix dimension
@@ -44,17 +103,45 @@ struct inversion_selector {
   using type = matrix::inverse::partial_pivot_lud<Args...>;
 };
 
-/// Always use hard coded implementation for very small matrices
-template <typename... Args>
-struct inversion_selector<2, Args...> {
+/// Use the branch-free closed form expressions for small matrices
+template <std::size_t N, typename... Args>
+requires(N >= 2u && N <= 4u) struct inversion_selector<N, Args...> {
   using type = matrix::inverse::hard_coded<Args...>;
 };
 
+/// Get the type of inversion algorithm according to the policy
+template <typename policy_t, typename M, typename... Args>
+struct inversion_policy;
+
+template <typename M, typename... Args>
+struct inversion_policy<matrix::policy::automatic, M, Args...> {
+  using type =
+      typename inversion_selector<algebra::traits::rank<M>, M, Args...>::type;
+};
+
+template <typename M, typename... Args>
+struct inversion_policy<matrix::policy::hard_coded, M, Args...> {
+  using type = matrix::inverse::hard_coded<M, Args...>;
+};
+
+template <typename M, typename... Args>
+struct inversion_policy<matrix::policy::cofactor, M, Args...> {
+  using type = matrix::inverse::cofactor<M, Args...>;
+};
+
+template <typename M, typename... Args>
+struct inversion_policy<matrix::policy::partial_pivot_lud, M, Args...> {
+  using type = matrix::inverse::partial_pivot_lud<M, Args...>;
+};
+
 /// @tparam M matrix type
-template <concepts::square_matrix M>
+/// @tparam policy_t algorithm policy
+template <concepts::square_matrix M,
+          matrix::policy::algorithm_policy policy_t =
+              matrix::policy::automatic>
 using inversion_t =
-    typename inversion_selector<algebra::traits::rank<M>, M,
-                                algebra::traits::element_getter_t<M>>::type;
-/// @}generic
+    typename inversion_policy<policy_t, M,
+                              algebra::traits::element_getter_t<M>>::type;
+/// @}
 
 }  // namespace algebra::generic
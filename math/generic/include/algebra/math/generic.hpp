@@ -14,8 +14,14 @@
 #include "algebra/math/impl/generic_transform3.hpp"
 #include "algebra/math/impl/generic_vector.hpp"
 
-// Algorithms include(s).
+// Algorithms include(s). The QR, eigen and SVD decompositions never branch on
+// the matrix elements, so they also work on SoA matrices, where every element
+// holds the entries of several matrices.
+#include "algebra/math/algorithms/matrix/decomposition/cholesky.hpp"
+#include "algebra/math/algorithms/matrix/decomposition/householder_qr.hpp"
+#include "algebra/math/algorithms/matrix/decomposition/jacobi_svd.hpp"
 #include "algebra/math/algorithms/matrix/decomposition/partial_pivot_lud.hpp"
+#include "algebra/math/algorithms/matrix/decomposition/symmetric_eigen.hpp"
 #include "algebra/math/algorithms/matrix/determinant/cofactor.hpp"
 #include "algebra/math/algorithms/matrix/determinant/hard_coded.hpp"
 #include "algebra/math/algorithms/matrix/determinant/partial_pivot_lud.hpp"
@@ -9,9 +9,21 @@
 
 // Project include(s).
 #include "algebra/concepts.hpp"
+#include "algebra/math/algorithms/matrix/decomposition/householder_qr.hpp"
+#include "algebra/math/algorithms/matrix/decomposition/jacobi_svd.hpp"
+#include "algebra/math/algorithms/matrix/decomposition/symmetric_eigen.hpp"
 #include "algebra/math/algorithms/utils/algorithm_finder.hpp"
 #include "algebra/math/common.hpp"
 #include "algebra/qualifiers.hpp"
+#include "algebra/storage/block_diagonal_matrix.hpp"
+#include "algebra/storage/diagonal_matrix.hpp"
+#include "algebra/storage/matrix_view.hpp"
+#include "algebra/storage/projection_matrix.hpp"
+#include "algebra/storage/triangular_matrix.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <limits>
 
 namespace algebra::generic::math {
 
@@ -273,6 +285,216 @@ set_inplace_product_left_transpose(MA &A, const MB &B) requires(
   }
 }
 
+// Set matrix C to the product AB, where A is a lazy transpose: Use the loop
+// order of the A^TB product on the transposed matrix
+template <concepts::matrix MC, typename MA, concepts::matrix MB>
+requires algebra::concepts::matrix_multipliable_into<
+    algebra::storage::transpose_view<MA>, MB, MC>
+    ALGEBRA_HOST_DEVICE constexpr void set_product(
+        MC &C, const algebra::storage::transpose_view<MA> &A, const MB &B) {
+  set_product_left_transpose(C, A.matrix(), B);
+}
+
+// Set matrix C to the product AB, where B is a lazy transpose: Use the loop
+// order of the AB^T product on the transposed matrix
+template <concepts::matrix MC, concepts::matrix MA, typename MB>
+requires algebra::concepts::matrix_multipliable_into<
+    MA, algebra::storage::transpose_view<MB>, MC>
+    ALGEBRA_HOST_DEVICE constexpr void set_product(
+        MC &C, const MA &A, const algebra::storage::transpose_view<MB> &B) {
+  set_product_right_transpose(C, A, B.matrix());
+}
+
+// Set matrix C to the product AB, where A and B are lazy transposes
+template <concepts::matrix MC, typename MA, typename MB>
+requires algebra::concepts::matrix_multipliable_into<
+    algebra::storage::transpose_view<MA>,
+    algebra::storage::transpose_view<MB>, MC>
+    ALGEBRA_HOST_DEVICE constexpr void set_product(
+        MC &C, const algebra::storage::transpose_view<MA> &A,
+        const algebra::storage::transpose_view<MB> &B) {
+  set_product_left_transpose(C, A.matrix(), B);
+}
+
+// Set matrix A to the product AB in place, where B is a lazy transpose
+template <concepts::matrix MA, typename MB>
+requires algebra::concepts::matrix_multipliable_into<
+    MA, algebra::storage::transpose_view<MB>, MA>
+    ALGEBRA_HOST_DEVICE constexpr void set_inplace_product_right(
+        MA &A, const algebra::storage::transpose_view<MB> &B) {
+  set_inplace_product_right_transpose(A, B.matrix());
+}
+
+// Set matrix A to the product BA in place, where B is a lazy transpose
+template <concepts::matrix MA, typename MB>
+requires algebra::concepts::matrix_multipliable_into<
+    algebra::storage::transpose_view<MB>, MA, MA>
+    ALGEBRA_HOST_DEVICE constexpr void set_inplace_product_left(
+        MA &A, const algebra::storage::transpose_view<MB> &B) {
+  set_inplace_product_left_transpose(A, B.matrix());
+}
+
+// Set matrix C to the product AB, where A is diagonal: Scale the rows of B
+template <concepts::matrix MC, typename MA, concepts::matrix MB>
+requires algebra::concepts::matrix_multipliable_into<
+    algebra::storage::diagonal_matrix<MA>, MB, MC>
+    ALGEBRA_HOST_DEVICE constexpr void set_product(
+        MC &C, const algebra::storage::diagonal_matrix<MA> &A, const MB &B) {
+  using index_t = algebra::traits::index_t<MC>;
+
+  for (index_t j = 0; j < algebra::traits::columns<MC>; ++j) {
+    for (index_t i = 0; i < algebra::traits::rows<MC>; ++i) {
+      algebra::traits::element_getter_t<MC>()(C, i, j) =
+          A[i] * algebra::traits::element_getter_t<MB>()(B, i, j);
+    }
+  }
+}
+
+// Set matrix C to the product AB, where B is diagonal: Scale the columns of A
+template <concepts::matrix MC, concepts::matrix MA, typename MB>
+requires algebra::concepts::matrix_multipliable_into<
+    MA, algebra::storage::diagonal_matrix<MB>, MC>
+    ALGEBRA_HOST_DEVICE constexpr void set_product(
+        MC &C, const MA &A, const algebra::storage::diagonal_matrix<MB> &B) {
+  using index_t = algebra::traits::index_t<MC>;
+
+  for (index_t j = 0; j < algebra::traits::columns<MC>; ++j) {
+    for (index_t i = 0; i < algebra::traits::rows<MC>; ++i) {
+      algebra::traits::element_getter_t<MC>()(C, i, j) =
+          algebra::traits::element_getter_t<MA>()(A, i, j) * B[j];
+    }
+  }
+}
+
+// Set matrix C to the product AB, where A and B are diagonal
+template <concepts::matrix MC, typename MA, typename MB>
+requires algebra::concepts::matrix_multipliable_into<
+    algebra::storage::diagonal_matrix<MA>,
+    algebra::storage::diagonal_matrix<MB>, MC>
+    ALGEBRA_HOST_DEVICE constexpr void set_product(
+        MC &C, const algebra::storage::diagonal_matrix<MA> &A,
+        const algebra::storage::diagonal_matrix<MB> &B) {
+  using index_t = algebra::traits::index_t<MC>;
+
+  for (index_t j = 0; j < algebra::traits::columns<MC>; ++j) {
+    for (index_t i = 0; i < algebra::traits::rows<MC>; ++i) {
+      algebra::traits::element_getter_t<MC>()(C, i, j) =
+          (i == j) ? A[i] * B[i] : algebra::traits::scalar_t<MC>(0);
+    }
+  }
+}
+
+// Set matrix A to the product AB in place, where B is diagonal
+template <concepts::matrix MA, typename MB>
+requires algebra::concepts::matrix_multipliable_into<
+    MA, algebra::storage::diagonal_matrix<MB>, MA>
+    ALGEBRA_HOST_DEVICE constexpr void set_inplace_product_right(
+        MA &A, const algebra::storage::diagonal_matrix<MB> &B) {
+  using index_t = algebra::traits::index_t<MA>;
+
+  for (index_t j = 0; j < algebra::traits::columns<MA>; ++j) {
+    for (index_t i = 0; i < algebra::traits::rows<MA>; ++i) {
+      algebra::traits::element_getter_t<MA>()(A, i, j) *= B[j];
+    }
+  }
+}
+
+// Set matrix A to the product BA in place, where B is diagonal
+template <concepts::matrix MA, typename MB>
+requires algebra::concepts::matrix_multipliable_into<
+    algebra::storage::diagonal_matrix<MB>, MA, MA>
+    ALGEBRA_HOST_DEVICE constexpr void set_inplace_product_left(
+        MA &A, const algebra::storage::diagonal_matrix<MB> &B) {
+  using index_t = algebra::traits::index_t<MA>;
+
+  for (index_t j = 0; j < algebra::traits::columns<MA>; ++j) {
+    for (index_t i = 0; i < algebra::traits::rows<MA>; ++i) {
+      algebra::traits::element_getter_t<MA>()(A, i, j) *= B[i];
+    }
+  }
+}
+
+/// @returns the determinant of the diagonal matrix @param m
+template <typename M>
+ALGEBRA_HOST_DEVICE constexpr algebra::traits::scalar_t<M> determinant(
+    const algebra::storage::diagonal_matrix<M> &m) {
+  return algebra::storage::determinant(m);
+}
+
+/// @returns the inverse of the diagonal matrix @param m
+template <typename M>
+ALGEBRA_HOST_DEVICE constexpr algebra::storage::diagonal_matrix<M> inverse(
+    const algebra::storage::diagonal_matrix<M> &m) {
+  return algebra::storage::inverse(m);
+}
+
+/// @returns the transpose of the diagonal matrix @param m
+template <typename M>
+ALGEBRA_HOST_DEVICE constexpr algebra::storage::diagonal_matrix<M> transpose(
+    const algebra::storage::diagonal_matrix<M> &m) {
+  return m;
+}
+
+// Set matrix C to the product AB, where A is a projection: Gather the rows
+// of B (or scatter them for the transposed projection)
+template <concepts::matrix MC, typename MA, bool TRANSPOSED,
+          concepts::matrix MB>
+requires algebra::concepts::matrix_multipliable_into<
+    algebra::storage::projection_matrix<MA, TRANSPOSED>, MB, MC>
+    ALGEBRA_HOST_DEVICE constexpr void set_product(
+        MC &C, const algebra::storage::projection_matrix<MA, TRANSPOSED> &A,
+        const MB &B) {
+  algebra::storage::detail::set_projected_rows(C, A, B);
+}
+
+// Set matrix C to the product AB, where B is a projection: Scatter the
+// columns of A (or gather them for the transposed projection)
+template <concepts::matrix MC, concepts::matrix MA, typename MB,
+          bool TRANSPOSED>
+requires algebra::concepts::matrix_multipliable_into<
+    MA, algebra::storage::projection_matrix<MB, TRANSPOSED>, MC>
+    ALGEBRA_HOST_DEVICE constexpr void set_product(
+        MC &C, const MA &A,
+        const algebra::storage::projection_matrix<MB, TRANSPOSED> &B) {
+  algebra::storage::detail::set_projected_columns(C, A, B);
+}
+
+/// @returns the transpose of the projection matrix @param m
+template <typename M, bool TRANSPOSED>
+ALGEBRA_HOST_DEVICE constexpr auto transpose(
+    const algebra::storage::projection_matrix<M, TRANSPOSED> &m) {
+  return algebra::storage::transpose(m);
+}
+
+/// Triangular matrix-matrix and matrix-vector products and solvers
+/// @{
+using algebra::storage::solve_lower;
+using algebra::storage::solve_upper;
+using algebra::storage::trmm;
+using algebra::storage::trmv;
+/// @}
+
+/// @returns the determinant of the triangular matrix @param m
+template <typename M, bool UPPER>
+ALGEBRA_HOST_DEVICE constexpr algebra::traits::scalar_t<M> determinant(
+    const algebra::storage::triangular_matrix<M, UPPER> &m) {
+  return algebra::storage::determinant(m);
+}
+
+/// @returns the inverse of the triangular matrix @param m
+template <typename M, bool UPPER>
+ALGEBRA_HOST_DEVICE constexpr algebra::storage::triangular_matrix<M, UPPER>
+inverse(const algebra::storage::triangular_matrix<M, UPPER> &m) {
+  return algebra::storage::inverse(m);
+}
+
+/// @returns the transpose of the triangular matrix @param m
+template <typename M, bool UPPER>
+ALGEBRA_HOST_DEVICE constexpr algebra::storage::triangular_matrix<M, !UPPER>
+transpose(const algebra::storage::triangular_matrix<M, UPPER> &m) {
+  return algebra::storage::transpose(m);
+}
+
 /// @returns the determinant of @param m
 template <concepts::square_matrix M>
 ALGEBRA_HOST_DEVICE constexpr algebra::traits::scalar_t<M> determinant(
@@ -281,11 +503,141 @@ ALGEBRA_HOST_DEVICE constexpr algebra::traits::scalar_t<M> determinant(
   return determinant_t<M>{}(m);
 }
 
-/// @returns the determinant of @param m
+/// @returns the determinant of @param m, computed with the algorithm given by
+/// the policy @tparam policy_t
+template <concepts::square_matrix M,
+          generic::matrix::policy::algorithm_policy policy_t>
+ALGEBRA_HOST_DEVICE constexpr algebra::traits::scalar_t<M> determinant(
+    const M &m, policy_t) {
+
+  return determinant_t<M, policy_t>{}(m);
+}
+
+/// @returns the inverse of @param m
 template <concepts::square_matrix M>
-ALGEBRA_HOST_DEVICE constexpr M inverse(const M &m) {
+ALGEBRA_HOST_DEVICE constexpr algebra::traits::matrix_t<M> inverse(
+    const M &m) {
 
   return inversion_t<M>{}(m);
 }
 
+/// @returns the inverse of @param m, computed with the algorithm given by the
+/// policy @tparam policy_t
+template <concepts::square_matrix M,
+          generic::matrix::policy::algorithm_policy policy_t>
+ALGEBRA_HOST_DEVICE constexpr algebra::traits::matrix_t<M> inverse(
+    const M &m, policy_t) {
+
+  return inversion_t<M, policy_t>{}(m);
+}
+
+/// @returns the least squares solution x of the (overdetermined) system
+/// @param A * x = @param b, computed with a Householder QR decomposition of A
+/// instead of the normal equations, which would square its condition number
+template <concepts::matrix M, concepts::vector V>
+requires(algebra::traits::rows<M> >= algebra::traits::columns<M> &&
+         algebra::traits::rows<V> == algebra::traits::rows<M>)
+    ALGEBRA_HOST_DEVICE constexpr auto least_squares(const M &A, const V &b) {
+
+  using qr_t = algebra::generic::matrix::decomposition::householder_qr<
+      M, algebra::traits::element_getter_t<M>>;
+
+  return qr_t::solve(qr_t{}(A), b);
+}
+
+/// @returns the eigenvalues (in increasing order) and the eigenvectors (as
+/// columns) of the symmetric 2 X 2 or 3 X 3 matrix @param m
+template <concepts::square_matrix M>
+requires(algebra::traits::rank<M> == 2 || algebra::traits::rank<M> == 3)
+    ALGEBRA_HOST_DEVICE constexpr auto symmetric_eigen(const M &m) {
+
+  return algebra::generic::matrix::decomposition::symmetric_eigen<
+      M, algebra::traits::element_getter_t<M>>{}(m);
+}
+
+/// @returns the Moore-Penrose pseudo-inverse of @param m (with up to 8 rows
+/// or columns), computed with a one-sided Jacobi SVD
+///
+/// Singular values below @param rcond times the largest one are treated as
+/// zero, so that rank deficient matrices are inverted on their range instead
+/// of dividing by a vanishing pivot.
+template <concepts::matrix M>
+requires(std::min(algebra::traits::rows<M>, algebra::traits::columns<M>) <= 8)
+    ALGEBRA_HOST_DEVICE constexpr auto pseudo_inverse(
+        const M &m, const algebra::traits::value_t<M> rcond) {
+
+  if constexpr (algebra::traits::rows<M> >= algebra::traits::columns<M>) {
+    using svd_t = algebra::generic::matrix::decomposition::jacobi_svd<
+        M, algebra::traits::element_getter_t<M>>;
+
+    return svd_t::pseudo_inverse(svd_t{}(m), rcond);
+  } else {
+    // pinv(A) = pinv(A^T)^T
+    return transpose(pseudo_inverse(transpose(m), rcond));
+  }
+}
+
+/// @returns the Moore-Penrose pseudo-inverse of @param m, treating the
+/// singular values below max(rows, columns) * epsilon times the largest one
+/// as zero
+template <concepts::matrix M>
+requires(std::min(algebra::traits::rows<M>, algebra::traits::columns<M>) <= 8)
+    ALGEBRA_HOST_DEVICE constexpr auto pseudo_inverse(const M &m) {
+
+  using value_t = algebra::traits::value_t<M>;
+
+  constexpr auto n{
+      std::max(algebra::traits::rows<M>, algebra::traits::columns<M>)};
+
+  return pseudo_inverse(
+      m, static_cast<value_t>(n) * std::numeric_limits<value_t>::epsilon());
+}
+
+/// @returns the condition number sigma_max / sigma_min (in the 2-norm) of
+/// @param m (with up to 8 rows or columns), which is infinite for rank
+/// deficient matrices
+template <concepts::matrix M>
+requires(std::min(algebra::traits::rows<M>, algebra::traits::columns<M>) <= 8)
+    ALGEBRA_HOST_DEVICE constexpr auto condition_number(const M &m) {
+
+  if constexpr (algebra::traits::rows<M> >= algebra::traits::columns<M>) {
+    using svd_t = algebra::generic::matrix::decomposition::jacobi_svd<
+        M, algebra::traits::element_getter_t<M>>;
+
+    return svd_t::condition_number(svd_t{}(m));
+  } else {
+    return condition_number(transpose(m));
+  }
+}
+
+/// Similarity transforms with block diagonal matrices
+using algebra::storage::similarity;
+
+/// @returns the determinant of the block diagonal matrix @param m, i.e. the
+/// product of the determinants of its blocks
+template <typename... block_ts>
+ALGEBRA_HOST_DEVICE constexpr auto determinant(
+    const algebra::storage::block_diagonal_matrix<block_ts...> &m) {
+  return algebra::storage::detail::blockwise_product(
+      m, [](const auto &b) { return determinant(b); });
+}
+
+/// @returns the inverse of the block diagonal matrix @param m, which is
+/// computed block by block
+template <typename... block_ts>
+ALGEBRA_HOST_DEVICE constexpr algebra::storage::block_diagonal_matrix<
+    block_ts...>
+inverse(const algebra::storage::block_diagonal_matrix<block_ts...> &m) {
+  return algebra::storage::detail::blockwise(
+      m, [](const auto &b) { return inverse(b); });
+}
+
+/// @returns the transpose of the block diagonal matrix @param m
+template <typename... block_ts>
+ALGEBRA_HOST_DEVICE constexpr algebra::storage::block_diagonal_matrix<
+    block_ts...>
+transpose(const algebra::storage::block_diagonal_matrix<block_ts...> &m) {
+  return algebra::storage::transpose(m);
+}
+
 }  // namespace algebra::generic::math
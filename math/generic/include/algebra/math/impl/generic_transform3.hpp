@@ -11,11 +11,13 @@
 #include "algebra/math/algorithms/matrix/inverse/hard_coded.hpp"
 #include "algebra/math/impl/generic_matrix.hpp"
 #include "algebra/math/impl/generic_vector.hpp"
+#include "algebra/math/rotation.hpp"
 #include "algebra/qualifiers.hpp"
 #include "algebra/type_traits.hpp"
 #include "algebra/utils/approximately_equal.hpp"
 
 // System include(s)
+#include <array>
 #include <cassert>
 #include <concepts>
 #include <limits>
@@ -208,6 +210,68 @@ struct transform3 {
     _data_inv = matrix_inversion{}(_data);
   }
 
+  /// Rotation by @param angle around the unit vector @param axis
+  ///
+  /// @note the inverse is the transposed rotation, no inversion is needed
+  ALGEBRA_HOST_DEVICE
+  static constexpr transform3 rotation_from_axis_angle(
+      const vector3 &axis, const scalar_type angle) {
+    return from_rotation(algebra::math::rotation_from_axis_angle(
+        element_getter{}(axis, 0), element_getter{}(axis, 1),
+        element_getter{}(axis, 2), angle));
+  }
+
+  /// Rotation R_z(@param gamma) * R_y(@param beta) * R_x(@param alpha)
+  ///
+  /// @note the inverse is the transposed rotation, no inversion is needed
+  ALGEBRA_HOST_DEVICE
+  static constexpr transform3 rotation_from_euler(const scalar_type alpha,
+                                                  const scalar_type beta,
+                                                  const scalar_type gamma) {
+    return from_rotation(
+        algebra::math::rotation_from_euler(alpha, beta, gamma));
+  }
+
+  /// Apply an alignment correction: Rotate the frame around its origin by
+  /// the rotation vector @param domega and shift it by @param dt (both in
+  /// global coordinates)
+  ///
+  /// The inverse is updated with the transposed correction, instead of being
+  /// recomputed: (dR * R)^-1 = R^-1 * dR^T
+  ALGEBRA_HOST_DEVICE
+  constexpr void apply_delta(const vector3 &dt, const vector3 &domega) {
+
+    constexpr element_getter elem{};
+
+    const auto dr = algebra::math::rotation_from_rotation_vector(
+        elem(domega, 0), elem(domega, 1), elem(domega, 2));
+
+    for (index_t j = 0; j < 3; ++j) {
+      const std::array<scalar_type, 3> col{elem(_data, 0, j),
+                                           elem(_data, 1, j),
+                                           elem(_data, 2, j)};
+      for (index_t i = 0; i < 3; ++i) {
+        elem(_data, i, j) =
+            dr[0][i] * col[0] + dr[1][i] * col[1] + dr[2][i] * col[2];
+      }
+    }
+    for (index_t i = 0; i < 3; ++i) {
+      elem(_data, i, 3) += elem(dt, i);
+    }
+
+    for (index_t i = 0; i < 3; ++i) {
+      const std::array<scalar_type, 3> row{
+          elem(_data_inv, i, 0), elem(_data_inv, i, 1), elem(_data_inv, i, 2)};
+      for (index_t j = 0; j < 3; ++j) {
+        elem(_data_inv, i, j) =
+            row[0] * dr[0][j] + row[1] * dr[1][j] + row[2] * dr[2][j];
+      }
+      elem(_data_inv, i, 3) = -(elem(_data_inv, i, 0) * elem(_data, 0, 3) +
+                                elem(_data_inv, i, 1) * elem(_data, 1, 3) +
+                                elem(_data_inv, i, 2) * elem(_data, 2, 3));
+    }
+  }
+
   /// Equality operator
   ALGEBRA_HOST_DEVICE
   constexpr bool operator==(const transform3 &rhs) const {
@@ -336,6 +400,22 @@ struct transform3 {
     return rotate(_data_inv, v);
   }
 
+ private:
+  /// @returns the transform for the rotation matrix with the columns @param r
+  ALGEBRA_HOST_DEVICE
+  static constexpr transform3 from_rotation(
+      const algebra::math::rotation3<scalar_type> &r) {
+
+    transform3 trf{};
+    for (index_t j = 0; j < 3; ++j) {
+      for (index_t i = 0; i < 3; ++i) {
+        element_getter{}(trf._data, i, j) = r[j][i];
+        element_getter{}(trf._data_inv, j, i) = r[j][i];
+      }
+    }
+
+    return trf;
+  }
 };  // struct transform3
 
 }  // namespace algebra::generic::math
@@ -10,6 +10,8 @@
 // Project include(s).
 #include "algebra/concepts.hpp"
 #include "algebra/math/common.hpp"
+#include "algebra/math/precision.hpp"
+#include "algebra/math/vec.hpp"
 #include "algebra/qualifiers.hpp"
 #include "algebra/type_traits.hpp"
 
@@ -28,6 +30,23 @@ ALGEBRA_HOST_DEVICE constexpr algebra::traits::scalar_t<vector_t> phi(
                               element_getter_t{}(v, 0));
 }
 
+/// This method retrieves phi from a vector with rows >= 2
+///
+/// @param v the input vector
+template <concepts::vector vector_t, concepts::precision_policy precision_t>
+ALGEBRA_HOST_DEVICE constexpr algebra::traits::scalar_t<vector_t> phi(
+    const vector_t &v, precision_t) noexcept {
+
+  if constexpr (std::same_as<precision_t, precision::fast>) {
+    using element_getter_t = algebra::traits::element_getter_t<vector_t>;
+
+    return algebra::math::vec::atan2(element_getter_t{}(v, 1),
+                                     element_getter_t{}(v, 0));
+  } else {
+    return phi(v);
+  }
+}
+
 /// This method retrieves the perpendicular magnitude of a vector with rows >= 2
 ///
 /// @param v the input vector
@@ -54,6 +73,22 @@ ALGEBRA_HOST_DEVICE constexpr algebra::traits::scalar_t<vector_t> theta(
   return algebra::math::atan2(perp(v), element_getter_t{}(v, 2));
 }
 
+/// This method retrieves theta from a vector with rows >= 3
+///
+/// @param v the input vector
+template <concepts::vector vector_t, concepts::precision_policy precision_t>
+ALGEBRA_HOST_DEVICE constexpr algebra::traits::scalar_t<vector_t> theta(
+    const vector_t &v, precision_t) noexcept {
+
+  if constexpr (std::same_as<precision_t, precision::fast>) {
+    using element_getter_t = algebra::traits::element_getter_t<vector_t>;
+
+    return algebra::math::vec::atan2(perp(v), element_getter_t{}(v, 2));
+  } else {
+    return theta(v);
+  }
+}
+
 /// Cross product between two input vectors - 3 Dim
 ///
 /// @tparam vector1_t first vector or column matrix type
@@ -134,6 +169,25 @@ ALGEBRA_HOST_DEVICE constexpr algebra::traits::scalar_t<vector_t> eta(
   return algebra::math::atanh(element_getter_t{}(v, 2) / norm(v));
 }
 
+/// This method retrieves the pseudo-rapidity from a vector or vector base with
+/// rows >= 3
+///
+/// @param v the input vector
+/// @param p the precision policy
+template <concepts::vector vector_t, concepts::precision_policy precision_t>
+ALGEBRA_HOST_DEVICE constexpr algebra::traits::scalar_t<vector_t> eta(
+    const vector_t &v, precision_t p) noexcept {
+
+  if constexpr (std::same_as<precision_t, precision::fast>) {
+    using element_getter_t = algebra::traits::element_getter_t<vector_t>;
+
+    return algebra::math::vec::atanh(element_getter_t{}(v, 2) *
+                                     algebra::math::rsqrt(dot(v, v), p));
+  } else {
+    return eta(v);
+  }
+}
+
 /// Get a normalized version of the input vector
 ///
 /// @tparam vector_t vector or column matrix type
@@ -0,0 +1,331 @@
+/** Algebra plugins library, part of the ACTS project
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "algebra/concepts.hpp"
+#include "algebra/math/common.hpp"
+#include "algebra/math/vec.hpp"
+#include "algebra/qualifiers.hpp"
+#include "algebra/type_traits.hpp"
+
+// System include(s).
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <numbers>
+
+/// Straight line and circle fits to small sets of hits (e.g. for seeding)
+///
+/// The fits are closed-form least squares fits with equal weights for all
+/// hits, i.e. the covariances are given in units of the variance of the hit
+/// coordinates.
+///
+/// The kernels are generic in the linear algebra types: For the @c vc_soa
+/// plugin, the hits hold the points of a batch of candidates (one per simd
+/// lane), which are fitted at once.
+///
+/// @note Include this after the frontend of the plugin, so that its overloads
+/// of @c algebra::math::sincos, @c algebra::math::atan2 and
+/// @c algebra::matrix::inverse are visible.
+namespace algebra::kernels {
+
+/// Indices of the straight line parameters
+enum line_indices : unsigned int {
+  e_line_x0 = 0u,
+  e_line_y0 = 1u,
+  e_line_tx = 2u,
+  e_line_ty = 3u,
+  e_line_size = 4u,
+};
+
+/// Indices of the circle parameters
+enum circle_indices : unsigned int {
+  e_circle_rho = 0u,
+  e_circle_phi = 1u,
+  e_circle_d0 = 2u,
+  e_circle_size = 3u,
+};
+
+/// Straight line fit x = x0 + tx * z, y = y0 + ty * z to 3D hits
+///
+/// The line is parametrized along the z axis: Lines in other directions can
+/// be fitted to the hits in a suitable local frame. If all hits have the same
+/// z (within the rounding errors), the slopes are undefined: They are set to
+/// zero, with an infinite variance and chi2.
+///
+/// @param hits the hits
+/// @param cov the 4x4 covariance of the line parameters (output)
+/// @param chi2 the sum of the squared residuals in x and y (output)
+///
+/// @returns the line parameters (4x1)
+template <concepts::point3D point3_t, std::size_t N,
+          concepts::square_matrix covariance_t>
+ALGEBRA_HOST_DEVICE constexpr auto line_fit(
+    const std::array<point3_t, N> &hits, covariance_t &cov,
+    algebra::traits::scalar_t<covariance_t> &chi2) {
+
+  static_assert(N >= 2u, "A straight line needs at least two hits");
+  static_assert(algebra::traits::rank<covariance_t> == e_line_size);
+
+  using value_t = algebra::traits::value_t<covariance_t>;
+  using scalar_t = algebra::traits::scalar_t<covariance_t>;
+  using element_getter_t = algebra::traits::element_getter_t<covariance_t>;
+  using line_vector_t =
+      algebra::traits::get_matrix_t<covariance_t, e_line_size, 1, value_t>;
+  using ops = algebra::math::vec::simd_ops<scalar_t>;
+
+  constexpr element_getter_t elem{};
+
+  const scalar_t zero{static_cast<value_t>(0)};
+  const scalar_t one{static_cast<value_t>(1)};
+  const scalar_t inv_n{one / static_cast<value_t>(N)};
+  const scalar_t eps{static_cast<value_t>(4) *
+                     std::numeric_limits<value_t>::epsilon()};
+  const scalar_t inf{std::numeric_limits<value_t>::infinity()};
+
+  // Centroid of the hits
+  scalar_t mean_x{zero};
+  scalar_t mean_y{zero};
+  scalar_t mean_z{zero};
+  for (std::size_t i = 0u; i < N; ++i) {
+    mean_x += hits[i][0];
+    mean_y += hits[i][1];
+    mean_z += hits[i][2];
+  }
+  mean_x *= inv_n;
+  mean_y *= inv_n;
+  mean_z *= inv_n;
+
+  // The normal equations decouple for the centered hits
+  scalar_t s_zz{zero};
+  scalar_t s_xz{zero};
+  scalar_t s_yz{zero};
+  for (std::size_t i = 0u; i < N; ++i) {
+    const scalar_t dz{hits[i][2] - mean_z};
+    s_zz += dz * dz;
+    s_xz += dz * (hits[i][0] - mean_x);
+    s_yz += dz * (hits[i][1] - mean_y);
+  }
+
+  // The spread in z has to exceed the rounding errors of the centering
+  const auto valid =
+      s_zz > static_cast<value_t>(N) * eps * eps * mean_z * mean_z;
+  const scalar_t inv_s_zz{
+      ops::select(valid, one / ops::select(valid, s_zz, one), zero)};
+
+  const scalar_t tx{s_xz * inv_s_zz};
+  const scalar_t ty{s_yz * inv_s_zz};
+  const scalar_t x0{mean_x - tx * mean_z};
+  const scalar_t y0{mean_y - ty * mean_z};
+
+  line_vector_t line_vec;
+  elem(line_vec, e_line_x0, 0) = x0;
+  elem(line_vec, e_line_y0, 0) = y0;
+  elem(line_vec, e_line_tx, 0) = tx;
+  elem(line_vec, e_line_ty, 0) = ty;
+
+  chi2 = zero;
+  for (std::size_t i = 0u; i < N; ++i) {
+    const scalar_t res_x{hits[i][0] - x0 - tx * hits[i][2]};
+    const scalar_t res_y{hits[i][1] - y0 - ty * hits[i][2]};
+    chi2 += res_x * res_x + res_y * res_y;
+  }
+  chi2 = ops::select(valid, chi2, inf);
+
+  // Covariance: The same 2x2 block for (x0, tx) and (y0, ty)
+  const scalar_t var_0{inv_n + mean_z * mean_z * inv_s_zz};
+  const scalar_t cov_0t{-mean_z * inv_s_zz};
+
+  for (unsigned int j = 0u; j < e_line_size; ++j) {
+    for (unsigned int i = 0u; i < e_line_size; ++i) {
+      elem(cov, i, j) = zero;
+    }
+  }
+  for (unsigned int i = 0u; i < 2u; ++i) {
+    elem(cov, e_line_x0 + i, e_line_x0 + i) = var_0;
+    elem(cov, e_line_x0 + i, e_line_tx + i) = cov_0t;
+    elem(cov, e_line_tx + i, e_line_x0 + i) = cov_0t;
+    elem(cov, e_line_tx + i, e_line_tx + i) = ops::select(valid, inv_s_zz, inf);
+  }
+
+  return line_vec;
+}
+
+/// Circle fit to 2D hits, e.g. in the transverse plane (Karimaki's method)
+///
+/// Like the Kasa fit, this minimizes the algebraic distances of the hits to
+/// the circle, which leads to a closed-form solution. The circle is given by
+/// the signed curvature rho, the direction phi at the point of closest
+/// approach to the origin and the signed distance d0 of this point to the
+/// origin (V. Karimaki, NIM A 305 (1991) 187). This parametrization is
+/// continuous in rho = 0 (straight lines). The direction is chosen to point
+/// from the first to the last hit.
+///
+/// The center of the circle is at (sin(phi), -cos(phi)) * (1 / rho + d0), so
+/// rho is negative for hits that bend counterclockwise.
+///
+/// If all hits have the same distance to the origin (within the rounding
+/// errors), e.g. for a circle around the origin, the point of closest approach
+/// is undefined: The result is the straight line through the centroid of the
+/// hits (rho = 0), with an infinite chi2.
+///
+/// @param hits the hits
+/// @param cov the 3x3 covariance of the circle parameters (output)
+/// @param chi2 the sum of the squared residuals (output)
+///
+/// @returns the circle parameters (3x1)
+template <concepts::point2D point2_t, std::size_t N,
+          concepts::square_matrix covariance_t>
+ALGEBRA_HOST_DEVICE constexpr auto circle_fit(
+    const std::array<point2_t, N> &hits, covariance_t &cov,
+    algebra::traits::scalar_t<covariance_t> &chi2) {
+
+  static_assert(N >= 3u, "A circle needs at least three hits");
+  static_assert(algebra::traits::rank<covariance_t> == e_circle_size);
+
+  using value_t = algebra::traits::value_t<covariance_t>;
+  using scalar_t = algebra::traits::scalar_t<covariance_t>;
+  using element_getter_t = algebra::traits::element_getter_t<covariance_t>;
+  using circle_vector_t =
+      algebra::traits::get_matrix_t<covariance_t, e_circle_size, 1, value_t>;
+  using ops = algebra::math::vec::simd_ops<scalar_t>;
+
+  constexpr element_getter_t elem{};
+
+  const scalar_t zero{static_cast<value_t>(0)};
+  const scalar_t half{static_cast<value_t>(0.5)};
+  const scalar_t one{static_cast<value_t>(1)};
+  const scalar_t two{static_cast<value_t>(2)};
+  const scalar_t four{static_cast<value_t>(4)};
+  const scalar_t pi{std::numbers::pi_v<value_t>};
+  const scalar_t inv_n{one / static_cast<value_t>(N)};
+  const scalar_t eps{four * std::numeric_limits<value_t>::epsilon()};
+  const scalar_t inf{std::numeric_limits<value_t>::infinity()};
+
+  // Squared radii of the hits
+  std::array<scalar_t, N> r2;
+  for (std::size_t i = 0u; i < N; ++i) {
+    r2[i] = hits[i][0] * hits[i][0] + hits[i][1] * hits[i][1];
+  }
+
+  scalar_t mean_x{zero};
+  scalar_t mean_y{zero};
+  scalar_t mean_r2{zero};
+  for (std::size_t i = 0u; i < N; ++i) {
+    mean_x += hits[i][0];
+    mean_y += hits[i][1];
+    mean_r2 += r2[i];
+  }
+  mean_x *= inv_n;
+  mean_y *= inv_n;
+  mean_r2 *= inv_n;
+
+  // (Co)variances of x, y and r^2, summed in a second pass to avoid the
+  // cancellation in <r^4> - <r^2>^2
+  scalar_t c_xx{zero};
+  scalar_t c_xy{zero};
+  scalar_t c_yy{zero};
+  scalar_t c_xr{zero};
+  scalar_t c_yr{zero};
+  scalar_t c_rr{zero};
+  for (std::size_t i = 0u; i < N; ++i) {
+    const scalar_t dx{hits[i][0] - mean_x};
+    const scalar_t dy{hits[i][1] - mean_y};
+    const scalar_t dr2{r2[i] - mean_r2};
+    c_xx += dx * dx;
+    c_xy += dx * dy;
+    c_yy += dy * dy;
+    c_xr += dx * dr2;
+    c_yr += dy * dr2;
+    c_rr += dr2 * dr2;
+  }
+  c_xx *= inv_n;
+  c_xy *= inv_n;
+  c_yy *= inv_n;
+  c_xr *= inv_n;
+  c_yr *= inv_n;
+  c_rr *= inv_n;
+
+  // Direction: tan(2 * phi) = 2 * q1 / q2, which fixes phi up to pi
+  const scalar_t q1{c_rr * c_xy - c_xr * c_yr};
+  const scalar_t q2{c_rr * (c_xx - c_yy) - c_xr * c_xr + c_yr * c_yr};
+
+  scalar_t phi{half * algebra::math::atan2(two * q1, q2)};
+  auto [sin_phi, cos_phi] = algebra::math::sincos(phi);
+
+  // Point the direction along the hits
+  const scalar_t dx_hits{hits[N - 1u][0] - hits[0][0]};
+  const scalar_t dy_hits{hits[N - 1u][1] - hits[0][1]};
+  const auto flip = cos_phi * dx_hits + sin_phi * dy_hits < zero;
+  phi = ops::select(flip, phi - ops::copysign(pi, phi), phi);
+  sin_phi = ops::select(flip, -sin_phi, sin_phi);
+  cos_phi = ops::select(flip, -cos_phi, cos_phi);
+
+  // The spread of the squared radii has to exceed their rounding errors
+  const auto valid = c_rr > eps * eps * mean_r2 * mean_r2;
+  const scalar_t kappa{
+      ops::select(valid,
+                  (sin_phi * c_xr - cos_phi * c_yr) /
+                      ops::select(valid, c_rr, one),
+                  zero)};
+  const scalar_t delta{-kappa * mean_r2 + sin_phi * mean_x - cos_phi * mean_y};
+  const scalar_t root{ops::sqrt(one - four * delta * kappa)};
+
+  const scalar_t rho{two * kappa / root};
+  const scalar_t d0{two * delta / (one + root)};
+
+  circle_vector_t circle_vec;
+  elem(circle_vec, e_circle_rho, 0) = rho;
+  elem(circle_vec, e_circle_phi, 0) = phi;
+  elem(circle_vec, e_circle_d0, 0) = d0;
+
+  // Residuals and normal matrix of the linearized problem
+  const scalar_t one_rho_d0{one + rho * d0};
+  const scalar_t half_d0_2{half * d0 * d0};
+
+  for (unsigned int j = 0u; j < e_circle_size; ++j) {
+    for (unsigned int i = 0u; i < e_circle_size; ++i) {
+      elem(cov, i, j) = zero;
+    }
+  }
+
+  std::array<scalar_t, e_circle_size> jac;
+
+  chi2 = zero;
+  for (std::size_t n = 0u; n < N; ++n) {
+    const scalar_t u{hits[n][0] * sin_phi - hits[n][1] * cos_phi};
+    const scalar_t v{hits[n][0] * cos_phi + hits[n][1] * sin_phi};
+
+    const scalar_t res{half * rho * r2[n] - one_rho_d0 * u + rho * half_d0_2 +
+                       d0};
+    chi2 += res * res;
+
+    jac[e_circle_rho] = half * r2[n] - d0 * u + half_d0_2;
+    jac[e_circle_phi] = -one_rho_d0 * v;
+    jac[e_circle_d0] = one_rho_d0 - rho * u;
+
+    for (unsigned int j = 0u; j < e_circle_size; ++j) {
+      for (unsigned int i = j; i < e_circle_size; ++i) {
+        elem(cov, i, j) += jac[i] * jac[j];
+      }
+    }
+  }
+  chi2 = ops::select(valid, chi2, inf);
+
+  for (unsigned int j = 0u; j < e_circle_size; ++j) {
+    for (unsigned int i = j + 1u; i < e_circle_size; ++i) {
+      elem(cov, j, i) = elem(cov, i, j);
+    }
+  }
+  cov = algebra::matrix::inverse(cov);
+
+  return circle_vec;
+}
+
+}  // namespace algebra::kernels
@@ -0,0 +1,222 @@
+/** Algebra plugins library, part of the ACTS project
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "algebra/concepts.hpp"
+#include "algebra/math/common.hpp"
+#include "algebra/qualifiers.hpp"
+#include "algebra/type_traits.hpp"
+
+/// Conversions between the bound and the free track parametrization
+///
+/// The bound parameters are given on a planar surface, whose local x and y
+/// axes (the first two columns of its placement @c transform3) span the
+/// surface plane. The direction angles are global.
+///
+/// The kernels are generic in the linear algebra types: For the @c vc_soa
+/// plugin, they convert a batch of tracks (one per simd lane) at once.
+///
+/// @note Include this after the frontend of the plugin, so that its overloads
+/// of @c algebra::math::sincos and @c algebra::math::atan2 are visible.
+namespace algebra::kernels {
+
+/// Indices of the bound track parameters
+enum bound_indices : unsigned int {
+  e_bound_loc0 = 0u,
+  e_bound_loc1 = 1u,
+  e_bound_phi = 2u,
+  e_bound_theta = 3u,
+  e_bound_qoverp = 4u,
+  e_bound_time = 5u,
+  e_bound_size = 6u,
+};
+
+/// Indices of the free track parameters
+enum free_indices : unsigned int {
+  e_free_pos0 = 0u,
+  e_free_pos1 = 1u,
+  e_free_pos2 = 2u,
+  e_free_time = 3u,
+  e_free_dir0 = 4u,
+  e_free_dir1 = 5u,
+  e_free_dir2 = 6u,
+  e_free_qoverp = 7u,
+  e_free_size = 8u,
+};
+
+namespace detail {
+
+/// Set all elements of the matrix @param m to zero
+template <concepts::matrix matrix_t>
+ALGEBRA_HOST_DEVICE constexpr void set_zero(matrix_t &m) {
+
+  using index_t = algebra::traits::index_t<matrix_t>;
+  using element_getter_t = algebra::traits::element_getter_t<matrix_t>;
+
+  for (index_t j = 0; j < algebra::traits::columns<matrix_t>; ++j) {
+    for (index_t i = 0; i < algebra::traits::rows<matrix_t>; ++i) {
+      element_getter_t{}(m, i, j) = 0;
+    }
+  }
+}
+
+}  // namespace detail
+
+/// Convert bound to free track parameters
+///
+/// @param trf placement of the surface
+/// @param bound_vec bound track parameters (6x1)
+/// @param jac the 8x6 jacobian of the transformation (output)
+///
+/// @returns the free track parameters (8x1)
+template <concepts::transform3D transform3_t,
+          concepts::column_matrix bound_vector_t, concepts::matrix jacobian_t>
+ALGEBRA_HOST_DEVICE constexpr auto bound_to_free(
+    const transform3_t &trf, const bound_vector_t &bound_vec,
+    jacobian_t &jac) {
+
+  static_assert(algebra::traits::rows<bound_vector_t> == e_bound_size);
+  static_assert(algebra::traits::rows<jacobian_t> == e_free_size);
+  static_assert(algebra::traits::columns<jacobian_t> == e_bound_size);
+
+  using value_t = algebra::traits::value_t<bound_vector_t>;
+  using scalar_t = algebra::traits::scalar_t<bound_vector_t>;
+  using element_getter_t = algebra::traits::element_getter_t<bound_vector_t>;
+  using jac_element_getter_t = algebra::traits::element_getter_t<jacobian_t>;
+  using free_vector_t =
+      algebra::traits::get_matrix_t<bound_vector_t, e_free_size, 1, value_t>;
+
+  constexpr element_getter_t elem{};
+  constexpr jac_element_getter_t jac_elem{};
+
+  const auto [sin_phi, cos_phi] =
+      algebra::math::sincos(scalar_t{elem(bound_vec, e_bound_phi, 0)});
+  const auto [sin_theta, cos_theta] =
+      algebra::math::sincos(scalar_t{elem(bound_vec, e_bound_theta, 0)});
+
+  // Global position from the local position on the surface plane
+  const typename transform3_t::point3 pos = trf.point_to_global(
+      typename transform3_t::point3{elem(bound_vec, e_bound_loc0, 0),
+                                    elem(bound_vec, e_bound_loc1, 0),
+                                    scalar_t{0}});
+
+  free_vector_t free_vec;
+  elem(free_vec, e_free_pos0, 0) = pos[0];
+  elem(free_vec, e_free_pos1, 0) = pos[1];
+  elem(free_vec, e_free_pos2, 0) = pos[2];
+  elem(free_vec, e_free_time, 0) = elem(bound_vec, e_bound_time, 0);
+  elem(free_vec, e_free_dir0, 0) = cos_phi * sin_theta;
+  elem(free_vec, e_free_dir1, 0) = sin_phi * sin_theta;
+  elem(free_vec, e_free_dir2, 0) = cos_theta;
+  elem(free_vec, e_free_qoverp, 0) = elem(bound_vec, e_bound_qoverp, 0);
+
+  // Jacobian
+  detail::set_zero(jac);
+
+  // The surface axes
+  const auto x_axis = trf.x();
+  const auto y_axis = trf.y();
+  for (unsigned int i = 0u; i < 3u; ++i) {
+    jac_elem(jac, e_free_pos0 + i, e_bound_loc0) = x_axis[i];
+    jac_elem(jac, e_free_pos0 + i, e_bound_loc1) = y_axis[i];
+  }
+
+  jac_elem(jac, e_free_time, e_bound_time) = 1;
+
+  jac_elem(jac, e_free_dir0, e_bound_phi) = -sin_phi * sin_theta;
+  jac_elem(jac, e_free_dir1, e_bound_phi) = cos_phi * sin_theta;
+  jac_elem(jac, e_free_dir0, e_bound_theta) = cos_phi * cos_theta;
+  jac_elem(jac, e_free_dir1, e_bound_theta) = sin_phi * cos_theta;
+  jac_elem(jac, e_free_dir2, e_bound_theta) = -sin_theta;
+
+  jac_elem(jac, e_free_qoverp, e_bound_qoverp) = 1;
+
+  return free_vec;
+}
+
+/// Convert free to bound track parameters
+///
+/// @param trf placement of the surface
+/// @param free_vec free track parameters (8x1), with the position on the
+///                 surface and a unit direction
+/// @param jac the 6x8 jacobian of the transformation (output)
+///
+/// @note The jacobian does not contain the path length correction, which
+/// depends on the propagation.
+///
+/// @returns the bound track parameters (6x1)
+template <concepts::transform3D transform3_t,
+          concepts::column_matrix free_vector_t, concepts::matrix jacobian_t>
+ALGEBRA_HOST_DEVICE constexpr auto free_to_bound(
+    const transform3_t &trf, const free_vector_t &free_vec, jacobian_t &jac) {
+
+  static_assert(algebra::traits::rows<free_vector_t> == e_free_size);
+  static_assert(algebra::traits::rows<jacobian_t> == e_bound_size);
+  static_assert(algebra::traits::columns<jacobian_t> == e_free_size);
+
+  using value_t = algebra::traits::value_t<free_vector_t>;
+  using scalar_t = algebra::traits::scalar_t<free_vector_t>;
+  using element_getter_t = algebra::traits::element_getter_t<free_vector_t>;
+  using jac_element_getter_t = algebra::traits::element_getter_t<jacobian_t>;
+  using bound_vector_t =
+      algebra::traits::get_matrix_t<free_vector_t, e_bound_size, 1, value_t>;
+
+  constexpr element_getter_t elem{};
+  constexpr jac_element_getter_t jac_elem{};
+
+  const scalar_t dir_x{elem(free_vec, e_free_dir0, 0)};
+  const scalar_t dir_y{elem(free_vec, e_free_dir1, 0)};
+  const scalar_t cos_theta{elem(free_vec, e_free_dir2, 0)};
+
+  // The trigonometric functions of the angles follow from the direction
+  const scalar_t sin_theta{algebra::math::sqrt(dir_x * dir_x + dir_y * dir_y)};
+  const scalar_t inv_sin_theta{static_cast<value_t>(1) / sin_theta};
+  const scalar_t cos_phi{dir_x * inv_sin_theta};
+  const scalar_t sin_phi{dir_y * inv_sin_theta};
+
+  // Local position on the surface plane
+  const typename transform3_t::point3 loc = trf.point_to_local(
+      typename transform3_t::point3{elem(free_vec, e_free_pos0, 0),
+                                    elem(free_vec, e_free_pos1, 0),
+                                    elem(free_vec, e_free_pos2, 0)});
+
+  bound_vector_t bound_vec;
+  elem(bound_vec, e_bound_loc0, 0) = loc[0];
+  elem(bound_vec, e_bound_loc1, 0) = loc[1];
+  elem(bound_vec, e_bound_phi, 0) = algebra::math::atan2(dir_y, dir_x);
+  elem(bound_vec, e_bound_theta, 0) =
+      algebra::math::atan2(sin_theta, cos_theta);
+  elem(bound_vec, e_bound_qoverp, 0) = elem(free_vec, e_free_qoverp, 0);
+  elem(bound_vec, e_bound_time, 0) = elem(free_vec, e_free_time, 0);
+
+  // Jacobian
+  detail::set_zero(jac);
+
+  // The surface axes
+  const auto x_axis = trf.x();
+  const auto y_axis = trf.y();
+  for (unsigned int i = 0u; i < 3u; ++i) {
+    jac_elem(jac, e_bound_loc0, e_free_pos0 + i) = x_axis[i];
+    jac_elem(jac, e_bound_loc1, e_free_pos0 + i) = y_axis[i];
+  }
+
+  jac_elem(jac, e_bound_time, e_free_time) = 1;
+
+  jac_elem(jac, e_bound_phi, e_free_dir0) = -sin_phi * inv_sin_theta;
+  jac_elem(jac, e_bound_phi, e_free_dir1) = cos_phi * inv_sin_theta;
+  jac_elem(jac, e_bound_theta, e_free_dir0) = cos_phi * cos_theta;
+  jac_elem(jac, e_bound_theta, e_free_dir1) = sin_phi * cos_theta;
+  jac_elem(jac, e_bound_theta, e_free_dir2) = -sin_theta;
+
+  jac_elem(jac, e_bound_qoverp, e_free_qoverp) = 1;
+
+  return bound_vec;
+}
+
+}  // namespace algebra::kernels
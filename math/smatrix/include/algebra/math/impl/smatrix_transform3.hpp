@@ -9,6 +9,7 @@
 
 // Project include(s).
 #include "algebra/math/impl/smatrix_errorcheck.hpp"
+#include "algebra/math/rotation.hpp"
 #include "algebra/qualifiers.hpp"
 #include "algebra/utils/approximately_equal.hpp"
 
@@ -17,6 +18,7 @@
 #include "Math/SVector.h"
 
 // System include(s)
+#include <array>
 #include <cassert>
 #include <concepts>
 #include <limits>
@@ -179,6 +181,64 @@ struct transform3 {
   transform3(const transform3 &rhs) = default;
   ~transform3() = default;
 
+  /// Rotation by @param angle around the unit vector @param axis
+  ///
+  /// @note the inverse is the transposed rotation, no inversion is needed
+  ALGEBRA_HOST
+  static transform3 rotation_from_axis_angle(const vector3 &axis,
+                                             const scalar_type angle) {
+    return from_rotation(algebra::math::rotation_from_axis_angle(
+        axis[0], axis[1], axis[2], angle));
+  }
+
+  /// Rotation R_z(@param gamma) * R_y(@param beta) * R_x(@param alpha)
+  ///
+  /// @note the inverse is the transposed rotation, no inversion is needed
+  ALGEBRA_HOST
+  static transform3 rotation_from_euler(const scalar_type alpha,
+                                        const scalar_type beta,
+                                        const scalar_type gamma) {
+    return from_rotation(
+        algebra::math::rotation_from_euler(alpha, beta, gamma));
+  }
+
+  /// Apply an alignment correction: Rotate the frame around its origin by
+  /// the rotation vector @param domega and shift it by @param dt (both in
+  /// global coordinates)
+  ///
+  /// The inverse is updated with the transposed correction, instead of being
+  /// recomputed: (dR * R)^-1 = R^-1 * dR^T
+  ALGEBRA_HOST
+  void apply_delta(const vector3 &dt, const vector3 &domega) {
+
+    const auto dr = algebra::math::rotation_from_rotation_vector(
+        domega[0], domega[1], domega[2]);
+
+    for (unsigned int j = 0; j < 3; ++j) {
+      const std::array<scalar_type, 3> col{_data(0, j), _data(1, j),
+                                           _data(2, j)};
+      for (unsigned int i = 0; i < 3; ++i) {
+        _data(i, j) =
+            dr[0][i] * col[0] + dr[1][i] * col[1] + dr[2][i] * col[2];
+      }
+    }
+    for (unsigned int i = 0; i < 3; ++i) {
+      _data(i, 3) += dt[i];
+    }
+
+    for (unsigned int i = 0; i < 3; ++i) {
+      const std::array<scalar_type, 3> row{_data_inv(i, 0), _data_inv(i, 1),
+                                           _data_inv(i, 2)};
+      for (unsigned int j = 0; j < 3; ++j) {
+        _data_inv(i, j) =
+            row[0] * dr[0][j] + row[1] * dr[1][j] + row[2] * dr[2][j];
+      }
+      _data_inv(i, 3) = -(_data_inv(i, 0) * _data(0, 3) +
+                          _data_inv(i, 1) * _data(1, 3) +
+                          _data_inv(i, 2) * _data(2, 3));
+    }
+  }
+
   /// Equality operator
   ALGEBRA_HOST
   constexpr bool operator==(const transform3 &rhs) const {
@@ -265,6 +325,23 @@ struct transform3 {
     return ROOT::Math::SVector<scalar_type, 4>(_data_inv * vector_4)
         .template Sub<point3>(0);
   }
+
+ private:
+  /// @returns the transform for the rotation matrix with the columns @param r
+  ALGEBRA_HOST
+  static transform3 from_rotation(
+      const algebra::math::rotation3<scalar_type> &r) {
+
+    transform3 trf{};
+    for (unsigned int j = 0; j < 3; ++j) {
+      for (unsigned int i = 0; i < 3; ++i) {
+        trf._data(i, j) = r[j][i];
+        trf._data_inv(j, i) = r[j][i];
+      }
+    }
+
+    return trf;
+  }
 };  // struct transform3
 
 }  // namespace algebra::smatrix::math
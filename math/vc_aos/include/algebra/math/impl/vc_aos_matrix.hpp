@@ -11,7 +11,12 @@
 #include "algebra/concepts.hpp"
 #include "algebra/math/generic.hpp"
 #include "algebra/qualifiers.hpp"
+#include "algebra/storage/block_diagonal_matrix.hpp"
+#include "algebra/storage/diagonal_matrix.hpp"
 #include "algebra/storage/matrix.hpp"
+#include "algebra/storage/projection_matrix.hpp"
+#include "algebra/storage/row_major_matrix.hpp"
+#include "algebra/storage/triangular_matrix.hpp"
 
 namespace algebra::vc_aos::math {
 
@@ -37,6 +42,27 @@ inverse(const storage::matrix<array_t, value_t, ROW, COL> &m) noexcept {
   return algebra::generic::math::inverse(m);
 }
 
+/// @returns the determinant, computed with the algorithm given by the policy
+/// @tparam policy_t
+template <std::size_t N, concepts::value value_t,
+          template <typename, std::size_t> class array_t,
+          algebra::generic::matrix::policy::algorithm_policy policy_t>
+ALGEBRA_HOST_DEVICE constexpr value_t determinant(
+    const storage::matrix<array_t, value_t, N, N> &m, policy_t p) noexcept {
+  return algebra::generic::math::determinant(m, p);
+}
+
+/// @returns the inverse, computed with the algorithm given by the policy
+/// @tparam policy_t
+template <std::size_t ROW, std::size_t COL, concepts::value value_t,
+          template <typename, std::size_t> class array_t,
+          algebra::generic::matrix::policy::algorithm_policy policy_t>
+ALGEBRA_HOST_DEVICE constexpr storage::matrix<array_t, value_t, COL, ROW>
+inverse(const storage::matrix<array_t, value_t, ROW, COL> &m,
+        policy_t p) noexcept {
+  return algebra::generic::math::inverse(m, p);
+}
+
 /// @returns the transpose
 template <std::size_t ROW, std::size_t COL, concepts::value value_t,
           template <typename, std::size_t> class array_t>
@@ -45,4 +71,68 @@ transpose(const storage::matrix<array_t, value_t, ROW, COL> &m) noexcept {
   return algebra::generic::math::transpose(m);
 }
 
+/// @returns the determinant of a row major matrix
+template <std::size_t N, concepts::value value_t,
+          template <typename, std::size_t> class array_t>
+ALGEBRA_HOST_DEVICE constexpr value_t determinant(
+    const storage::row_major_matrix<array_t, value_t, N, N> &m) noexcept {
+  return algebra::generic::math::determinant(m);
+}
+
+/// @returns the inverse of a row major matrix
+template <std::size_t N, concepts::value value_t,
+          template <typename, std::size_t> class array_t>
+ALGEBRA_HOST_DEVICE constexpr storage::row_major_matrix<array_t, value_t, N, N>
+inverse(const storage::row_major_matrix<array_t, value_t, N, N> &m) noexcept {
+  return algebra::generic::math::inverse(m);
+}
+
+/// @returns the determinant of the diagonal matrix @param m
+template <typename matrix_t>
+ALGEBRA_HOST_DEVICE constexpr algebra::traits::scalar_t<matrix_t> determinant(
+    const algebra::storage::diagonal_matrix<matrix_t> &m) {
+  return algebra::storage::determinant(m);
+}
+
+/// @returns the inverse of the diagonal matrix @param m
+template <typename matrix_t>
+ALGEBRA_HOST_DEVICE constexpr algebra::storage::diagonal_matrix<matrix_t>
+inverse(const algebra::storage::diagonal_matrix<matrix_t> &m) {
+  return algebra::storage::inverse(m);
+}
+
+/// @returns the determinant of the triangular matrix @param m
+template <typename matrix_t, bool UPPER>
+ALGEBRA_HOST_DEVICE constexpr algebra::traits::scalar_t<matrix_t> determinant(
+    const algebra::storage::triangular_matrix<matrix_t, UPPER> &m) {
+  return algebra::storage::determinant(m);
+}
+
+/// @returns the inverse of the triangular matrix @param m
+template <typename matrix_t, bool UPPER>
+ALGEBRA_HOST_DEVICE constexpr algebra::storage::triangular_matrix<matrix_t,
+                                                                  UPPER>
+inverse(const algebra::storage::triangular_matrix<matrix_t, UPPER> &m) {
+  return algebra::storage::inverse(m);
+}
+
+/// @returns the determinant of the block diagonal matrix @param m, i.e. the
+/// product of the determinants of its blocks
+template <typename... block_ts>
+ALGEBRA_HOST_DEVICE constexpr auto determinant(
+    const algebra::storage::block_diagonal_matrix<block_ts...> &m) {
+  return algebra::storage::detail::blockwise_product(
+      m, [](const auto &b) { return determinant(b); });
+}
+
+/// @returns the inverse of the block diagonal matrix @param m, which is
+/// computed block by block
+template <typename... block_ts>
+ALGEBRA_HOST_DEVICE constexpr algebra::storage::block_diagonal_matrix<
+    block_ts...>
+inverse(const algebra::storage::block_diagonal_matrix<block_ts...> &m) {
+  return algebra::storage::detail::blockwise(
+      m, [](const auto &b) { return inverse(b); });
+}
+
 }  // namespace algebra::vc_aos::math
@@ -10,6 +10,7 @@
 // Project include(s).
 #include "algebra/concepts.hpp"
 #include "algebra/math/common.hpp"
+#include "algebra/math/rotation.hpp"
 #include "algebra/qualifiers.hpp"
 #include "algebra/storage/impl/vc_aos_approximately_equal.hpp"
 #include "algebra/storage/matrix.hpp"
@@ -30,6 +31,7 @@
 #include <cassert>
 #include <concepts>
 #include <limits>
+#include <span>
 
 namespace algebra::vc_aos::math {
 
@@ -167,10 +169,92 @@ struct transform3 {
     _data_inv = invert(_data);
   }
 
+  /// Gather constructor: simd transform from a table of scalar transforms
+  ///
+  /// Every element of the matrices is loaded with a single gather
+  /// instruction, so the inverse matrices are taken from the table instead of
+  /// being recomputed.
+  ///
+  /// @param table the scalar (AoS) transforms, e.g. of all detector surfaces
+  /// @param idx the position in @param table for every simd lane
+  template <template <typename, std::size_t> class aos_array_t,
+            concepts::value value_t, std::size_t N>
+  requires(std::same_as<scalar_type, Vc::Vector<value_t>> &&
+           N == scalar_type::Size) ALGEBRA_HOST
+      transform3(std::span<const transform3<aos_array_t, value_t>> table,
+                 const Vc::SimdArray<int, N> &idx) {
+
+    assert((idx >= 0).isFull());
+    assert((idx < static_cast<int>(table.size())).isFull());
+
+    const auto *mem = reinterpret_cast<const value_t *>(table.data());
+
+    for_each_aos_element<aos_array_t, value_t>(
+        idx, [&](const std::size_t j, const std::size_t i,
+                 const Vc::SimdArray<int, N> &offset,
+                 const Vc::SimdArray<int, N> &offset_inv) {
+          _data[j][i].gather(mem, offset);
+          _data_inv[j][i].gather(mem, offset_inv);
+        });
+  }
+
   /// Defaults
   transform3(const transform3 &rhs) = default;
   ~transform3() = default;
 
+  /// Rotation by @param angle around the unit vector @param axis
+  ///
+  /// @note the inverse is the transposed rotation, no inversion is needed
+  ALGEBRA_HOST_DEVICE
+  static transform3 rotation_from_axis_angle(const vector3 &axis,
+                                             const scalar_type &angle) {
+    return from_rotation(algebra::math::rotation_from_axis_angle(
+        axis[0], axis[1], axis[2], angle));
+  }
+
+  /// Rotation R_z(@param gamma) * R_y(@param beta) * R_x(@param alpha)
+  ///
+  /// @note the inverse is the transposed rotation, no inversion is needed
+  ALGEBRA_HOST_DEVICE
+  static transform3 rotation_from_euler(const scalar_type &alpha,
+                                        const scalar_type &beta,
+                                        const scalar_type &gamma) {
+    return from_rotation(
+        algebra::math::rotation_from_euler(alpha, beta, gamma));
+  }
+
+  /// Apply an alignment correction: Rotate the frame around its origin by
+  /// the rotation vector @param domega and shift it by @param dt (both in
+  /// global coordinates)
+  ///
+  /// The inverse is updated with the transposed correction, instead of being
+  /// recomputed: (dR * R)^-1 = R^-1 * dR^T
+  ALGEBRA_HOST_DEVICE
+  void apply_delta(const vector3 &dt, const vector3 &domega) {
+
+    const auto dr = algebra::math::rotation_from_rotation_vector(
+        domega[0], domega[1], domega[2]);
+
+    // Only the rotation part of the correction is needed
+    const column_t zero{0.f, 0.f, 0.f};
+    const matrix44 d_rot{column_t{dr[0][0], dr[0][1], dr[0][2]},
+                         column_t{dr[1][0], dr[1][1], dr[1][2]},
+                         column_t{dr[2][0], dr[2][1], dr[2][2]}, zero};
+
+    for (std::size_t j = e_x; j <= e_z; ++j) {
+      const column_t col{rotate(d_rot, _data[j])};
+      _data[j] = col;
+    }
+    _data[e_t] = _data[e_t] + dt;
+
+    const matrix44 inv{_data_inv};
+    for (std::size_t j = e_x; j <= e_z; ++j) {
+      _data_inv[j] =
+          inv[e_x] * dr[0][j] + inv[e_y] * dr[1][j] + inv[e_z] * dr[2][j];
+    }
+    _data_inv[e_t] = rotate(_data_inv, _data[e_t]) * scalar_type(-1.f);
+  }
+
   /// Equality operator
   ALGEBRA_HOST_DEVICE
   constexpr bool operator==(const transform3 &rhs) const {
@@ -294,6 +378,34 @@ struct transform3 {
   ALGEBRA_HOST_DEVICE
   constexpr const matrix44 &matrix_inverse() const { return _data_inv; }
 
+  /// Scatter the simd lanes into a table of scalar transforms
+  ///
+  /// Inverse of the gather constructor: the transform in every lane is written
+  /// to the position given by @param idx in @param table.
+  ///
+  /// @note If a position appears in more than one lane, it is unspecified
+  /// which of the lanes ends up in the table.
+  template <template <typename, std::size_t> class aos_array_t,
+            concepts::value value_t, std::size_t N>
+  requires(std::same_as<scalar_type, Vc::Vector<value_t>> &&
+           N == scalar_type::Size) ALGEBRA_HOST
+      void scatter(std::span<transform3<aos_array_t, value_t>> table,
+                   const Vc::SimdArray<int, N> &idx) const {
+
+    assert((idx >= 0).isFull());
+    assert((idx < static_cast<int>(table.size())).isFull());
+
+    auto *mem = reinterpret_cast<value_t *>(table.data());
+
+    for_each_aos_element<aos_array_t, value_t>(
+        idx, [&](const std::size_t j, const std::size_t i,
+                 const Vc::SimdArray<int, N> &offset,
+                 const Vc::SimdArray<int, N> &offset_inv) {
+          _data[j][i].scatter(mem, offset);
+          _data_inv[j][i].scatter(mem, offset_inv);
+        });
+  }
+
   /// This method transform from a point from the local 3D cartesian frame
   ///  to the global 3D cartesian frame
   ///
@@ -349,6 +461,56 @@ struct transform3 {
       const vector3_type &v) const {
     return rotate(_data_inv, v);
   }
+
+ private:
+  /// @returns the transform for the rotation matrix with the columns @param r
+  ALGEBRA_HOST_DEVICE
+  static transform3 from_rotation(
+      const algebra::math::rotation3<scalar_type> &r) {
+
+    const column_t zero{0.f, 0.f, 0.f};
+
+    transform3 trf{};
+    trf._data = matrix44{column_t{r[0][0], r[0][1], r[0][2]},
+                         column_t{r[1][0], r[1][1], r[1][2]},
+                         column_t{r[2][0], r[2][1], r[2][2]}, zero};
+    trf._data_inv = matrix44{column_t{r[0][0], r[1][0], r[2][0]},
+                             column_t{r[0][1], r[1][1], r[2][1]},
+                             column_t{r[0][2], r[1][2], r[2][2]}, zero};
+
+    return trf;
+  }
+
+  /// Call @param f for every matrix element (column @c j, row @c i) with the
+  /// element positions in the flat scalar memory of the AoS transforms at
+  /// @param idx (for the matrix and for its inverse)
+  template <template <typename, std::size_t> class aos_array_t,
+            concepts::value value_t, std::size_t N, typename function_t>
+  ALGEBRA_HOST static void for_each_aos_element(
+      const Vc::SimdArray<int, N> &idx, function_t &&f) {
+
+    using aos_transform3_t = transform3<aos_array_t, value_t>;
+    using aos_column_t = typename aos_transform3_t::column_t;
+
+    // The AoS transform has to be two densely packed 4x4 matrices
+    static_assert(sizeof(aos_transform3_t) == 8u * sizeof(aos_column_t));
+    static_assert(sizeof(aos_column_t) % sizeof(value_t) == 0u);
+
+    constexpr int col_stride{
+        static_cast<int>(sizeof(aos_column_t) / sizeof(value_t))};
+    constexpr int mat_stride{4 * col_stride};
+    constexpr int trf_stride{2 * mat_stride};
+
+    const Vc::SimdArray<int, N> base{idx * trf_stride};
+
+    for (std::size_t j = 0u; j < 4u; ++j) {
+      for (std::size_t i = 0u; i < 3u; ++i) {
+        const Vc::SimdArray<int, N> offset{
+            base + (static_cast<int>(j) * col_stride + static_cast<int>(i))};
+        f(j, i, offset, offset + mat_stride);
+      }
+    }
+  }
 };  // struct transform3
 
 }  // namespace algebra::vc_aos::math
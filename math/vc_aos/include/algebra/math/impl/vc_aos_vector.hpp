@@ -10,6 +10,8 @@
 // Project include(s).
 #include "algebra/concepts.hpp"
 #include "algebra/math/common.hpp"
+#include "algebra/math/precision.hpp"
+#include "algebra/math/vec.hpp"
 #include "algebra/qualifiers.hpp"
 #include "algebra/storage/vc_aos.hpp"
 #include "algebra/storage/vector.hpp"
@@ -35,6 +37,19 @@ ALGEBRA_HOST_DEVICE constexpr auto phi(const vector_t &v) {
   return algebra::math::atan2(v[1], v[0]);
 }
 
+/// This method retrieves phi from a vector @param v
+template <algebra::concepts::vc_aos_vector vector_t,
+          algebra::concepts::precision_policy precision_t>
+ALGEBRA_HOST_DEVICE constexpr auto phi(const vector_t &v, precision_t) {
+  if constexpr (std::same_as<precision_t, algebra::precision::fast>) {
+    using scalar_t = algebra::traits::value_t<vector_t>;
+    return algebra::math::vec::atan2(static_cast<scalar_t>(v[1]),
+                                     static_cast<scalar_t>(v[0]));
+  } else {
+    return phi(v);
+  }
+}
+
 /// This method retrieves the perpendicular magnitude of a vector @param v
 template <algebra::concepts::vc_aos_vector vector_t>
 ALGEBRA_HOST_DEVICE constexpr auto perp(const vector_t &v) {
@@ -47,6 +62,19 @@ ALGEBRA_HOST_DEVICE constexpr auto theta(const vector_t &v) {
   return algebra::math::atan2(perp(v), v[2]);
 }
 
+/// This method retrieves theta from a vector @param v
+template <algebra::concepts::vc_aos_vector vector_t,
+          algebra::concepts::precision_policy precision_t>
+ALGEBRA_HOST_DEVICE constexpr auto theta(const vector_t &v, precision_t) {
+  if constexpr (std::same_as<precision_t, algebra::precision::fast>) {
+    using scalar_t = algebra::traits::value_t<vector_t>;
+    return algebra::math::vec::atan2(static_cast<scalar_t>(perp(v)),
+                                     static_cast<scalar_t>(v[2]));
+  } else {
+    return theta(v);
+  }
+}
+
 /// Dot product between two input vectors
 ///
 /// @tparam vector_t generic input vector type
@@ -69,6 +97,18 @@ ALGEBRA_HOST_DEVICE constexpr auto norm(const vector_t &v) {
   return algebra::math::sqrt(dot(v, v));
 }
 
+/// This method retrieves the norm of a vector, no dimension restriction
+///
+/// @param v the input vector
+///
+/// @note A single square root is cheaper than the refined reciprocal square
+/// root estimate, so the norm is computed exactly in both precision modes
+template <algebra::concepts::vc_aos_vector vector_t,
+          algebra::concepts::precision_policy precision_t>
+ALGEBRA_HOST_DEVICE constexpr auto norm(const vector_t &v, precision_t) {
+  return norm(v);
+}
+
 /// Get a normalized version of the input vector
 ///
 /// @tparam vector_t generic input vector type
@@ -79,6 +119,23 @@ ALGEBRA_HOST_DEVICE constexpr auto normalize(const vector_t &v) {
   return v / norm(v);
 }
 
+/// Get a normalized version of the input vector
+///
+/// @tparam vector_t generic input vector type
+///
+/// @param v the input vector
+/// @param p the precision policy
+template <algebra::concepts::vc_aos_vector vector_t,
+          algebra::concepts::precision_policy precision_t>
+ALGEBRA_HOST_DEVICE constexpr auto normalize(const vector_t &v,
+                                             precision_t p) {
+  if constexpr (std::same_as<precision_t, algebra::precision::fast>) {
+    return v * algebra::math::rsqrt(dot(v, v), p);
+  } else {
+    return normalize(v);
+  }
+}
+
 /// This method retrieves the pseudo-rapidity from a vector or vector base with
 /// rows >= 3
 ///
@@ -88,6 +145,24 @@ ALGEBRA_HOST_DEVICE constexpr auto eta(const vector_t &v) noexcept {
   return algebra::math::atanh(v[2] / norm(v));
 }
 
+/// This method retrieves the pseudo-rapidity from a vector or vector base with
+/// rows >= 3
+///
+/// @param v the input vector
+/// @param p the precision policy
+template <algebra::concepts::vc_aos_vector vector_t,
+          algebra::concepts::precision_policy precision_t>
+ALGEBRA_HOST_DEVICE constexpr auto eta(const vector_t &v,
+                                       precision_t p) noexcept {
+  if constexpr (std::same_as<precision_t, algebra::precision::fast>) {
+    using scalar_t = algebra::traits::value_t<vector_t>;
+    return algebra::math::vec::atanh(static_cast<scalar_t>(
+        v[2] * algebra::math::rsqrt(dot(v, v), p)));
+  } else {
+    return eta(v);
+  }
+}
+
 /// Cross product between two input vectors - 3 Dim (single precision)
 ///
 /// @tparam vector_t generic input vector type
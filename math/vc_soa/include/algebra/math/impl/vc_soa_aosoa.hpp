@@ -0,0 +1,192 @@
+/** Algebra plugins library, part of the ACTS project
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "algebra/concepts.hpp"
+#include "algebra/math/impl/vc_aos_transform3.hpp"
+#include "algebra/math/impl/vc_soa_matrix.hpp"
+#include "algebra/math/impl/vc_soa_transform3.hpp"
+#include "algebra/math/impl/vc_soa_vector.hpp"
+#include "algebra/qualifiers.hpp"
+#include "algebra/storage/impl/vc_soa_aosoa.hpp"
+#include "algebra/storage/matrix.hpp"
+#include "algebra/type_traits.hpp"
+
+// Vc include(s).
+#ifdef _MSC_VER
+#pragma warning(push, 0)
+#endif  // MSVC
+#include <Vc/Vc>
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif  // MSVC
+
+// System include(s).
+#include <cassert>
+#include <cstddef>
+
+namespace algebra::vc_soa {
+
+/// Lanes of an SoA transform
+template <concepts::value T>
+struct lane_access<vc_aos::math::transform3<storage_type, Vc::Vector<T>>> {
+
+  using simd_type = Vc::Vector<T>;
+  using soa_type = vc_aos::math::transform3<storage_type, simd_type>;
+  using aos_type = vc_aos::math::transform3<vc_aos::storage_type, T>;
+
+  /// Lane access of the 4x3 matrices
+  using matrix_access = lane_access<typename soa_type::matrix44>;
+
+  ALGEBRA_HOST
+  static aos_type get(const soa_type &trf, const std::size_t lane) {
+    return aos_type{matrix_access::get(trf.matrix(), lane),
+                    matrix_access::get(trf.matrix_inverse(), lane)};
+  }
+
+  ALGEBRA_HOST
+  static void set(soa_type &trf, const std::size_t lane, const aos_type &v) {
+    matrix_access::set(trf._data, lane, v.matrix());
+    matrix_access::set(trf._data_inv, lane, v.matrix_inverse());
+  }
+};
+
+/// Chunk-wise bulk operations on AoSoA containers (found by ADL)
+/// @{
+
+/// @returns the dot products of the vectors in @param a and @param b
+template <concepts::vector vector_t>
+ALGEBRA_HOST auto dot(const aosoa<vector_t> &a, const aosoa<vector_t> &b) {
+  assert(a.size() == b.size());
+
+  aosoa<algebra::traits::scalar_t<vector_t>> res(a.size());
+
+  for (std::size_t c = 0u; c < a.n_chunks(); ++c) {
+    res.chunk(c) = math::dot(a.chunk(c), b.chunk(c));
+  }
+
+  return res;
+}
+
+/// @returns the points @param p transformed to the global frame by the
+/// corresponding transforms in @param trfs
+template <concepts::transform3D transform3_t, concepts::point3D point3_t>
+ALGEBRA_HOST aosoa<point3_t> point_to_global(const aosoa<transform3_t> &trfs,
+                                             const aosoa<point3_t> &p) {
+  assert(trfs.size() == p.size());
+
+  aosoa<point3_t> res(p.size());
+
+  for (std::size_t c = 0u; c < p.n_chunks(); ++c) {
+    res.chunk(c) = trfs.chunk(c).point_to_global(p.chunk(c));
+  }
+
+  return res;
+}
+
+/// @returns the points @param p transformed to the local frames of the
+/// corresponding transforms in @param trfs
+template <concepts::transform3D transform3_t, concepts::point3D point3_t>
+ALGEBRA_HOST aosoa<point3_t> point_to_local(const aosoa<transform3_t> &trfs,
+                                            const aosoa<point3_t> &p) {
+  assert(trfs.size() == p.size());
+
+  aosoa<point3_t> res(p.size());
+
+  for (std::size_t c = 0u; c < p.n_chunks(); ++c) {
+    res.chunk(c) = trfs.chunk(c).point_to_local(p.chunk(c));
+  }
+
+  return res;
+}
+
+/// @returns the points @param p transformed to the global frame by the same
+/// (AoS) transform @param trf
+template <concepts::value value_t,
+          template <typename, std::size_t> class aos_array_t,
+          concepts::point3D point3_t>
+ALGEBRA_HOST aosoa<point3_t> point_to_global(
+    const vc_aos::math::transform3<aos_array_t, value_t> &trf,
+    const aosoa<point3_t> &p) {
+
+  aosoa<point3_t> res(p.size());
+
+  for (std::size_t c = 0u; c < p.n_chunks(); ++c) {
+    res.chunk(c) = math::point_to_global(trf, p.chunk(c));
+  }
+
+  return res;
+}
+
+/// @returns the points @param p transformed to the local frame of the same
+/// (AoS) transform @param trf
+template <concepts::value value_t,
+          template <typename, std::size_t> class aos_array_t,
+          concepts::point3D point3_t>
+ALGEBRA_HOST aosoa<point3_t> point_to_local(
+    const vc_aos::math::transform3<aos_array_t, value_t> &trf,
+    const aosoa<point3_t> &p) {
+
+  aosoa<point3_t> res(p.size());
+
+  for (std::size_t c = 0u; c < p.n_chunks(); ++c) {
+    res.chunk(c) = math::point_to_local(trf, p.chunk(c));
+  }
+
+  return res;
+}
+
+/// @returns the similarity transforms @c H*C*H^T of the matrices in
+/// @param c with the corresponding matrices in @param h
+template <concepts::matrix h_matrix_t, concepts::square_matrix c_matrix_t>
+requires(algebra::traits::columns<h_matrix_t> ==
+         algebra::traits::rows<c_matrix_t>) ALGEBRA_HOST
+    auto similarity(const aosoa<h_matrix_t> &h, const aosoa<c_matrix_t> &c) {
+  assert(h.size() == c.size());
+
+  constexpr std::size_t M{algebra::traits::rows<h_matrix_t>};
+  using res_matrix_t =
+      algebra::traits::get_matrix_t<h_matrix_t, M, M,
+                                    algebra::traits::value_t<h_matrix_t>>;
+
+  aosoa<res_matrix_t> res(c.size());
+
+  for (std::size_t i = 0u; i < c.n_chunks(); ++i) {
+    const h_matrix_t &h_i = h.chunk(i);
+    res.chunk(i) = h_i * c.chunk(i) * algebra::storage::transpose(h_i);
+  }
+
+  return res;
+}
+
+/// @returns the similarity transforms @c H*C*H^T of the matrices in
+/// @param c with the same matrix @param h (e.g. a projection)
+template <concepts::matrix h_matrix_t, concepts::square_matrix c_matrix_t>
+requires(algebra::traits::columns<h_matrix_t> ==
+         algebra::traits::rows<c_matrix_t>) ALGEBRA_HOST
+    auto similarity(const h_matrix_t &h, const aosoa<c_matrix_t> &c) {
+
+  constexpr std::size_t M{algebra::traits::rows<h_matrix_t>};
+  using res_matrix_t =
+      algebra::traits::get_matrix_t<h_matrix_t, M, M,
+                                    algebra::traits::value_t<h_matrix_t>>;
+
+  const auto h_t = algebra::storage::transpose(h);
+
+  aosoa<res_matrix_t> res(c.size());
+
+  for (std::size_t i = 0u; i < c.n_chunks(); ++i) {
+    res.chunk(i) = h * c.chunk(i) * h_t;
+  }
+
+  return res;
+}
+/// @}
+
+}  // namespace algebra::vc_soa
@@ -8,6 +8,8 @@
 #pragma once
 
 // Project include(s)
+#include "algebra/math/precision.hpp"
+#include "algebra/math/vec.hpp"
 #include "algebra/storage/impl/vc_soa_concepts.hpp"
 
 // Vc include(s).
@@ -22,6 +24,8 @@
 // System include(s)
 #include <algorithm>
 #include <cmath>
+#include <type_traits>
+#include <utility>
 
 namespace algebra::math {
 
@@ -97,10 +101,22 @@ constexpr decltype(auto) cos(T &&vec) {
   return Vc::cos(std::forward<T>(vec));
 }
 
+template <algebra::concepts::vc_simd_vector T>
+constexpr auto sincos(T &&vec) {
+  using simd_t = std::remove_cvref_t<T>;
+
+  simd_t s;
+  simd_t c;
+  Vc::sincos(std::forward<T>(vec), &s, &c);
+
+  return std::pair<simd_t, simd_t>{s, c};
+}
+
 template <algebra::concepts::vc_simd_vector T>
 constexpr decltype(auto) tan(T &&vec) {
   // It seems there is no dedicated @c Vc::tan function ?
-  return Vc::sin(std::forward<T>(vec)) / Vc::cos(std::forward<T>(vec));
+  const auto [s, c] = algebra::math::sincos(std::forward<T>(vec));
+  return s / c;
 }
 
 template <algebra::concepts::vc_simd_vector T>
@@ -108,6 +124,45 @@ constexpr decltype(auto) atan(T &&vec) {
   return Vc::atan(std::forward<T>(vec));
 }
 
+template <algebra::concepts::vc_simd_vector T,
+          algebra::concepts::vc_simd_vector S>
+constexpr decltype(auto) atan2(T &&y, S &&x) {
+  return Vc::atan2(std::forward<T>(y), std::forward<S>(x));
+}
+
+template <algebra::concepts::vc_simd_vector T>
+constexpr decltype(auto) acos(T &&vec) {
+  using simd_t = std::remove_cvref_t<T>;
+
+  // There is no @c Vc::acos: Go through atan2, which, other than
+  // pi/2 - asin(x), stays accurate for x close to 1
+  const simd_t x{std::forward<T>(vec)};
+  return Vc::atan2(Vc::sqrt((simd_t::One() - x) * (simd_t::One() + x)), x);
+}
+
+template <algebra::concepts::vc_simd_vector T>
+constexpr decltype(auto) atanh(T &&vec) {
+  using simd_t = std::remove_cvref_t<T>;
+  using value_t = typename simd_t::EntryType;
+
+  // There is no @c Vc::atanh: atanh(|x|) = 0.5 * log1p(2|x| / (1 - |x|)),
+  // which is accurate to a few ulp
+  const simd_t x{std::forward<T>(vec)};
+  const simd_t a{Vc::abs(x)};
+  const simd_t u{simd_t{static_cast<value_t>(2)} * a / (simd_t::One() - a)};
+
+  // log1p(u) from log(1 + u), corrected for the rounding error in 1 + u
+  // (D. Goldberg, "What Every Computer Scientist Should Know About
+  // Floating-Point Arithmetic", Theorem 4)
+  const simd_t w{simd_t::One() + u};
+  simd_t log1p_u{Vc::log(w) * (u / (w - simd_t::One()))};
+  log1p_u(w == simd_t::One()) = u;
+  // atanh(1) = inf
+  log1p_u(Vc::isinf(w)) = w;
+
+  return Vc::copysign(simd_t{static_cast<value_t>(0.5)} * log1p_u, x);
+}
+
 template <algebra::concepts::vc_simd_vector T,
           algebra::concepts::vc_simd_vector S>
 constexpr decltype(auto) copysign(T &&mag, S &&sgn) {
@@ -133,6 +188,67 @@ template <algebra::concepts::vc_simd_vector T>
 constexpr decltype(auto) fma(T &&x, T &&y, T &&z) {
   return Vc::fma(std::forward<T>(x), std::forward<T>(y), std::forward<T>(z));
 }
+
+template <algebra::concepts::vc_simd_vector T>
+constexpr decltype(auto) rsqrt(T &&vec, algebra::precision::exact) {
+  using simd_t = std::remove_cvref_t<T>;
+  return simd_t::One() / Vc::sqrt(std::forward<T>(vec));
+}
+
+template <algebra::concepts::vc_simd_vector T>
+constexpr decltype(auto) rsqrt(T &&vec, algebra::precision::fast) {
+  using simd_t = std::remove_cvref_t<T>;
+  using value_t = typename simd_t::EntryType;
+
+  const simd_t x{std::forward<T>(vec)};
+  const simd_t y{Vc::rsqrt(x)};
+
+  // One Newton-Raphson step on the estimate
+  return y * (simd_t{static_cast<value_t>(1.5)} -
+              simd_t{static_cast<value_t>(0.5)} * x * y * y);
+}
 /// @}
 
 }  // namespace algebra::math
+
+namespace algebra::math::vec {
+
+/// Primitive operations on Vc types for the polynomial approximations
+template <algebra::concepts::vc_simd_vector T>
+struct simd_ops<T> {
+
+  using value_type = typename T::EntryType;
+  using mask_type = typename T::MaskType;
+
+  static T select(const mask_type &m, const T &a, const T &b) {
+    return Vc::iif(m, a, b);
+  }
+
+  static T abs(const T &x) { return Vc::abs(x); }
+
+  static T copysign(const T &mag, const T &sgn) {
+    return Vc::copysign(mag, sgn);
+  }
+
+  static T sqrt(const T &x) { return Vc::sqrt(x); }
+
+  static T round(const T &x) { return Vc::round(x); }
+
+  static T floor(const T &x) { return Vc::floor(x); }
+
+  static T ldexp(const T &x, const T &n) {
+    return Vc::ldexp(x, Vc::simd_cast<int_array_t>(n));
+  }
+
+  static T frexp(const T &x, T &e) {
+    int_array_t n{};
+    const T m{Vc::frexp(x, &n)};
+    e = Vc::simd_cast<T>(n);
+    return m;
+  }
+
+ private:
+  using int_array_t = Vc::SimdArray<int, T::Size>;
+};
+
+}  // namespace algebra::math::vec
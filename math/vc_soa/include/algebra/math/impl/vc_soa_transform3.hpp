@@ -0,0 +1,127 @@
+/** Algebra plugins library, part of the ACTS project
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "algebra/concepts.hpp"
+#include "algebra/math/impl/vc_aos_transform3.hpp"
+#include "algebra/qualifiers.hpp"
+#include "algebra/storage/matrix.hpp"
+#include "algebra/storage/vector.hpp"
+
+// Vc include(s).
+#ifdef _MSC_VER
+#pragma warning(push, 0)
+#endif  // MSVC
+#include <Vc/Vc>
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif  // MSVC
+
+// System include(s).
+#include <cstddef>
+
+namespace algebra::vc_soa::math {
+
+namespace detail {
+
+/// Apply the 4x3 matrix @param m with scalar elements to the SoA vector
+/// @param v, broadcasting every matrix element once
+///
+/// @tparam TRANSLATE whether to add the translation (points) or not (vectors)
+template <bool TRANSLATE, concepts::value value_t,
+          template <typename, std::size_t> class aos_array_t,
+          template <typename, std::size_t> class array_t>
+ALGEBRA_HOST_DEVICE constexpr auto broadcast_apply(
+    const algebra::storage::matrix<aos_array_t, value_t, 3u, 4u> &m,
+    const algebra::storage::vector<3u, Vc::Vector<value_t>, array_t> &v) {
+
+  using simd_t = Vc::Vector<value_t>;
+
+  algebra::storage::vector<3u, simd_t, array_t> res;
+
+  for (std::size_t i = 0u; i < 3u; ++i) {
+    // Broadcast row i of the matrix
+    const simd_t r0{m[0][i]};
+    const simd_t r1{m[1][i]};
+    const simd_t r2{m[2][i]};
+    const simd_t t{TRANSLATE ? m[3][i] : value_t(0)};
+
+    res[i] = Vc::fma(r2, v[2], Vc::fma(r1, v[1], Vc::fma(r0, v[0], t)));
+  }
+
+  return res;
+}
+
+}  // namespace detail
+
+/// Transform a batch of points from the local 3D cartesian frame to the
+/// global 3D cartesian frame with the same (AoS) transform
+///
+/// @param trf the transform shared by all points
+/// @param p the SoA points
+///
+/// @return the global points
+template <concepts::value value_t,
+          template <typename, std::size_t> class aos_array_t,
+          template <typename, std::size_t> class array_t>
+ALGEBRA_HOST_DEVICE constexpr auto point_to_global(
+    const vc_aos::math::transform3<aos_array_t, value_t> &trf,
+    const algebra::storage::vector<3u, Vc::Vector<value_t>, array_t> &p) {
+  return detail::broadcast_apply<true>(trf.matrix(), p);
+}
+
+/// Transform a batch of points from the global 3D cartesian frame into the
+/// local 3D cartesian frame of the same (AoS) transform
+///
+/// @param trf the transform shared by all points
+/// @param p the SoA points
+///
+/// @return the local points
+template <concepts::value value_t,
+          template <typename, std::size_t> class aos_array_t,
+          template <typename, std::size_t> class array_t>
+ALGEBRA_HOST_DEVICE constexpr auto point_to_local(
+    const vc_aos::math::transform3<aos_array_t, value_t> &trf,
+    const algebra::storage::vector<3u, Vc::Vector<value_t>, array_t> &p) {
+  return detail::broadcast_apply<true>(trf.matrix_inverse(), p);
+}
+
+/// Transform a batch of vectors from the local 3D cartesian frame to the
+/// global 3D cartesian frame with the same (AoS) transform
+///
+/// @param trf the transform shared by all vectors
+/// @param v the SoA vectors
+///
+/// @return the vectors in global coordinates
+template <concepts::value value_t,
+          template <typename, std::size_t> class aos_array_t,
+          template <typename, std::size_t> class array_t>
+ALGEBRA_HOST_DEVICE constexpr auto vector_to_global(
+    const vc_aos::math::transform3<aos_array_t, value_t> &trf,
+    const algebra::storage::vector<3u, Vc::Vector<value_t>, array_t> &v) {
+  return detail::broadcast_apply<false>(trf.matrix(), v);
+}
+
+/// Transform a batch of vectors from the global 3D cartesian frame into the
+/// local 3D cartesian frame of the same (AoS) transform
+///
+/// @param trf the transform shared by all vectors
+/// @param v the SoA vectors
+///
+/// @return the vectors in local coordinates
+template <concepts::value value_t,
+          template <typename, std::size_t> class aos_array_t,
+          template <typename, std::size_t> class array_t>
+ALGEBRA_HOST_DEVICE constexpr auto vector_to_local(
+    const vc_aos::math::transform3<aos_array_t, value_t> &trf,
+    const algebra::storage::vector<3u, Vc::Vector<value_t>, array_t> &v) {
+  return detail::broadcast_apply<false>(trf.matrix_inverse(), v);
+}
+
+}  // namespace algebra::vc_soa::math
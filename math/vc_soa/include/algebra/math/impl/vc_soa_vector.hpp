@@ -130,6 +130,26 @@ ALGEBRA_HOST_DEVICE constexpr auto norm(
   return Vc::sqrt(dot(v, v));
 }
 
+/// This method retrieves the norm of a vector, no dimension restriction
+///
+/// @tparam N dimension of the vector
+/// @tparam value_t value type in the simd vectors
+/// @tparam array_t array type that holds the vector elements
+/// @tparam precision_t the precision policy
+///
+/// @param v the input vector
+///
+/// @note A single square root is cheaper than the refined reciprocal square
+/// root estimate, so the norm is computed exactly in both precision modes
+template <std::size_t N, concepts::value value_t,
+          template <typename, std::size_t> class array_t,
+          concepts::precision_policy precision_t>
+ALGEBRA_HOST_DEVICE constexpr auto norm(
+    const storage::vector<N, Vc::Vector<value_t>, array_t> &v, precision_t) {
+
+  return norm(v);
+}
+
 /// Get a normalized version of the input vector
 ///
 /// @tparam N dimension of the vector
@@ -143,12 +163,28 @@ ALGEBRA_HOST_DEVICE constexpr storage::vector<N, Vc::Vector<value_t>, array_t>
 normalize(const storage::vector<N, Vc::Vector<value_t>, array_t> &v) {
 
   return (Vc::Vector<value_t>::One() / norm(v)) * v;
+}
 
-  // Less accurate, but faster
-  // return Vc::reciprocal(norm(v)) * v;
+/// Get a normalized version of the input vector
+///
+/// @tparam N dimension of the vector
+/// @tparam value_t value type in the simd vectors
+/// @tparam array_t array type that holds the vector elements
+/// @tparam precision_t the precision policy
+///
+/// @param v the input vector
+template <std::size_t N, concepts::value value_t,
+          template <typename, std::size_t> class array_t,
+          concepts::precision_policy precision_t>
+ALGEBRA_HOST_DEVICE constexpr storage::vector<N, Vc::Vector<value_t>, array_t>
+normalize(const storage::vector<N, Vc::Vector<value_t>, array_t> &v,
+          precision_t p) {
 
-  // Even less accurate, but even faster
-  // return Vc::rsqrt(dot(v, v)) * v;
+  if constexpr (std::same_as<precision_t, precision::fast>) {
+    return algebra::math::rsqrt(dot(v, v), p) * v;
+  } else {
+    return normalize(v);
+  }
 }
 
 /// This method retrieves the pseudo-rapidity from a vector or vector base with
@@ -164,16 +200,30 @@ template <std::size_t N, concepts::value value_t,
 requires(N >= 3) ALGEBRA_HOST_DEVICE constexpr auto eta(
     const storage::vector<N, Vc::Vector<value_t>, array_t> &v) {
 
-  // atanh does not exist in Vc
-  auto atanh_func = [](value_t e) { return std::atanh(e); };
-
-  return (v[2] / norm(v)).apply(atanh_func);
+  return algebra::math::atanh(v[2] / norm(v));
+}
 
-  // Faster, but less accurate
-  // return (Vc::reciprocal(norm(v)) * v[2]).apply(atanh_func);
+/// This method retrieves the pseudo-rapidity from a vector or vector base with
+/// rows >= 3
+///
+/// @tparam N dimension of the vector
+/// @tparam value_t value type in the simd vectors
+/// @tparam array_t array type that holds the vector elements
+/// @tparam precision_t the precision policy
+///
+/// @param v the input vector
+template <std::size_t N, concepts::value value_t,
+          template <typename, std::size_t> class array_t,
+          concepts::precision_policy precision_t>
+requires(N >= 3) ALGEBRA_HOST_DEVICE constexpr auto eta(
+    const storage::vector<N, Vc::Vector<value_t>, array_t> &v,
+    precision_t p) {
 
-  // Even faster, but even less accurate
-  // return (Vc::rsqrt(dot(v, v)) * v[2]).apply(atanh_func);
+  if constexpr (std::same_as<precision_t, precision::fast>) {
+    return algebra::math::atanh(algebra::math::rsqrt(dot(v, v), p) * v[2]);
+  } else {
+    return eta(v);
+  }
 }
 
 /// Elementwise sum
@@ -9,12 +9,19 @@
 
 // Project include(s)
 #include "algebra/concepts.hpp"
+#include "algebra/storage/block_diagonal_matrix.hpp"
+#include "algebra/storage/diagonal_matrix.hpp"
 #include "algebra/storage/impl/cmath_getter.hpp"
+#include "algebra/storage/matrix_view.hpp"
+#include "algebra/storage/projection_matrix.hpp"
+#include "algebra/storage/reinterpret_as.hpp"
+#include "algebra/storage/triangular_matrix.hpp"
 #include "algebra/type_traits.hpp"
 
 // System include(s).
 #include <array>
 #include <cstddef>
+#include <type_traits>
 
 namespace algebra {
 
@@ -37,6 +44,26 @@ using vector_type = storage_type<T, N>;
 /// Matrix type used in the Array storage model
 template <concepts::scalar T, size_type ROWS, size_type COLS>
 using matrix_type = storage_type<storage_type<T, ROWS>, COLS>;
+/// Diagonal matrix type that only stores the diagonal elements
+template <concepts::scalar T, size_type N>
+using diagonal_matrix =
+    algebra::storage::diagonal_matrix<matrix_type<T, N, N>>;
+/// Projection matrix type that only stores the indices of the selected
+/// elements
+template <concepts::scalar T, size_type M, size_type N>
+using projection_matrix =
+    algebra::storage::projection_matrix<matrix_type<T, M, N>>;
+/// Triangular matrix types that only store the elements of the triangle
+template <concepts::scalar T, size_type N>
+using lower_triangular =
+    algebra::storage::lower_triangular<matrix_type<T, N, N>>;
+template <concepts::scalar T, size_type N>
+using upper_triangular =
+    algebra::storage::upper_triangular<matrix_type<T, N, N>>;
+/// Block diagonal matrix type with square blocks of the ranks @tparam N
+template <concepts::scalar T, size_type... N>
+using block_diagonal_matrix =
+    algebra::storage::block_diagonal_matrix<matrix_type<T, N, N>...>;
 
 /// 3-element "vector" type, using @c std::array
 template <concepts::scalar T>
@@ -51,6 +78,15 @@ using vector2 = storage_type<T, 2>;
 template <concepts::scalar T>
 using point2 = vector2<T>;
 
+/// Non-owning view of a matrix in an external buffer, column major by default
+template <concepts::scalar T, size_type ROWS, size_type COLS,
+          size_type ROW_STRIDE = 1u, size_type COL_STRIDE = ROWS>
+using matrix_view = algebra::storage::matrix_view<matrix_type<T, ROWS, COLS>,
+                                                  ROW_STRIDE, COL_STRIDE>;
+/// Non-owning view of a vector in an external buffer
+template <concepts::scalar T, size_type N, size_type STRIDE = 1u>
+using vector_view = algebra::storage::vector_view<vector_type<T, N>, STRIDE>;
+
 /// Element Getter
 using element_getter = cmath::storage::element_getter;
 /// Block Getter
@@ -60,4 +96,18 @@ using block_getter = cmath::storage::block_getter;
 
 ALGEBRA_PLUGINS_DEFINE_TYPE_TRAITS(array)
 
+namespace traits {
+
+/// The vectors and the matrix columns are stored without padding
+/// @{
+template <typename T, auto N>
+struct column_major<array::vector_type<T, N>> : public std::true_type {};
+
+template <typename T, auto ROWS, auto COLS>
+struct column_major<array::matrix_type<T, ROWS, COLS>>
+    : public std::true_type {};
+/// @}
+
+}  // namespace traits
+
 }  // namespace algebra
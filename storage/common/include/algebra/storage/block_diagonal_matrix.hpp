@@ -0,0 +1,644 @@
+/** Algebra plugins library, part of the ACTS project
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "algebra/concepts.hpp"
+#include "algebra/qualifiers.hpp"
+#include "algebra/storage/matrix.hpp"
+#include "algebra/storage/matrix_view.hpp"
+#include "algebra/type_traits.hpp"
+
+// System include(s).
+#include <array>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace algebra::storage {
+
+/// Block diagonal square matrix
+///
+/// Composite of the square matrices @tparam block_ts on the diagonal (e.g. the
+/// covariances of the tracks and of the vertex in a vertex fit), which are
+/// stored as they are. The off-diagonal blocks are known to be zero and are
+/// neither stored nor used in the arithmetic operations, which work block by
+/// block. The dense matrices that are created from it (e.g. by multiplying it
+/// with a dense matrix) have the type of the first block.
+template <concepts::square_matrix... block_ts>
+requires(sizeof...(block_ts) > 0u) class block_diagonal_matrix {
+
+  /// Type of the first block
+  using first_block_type = std::tuple_element_t<0u, std::tuple<block_ts...>>;
+
+ public:
+  using value_type = algebra::traits::value_t<first_block_type>;
+  // Value type is a simd vector in SoA and a scalar in AoS
+  using scalar_type = algebra::traits::scalar_t<first_block_type>;
+  using size_type = algebra::traits::index_t<first_block_type>;
+
+  static_assert(
+      (std::same_as<algebra::traits::value_t<block_ts>, value_type> && ...),
+      "The blocks need to have the same value type");
+
+  /// Type of the block @tparam B
+  template <std::size_t B>
+  using block_type = std::tuple_element_t<B, std::tuple<block_ts...>>;
+
+  /// Dense matrix type
+  using matrix_type =
+      algebra::traits::get_matrix_t<first_block_type,
+                                    (algebra::traits::rank<block_ts> + ...),
+                                    (algebra::traits::rank<block_ts> + ...),
+                                    value_type>;
+
+  /// Default constructor: Default construct the blocks
+  constexpr block_diagonal_matrix() = default;
+
+  /// Construct from the blocks @param blocks
+  ALGEBRA_HOST_DEVICE
+  constexpr explicit block_diagonal_matrix(const block_ts &... blocks)
+      : m_blocks{blocks...} {}
+
+  /// @returns the element in row @param row and column @param col
+  ALGEBRA_HOST_DEVICE
+  constexpr scalar_type operator()(const std::size_t row,
+                                   const std::size_t col) const {
+    assert(row < rows());
+    assert(col < columns());
+
+    scalar_type res{0};
+    for_each_block([&](auto b) {
+      constexpr std::size_t B{decltype(b)::value};
+      constexpr std::size_t off{offset<B>()};
+      constexpr std::size_t n{size<B>()};
+
+      if (row >= off && row < off + n && col >= off && col < off + n) {
+        res = algebra::traits::element_getter_t<block_type<B>>{}(
+            block<B>(), row - off, col - off);
+      }
+    });
+    return res;
+  }
+
+  /// Access to the block @tparam B (no copy)
+  /// @{
+  template <std::size_t B>
+  ALGEBRA_HOST_DEVICE constexpr block_type<B> &block() {
+    return std::get<B>(m_blocks);
+  }
+  template <std::size_t B>
+  ALGEBRA_HOST_DEVICE constexpr const block_type<B> &block() const {
+    return std::get<B>(m_blocks);
+  }
+  /// @}
+
+  /// @returns the number of blocks
+  ALGEBRA_HOST_DEVICE
+  static consteval std::size_t n_blocks() { return sizeof...(block_ts); }
+
+  /// @returns the number of rows (and columns) of the block @tparam B
+  template <std::size_t B>
+  ALGEBRA_HOST_DEVICE static consteval std::size_t size() {
+    return algebra::traits::rank<block_type<B>>;
+  }
+
+  /// @returns the first row (and column) of the block @tparam B
+  template <std::size_t B>
+  ALGEBRA_HOST_DEVICE static consteval std::size_t offset() {
+    constexpr std::array<std::size_t, n_blocks()> sizes{
+        algebra::traits::rank<block_ts>...};
+
+    std::size_t off{0u};
+    for (std::size_t i = 0u; i < B; ++i) {
+      off += sizes[i];
+    }
+    return off;
+  }
+
+  /// @returns the number of rows
+  ALGEBRA_HOST_DEVICE
+  static consteval std::size_t rows() {
+    return (algebra::traits::rank<block_ts> + ...);
+  }
+
+  /// @returns the number of columns
+  ALGEBRA_HOST_DEVICE
+  static consteval std::size_t columns() { return rows(); }
+
+  /// Call @param f for every block with the block index as
+  /// @c std::integral_constant
+  template <typename function_t>
+  ALGEBRA_HOST_DEVICE static constexpr void for_each_block(function_t &&f) {
+    [&f]<std::size_t... B>(std::index_sequence<B...>) {
+      (f(std::integral_constant<std::size_t, B>{}), ...);
+    }
+    (std::make_index_sequence<n_blocks()>());
+  }
+
+  /// Conversion to the dense matrix type
+  ALGEBRA_HOST_DEVICE
+  constexpr operator matrix_type() const {
+
+    using element_getter_t = algebra::traits::element_getter_t<matrix_type>;
+
+    matrix_type m;
+    for (std::size_t j = 0u; j < columns(); ++j) {
+      for (std::size_t i = 0u; i < rows(); ++i) {
+        element_getter_t{}(m, i, j) = scalar_type(0);
+      }
+    }
+    for_each_block([&](auto b) {
+      constexpr std::size_t B{decltype(b)::value};
+      constexpr std::size_t off{offset<B>()};
+
+      using getter_t = algebra::traits::element_getter_t<block_type<B>>;
+
+      for (std::size_t j = 0u; j < size<B>(); ++j) {
+        for (std::size_t i = 0u; i < size<B>(); ++i) {
+          element_getter_t{}(m, off + i, off + j) =
+              getter_t{}(block<B>(), i, j);
+        }
+      }
+    });
+    return m;
+  }
+
+ private:
+  /// The blocks on the diagonal
+  std::tuple<block_ts...> m_blocks;
+
+};  // class block_diagonal_matrix
+
+/// Check whether a type is a block diagonal matrix
+/// @{
+template <typename T>
+inline constexpr bool is_block_diagonal{false};
+
+template <typename... block_ts>
+inline constexpr bool is_block_diagonal<block_diagonal_matrix<block_ts...>>{
+    true};
+/// @}
+
+/// Functor used to read the elements of a block diagonal matrix
+struct block_diagonal_element_getter {
+
+  /// @returns the element in row @param row and column @param col of the
+  /// block diagonal matrix @param m
+  template <typename... block_ts>
+  ALGEBRA_HOST_DEVICE constexpr auto operator()(
+      const block_diagonal_matrix<block_ts...> &m, std::size_t row,
+      std::size_t col) const {
+    return m(row, col);
+  }
+
+};  // struct block_diagonal_element_getter
+
+/// Functor used to access blocks of block diagonal matrices
+///
+/// The blocks are lazy views of the matrix, i.e. no elements are copied. The
+/// diagonal blocks themselves are accessed with @c block_diagonal_matrix::block
+struct block_diagonal_block_getter {
+
+  /// @returns a view of the block of size @tparam ROWS x @tparam COLS of
+  /// @param m, starting at row @param row and column @param col
+  template <std::size_t ROWS, std::size_t COLS, typename... block_ts>
+  ALGEBRA_HOST_DEVICE constexpr auto operator()(
+      const block_diagonal_matrix<block_ts...> &m, std::size_t row,
+      std::size_t col) const {
+    return block_view<const block_diagonal_matrix<block_ts...>, ROWS, COLS>{
+        m, row, col};
+  }
+
+};  // struct block_diagonal_block_getter
+
+/// Function extracting an element from a block diagonal matrix
+template <typename... block_ts>
+ALGEBRA_HOST_DEVICE constexpr auto element(
+    const block_diagonal_matrix<block_ts...> &m, std::size_t row,
+    std::size_t col) {
+  return block_diagonal_element_getter{}(m, row, col);
+}
+
+namespace detail {
+
+/// @returns the block diagonal matrix with the blocks @c f(b) for the blocks
+/// @c b of @param m (e.g. their inverses)
+template <typename... block_ts, typename function_t>
+ALGEBRA_HOST_DEVICE constexpr block_diagonal_matrix<block_ts...> blockwise(
+    const block_diagonal_matrix<block_ts...> &m, function_t &&f) {
+
+  block_diagonal_matrix<block_ts...> res;
+  m.for_each_block([&](auto b) {
+    constexpr std::size_t B{decltype(b)::value};
+    res.template block<B>() = f(m.template block<B>());
+  });
+  return res;
+}
+
+/// @returns the product of @c f(b) for the blocks @c b of @param m (e.g.
+/// of their determinants)
+template <typename... block_ts, typename function_t>
+ALGEBRA_HOST_DEVICE constexpr auto blockwise_product(
+    const block_diagonal_matrix<block_ts...> &m, function_t &&f) {
+
+  using scalar_t =
+      typename block_diagonal_matrix<block_ts...>::scalar_type;
+
+  scalar_t res{1};
+  m.for_each_block([&](auto b) {
+    constexpr std::size_t B{decltype(b)::value};
+    res *= f(m.template block<B>());
+  });
+  return res;
+}
+
+/// Add the product @c a*b of the blocks @param a and @param b to @param c,
+/// each starting at the given rows and columns of the respective matrix
+template <std::size_t R, std::size_t K, std::size_t C, typename MC,
+          typename MA, typename MB>
+ALGEBRA_HOST_DEVICE constexpr void add_block_product(
+    MC &c, const std::size_t c_row, const std::size_t c_col, const MA &a,
+    const std::size_t a_row, const std::size_t a_col, const MB &b,
+    const std::size_t b_row, const std::size_t b_col) {
+
+  using a_getter_t = algebra::traits::element_getter_t<MA>;
+  using b_getter_t = algebra::traits::element_getter_t<MB>;
+  using c_getter_t = algebra::traits::element_getter_t<MC>;
+
+  for (std::size_t j = 0u; j < C; ++j) {
+    for (std::size_t k = 0u; k < K; ++k) {
+      const auto b_kj = b_getter_t{}(b, b_row + k, b_col + j);
+      for (std::size_t i = 0u; i < R; ++i) {
+        c_getter_t{}(c, c_row + i, c_col + j) +=
+            a_getter_t{}(a, a_row + i, a_col + k) * b_kj;
+      }
+    }
+  }
+}
+
+/// @returns the zero matrix of type @tparam matrix_t
+template <concepts::matrix matrix_t>
+ALGEBRA_HOST_DEVICE constexpr matrix_t zero_matrix() {
+
+  using element_getter_t = algebra::traits::element_getter_t<matrix_t>;
+
+  matrix_t m;
+  for (std::size_t j = 0u; j < algebra::traits::columns<matrix_t>; ++j) {
+    for (std::size_t i = 0u; i < algebra::traits::rows<matrix_t>; ++i) {
+      element_getter_t{}(m, i, j) = algebra::traits::scalar_t<matrix_t>(0);
+    }
+  }
+  return m;
+}
+
+}  // namespace detail
+
+/// Arithmetic operators between two block diagonal matrices, which work
+/// block by block
+/// @{
+template <typename... block_ts>
+ALGEBRA_HOST_DEVICE constexpr block_diagonal_matrix<block_ts...> operator+(
+    const block_diagonal_matrix<block_ts...> &a,
+    const block_diagonal_matrix<block_ts...> &b) {
+
+  block_diagonal_matrix<block_ts...> c;
+  a.for_each_block([&](auto blk) {
+    constexpr std::size_t B{decltype(blk)::value};
+    constexpr std::size_t n{
+        block_diagonal_matrix<block_ts...>::template size<B>()};
+
+    using getter_t = algebra::traits::element_getter_t<
+        typename block_diagonal_matrix<block_ts...>::template block_type<B>>;
+
+    for (std::size_t j = 0u; j < n; ++j) {
+      for (std::size_t i = 0u; i < n; ++i) {
+        getter_t{}(c.template block<B>(), i, j) =
+            getter_t{}(a.template block<B>(), i, j) +
+            getter_t{}(b.template block<B>(), i, j);
+      }
+    }
+  });
+  return c;
+}
+
+template <typename... block_ts>
+ALGEBRA_HOST_DEVICE constexpr block_diagonal_matrix<block_ts...> operator-(
+    const block_diagonal_matrix<block_ts...> &a,
+    const block_diagonal_matrix<block_ts...> &b) {
+
+  block_diagonal_matrix<block_ts...> c;
+  a.for_each_block([&](auto blk) {
+    constexpr std::size_t B{decltype(blk)::value};
+    constexpr std::size_t n{
+        block_diagonal_matrix<block_ts...>::template size<B>()};
+
+    using getter_t = algebra::traits::element_getter_t<
+        typename block_diagonal_matrix<block_ts...>::template block_type<B>>;
+
+    for (std::size_t j = 0u; j < n; ++j) {
+      for (std::size_t i = 0u; i < n; ++i) {
+        getter_t{}(c.template block<B>(), i, j) =
+            getter_t{}(a.template block<B>(), i, j) -
+            getter_t{}(b.template block<B>(), i, j);
+      }
+    }
+  });
+  return c;
+}
+
+template <typename... block_ts>
+ALGEBRA_HOST_DEVICE constexpr block_diagonal_matrix<block_ts...> operator*(
+    const block_diagonal_matrix<block_ts...> &a,
+    const block_diagonal_matrix<block_ts...> &b) {
+
+  block_diagonal_matrix<block_ts...> c;
+  a.for_each_block([&](auto blk) {
+    constexpr std::size_t B{decltype(blk)::value};
+    constexpr std::size_t n{
+        block_diagonal_matrix<block_ts...>::template size<B>()};
+
+    using block_t =
+        typename block_diagonal_matrix<block_ts...>::template block_type<B>;
+
+    c.template block<B>() = detail::zero_matrix<block_t>();
+    detail::add_block_product<n, n, n>(c.template block<B>(), 0u, 0u,
+                                       a.template block<B>(), 0u, 0u,
+                                       b.template block<B>(), 0u, 0u);
+  });
+  return c;
+}
+/// @}
+
+namespace detail {
+
+/// @returns the product of the block diagonal matrix @param d with the dense
+/// matrix or vector @param b, which skips the known zeros of @param d
+template <typename... block_ts, typename MB>
+ALGEBRA_HOST_DEVICE constexpr auto multiply_block_rows(
+    const block_diagonal_matrix<block_ts...> &d, const MB &b) {
+
+  using d_matrix_t = typename block_diagonal_matrix<block_ts...>::matrix_type;
+  using value_t = algebra::traits::value_t<d_matrix_t>;
+
+  constexpr std::size_t N{block_diagonal_matrix<block_ts...>::rows()};
+
+  if constexpr (concepts::vector<MB>) {
+    using vector_t = algebra::traits::get_vector_t<d_matrix_t, N, value_t>;
+    using b_getter_t = algebra::traits::element_getter_t<MB>;
+    using c_getter_t = algebra::traits::element_getter_t<vector_t>;
+
+    vector_t c;
+    d.for_each_block([&](auto blk) {
+      constexpr std::size_t B{decltype(blk)::value};
+      constexpr std::size_t off{
+          block_diagonal_matrix<block_ts...>::template offset<B>()};
+      constexpr std::size_t n{
+          block_diagonal_matrix<block_ts...>::template size<B>()};
+
+      using getter_t = algebra::traits::element_getter_t<
+          typename block_diagonal_matrix<block_ts...>::template block_type<B>>;
+
+      for (std::size_t i = 0u; i < n; ++i) {
+        c_getter_t{}(c, off + i) = algebra::traits::scalar_t<d_matrix_t>(0);
+      }
+      for (std::size_t k = 0u; k < n; ++k) {
+        const auto b_k = b_getter_t{}(b, off + k);
+        for (std::size_t i = 0u; i < n; ++i) {
+          c_getter_t{}(c, off + i) +=
+              getter_t{}(d.template block<B>(), i, k) * b_k;
+        }
+      }
+    });
+    return c;
+  } else {
+    constexpr std::size_t C{algebra::traits::columns<MB>};
+
+    using c_matrix_t = algebra::traits::get_matrix_t<d_matrix_t, N, C, value_t>;
+
+    auto c = zero_matrix<c_matrix_t>();
+    d.for_each_block([&](auto blk) {
+      constexpr std::size_t B{decltype(blk)::value};
+      constexpr std::size_t off{
+          block_diagonal_matrix<block_ts...>::template offset<B>()};
+      constexpr std::size_t n{
+          block_diagonal_matrix<block_ts...>::template size<B>()};
+
+      add_block_product<n, n, C>(c, off, 0u, d.template block<B>(), 0u, 0u, b,
+                                 off, 0u);
+    });
+    return c;
+  }
+}
+
+/// @returns the product of the dense matrix @param a with the block diagonal
+/// matrix @param d, which skips the known zeros of @param d
+template <typename MA, typename... block_ts>
+ALGEBRA_HOST_DEVICE constexpr auto multiply_block_columns(
+    const MA &a, const block_diagonal_matrix<block_ts...> &d) {
+
+  using d_matrix_t = typename block_diagonal_matrix<block_ts...>::matrix_type;
+  using value_t = algebra::traits::value_t<d_matrix_t>;
+
+  constexpr std::size_t R{algebra::traits::rows<MA>};
+  constexpr std::size_t N{block_diagonal_matrix<block_ts...>::rows()};
+
+  using c_matrix_t = algebra::traits::get_matrix_t<d_matrix_t, R, N, value_t>;
+
+  auto c = zero_matrix<c_matrix_t>();
+  d.for_each_block([&](auto blk) {
+    constexpr std::size_t B{decltype(blk)::value};
+    constexpr std::size_t off{
+        block_diagonal_matrix<block_ts...>::template offset<B>()};
+    constexpr std::size_t n{
+        block_diagonal_matrix<block_ts...>::template size<B>()};
+
+    add_block_product<R, n, n>(c, 0u, off, a, 0u, off, d.template block<B>(),
+                               0u, 0u);
+  });
+  return c;
+}
+
+}  // namespace detail
+
+/// Products of a block diagonal matrix with dense matrices and vectors
+/// @{
+template <typename... block_ts, typename MB>
+requires(!is_block_diagonal<MB> &&
+         (concepts::matrix<MB> || concepts::vector<MB>) &&
+         algebra::traits::rows<MB> ==
+             block_diagonal_matrix<block_ts...>::rows())
+    ALGEBRA_HOST_DEVICE constexpr auto
+    operator*(const block_diagonal_matrix<block_ts...> &d, const MB &b) {
+  return detail::multiply_block_rows(d, b);
+}
+
+// Takes precedence over the scalar multiplication of storage::matrix
+template <typename... block_ts, template <typename, std::size_t> class array_t,
+          concepts::scalar scalar_t, std::size_t ROW, std::size_t COL>
+requires(ROW == block_diagonal_matrix<block_ts...>::rows()) ALGEBRA_HOST_DEVICE
+    constexpr auto
+    operator*(const block_diagonal_matrix<block_ts...> &d,
+              const matrix<array_t, scalar_t, ROW, COL> &b) {
+  return detail::multiply_block_rows(d, b);
+}
+
+template <concepts::matrix MA, typename... block_ts>
+requires(!is_block_diagonal<MA> &&
+         algebra::traits::columns<MA> ==
+             block_diagonal_matrix<block_ts...>::rows())
+    ALGEBRA_HOST_DEVICE constexpr auto
+    operator*(const MA &a, const block_diagonal_matrix<block_ts...> &d) {
+  return detail::multiply_block_columns(a, d);
+}
+/// @}
+
+/// @returns the transpose of the block diagonal matrix @param m, i.e. the
+/// block diagonal matrix of the transposed blocks
+template <typename... block_ts>
+ALGEBRA_HOST_DEVICE constexpr block_diagonal_matrix<block_ts...> transpose(
+    const block_diagonal_matrix<block_ts...> &m) {
+
+  block_diagonal_matrix<block_ts...> res;
+  m.for_each_block([&](auto blk) {
+    constexpr std::size_t B{decltype(blk)::value};
+    constexpr std::size_t n{
+        block_diagonal_matrix<block_ts...>::template size<B>()};
+
+    using getter_t = algebra::traits::element_getter_t<
+        typename block_diagonal_matrix<block_ts...>::template block_type<B>>;
+
+    for (std::size_t j = 0u; j < n; ++j) {
+      for (std::size_t i = 0u; i < n; ++i) {
+        getter_t{}(res.template block<B>(), i, j) =
+            getter_t{}(m.template block<B>(), j, i);
+      }
+    }
+  });
+  return res;
+}
+
+/// @returns the similarity transform @c A*C*A^T of the block diagonal matrix
+/// @param c with the block diagonal matrix @param a, block by block
+template <typename... block_ts>
+ALGEBRA_HOST_DEVICE constexpr block_diagonal_matrix<block_ts...> similarity(
+    const block_diagonal_matrix<block_ts...> &a,
+    const block_diagonal_matrix<block_ts...> &c) {
+  return a * c * transpose(a);
+}
+
+/// @returns the similarity transform @c A*C*A^T of the block diagonal matrix
+/// @param c with the dense matrix @param a, which sums the contributions of
+/// the blocks of @param c
+template <concepts::matrix MA, typename... block_ts>
+requires(!is_block_diagonal<MA> &&
+         algebra::traits::columns<MA> ==
+             block_diagonal_matrix<block_ts...>::rows())
+    ALGEBRA_HOST_DEVICE constexpr auto similarity(
+        const MA &a, const block_diagonal_matrix<block_ts...> &c) {
+
+  using c_matrix_t = typename block_diagonal_matrix<block_ts...>::matrix_type;
+  using value_t = algebra::traits::value_t<c_matrix_t>;
+
+  constexpr std::size_t R{algebra::traits::rows<MA>};
+
+  using res_matrix_t = algebra::traits::get_matrix_t<c_matrix_t, R, R, value_t>;
+  using a_getter_t = algebra::traits::element_getter_t<MA>;
+  using res_getter_t = algebra::traits::element_getter_t<res_matrix_t>;
+
+  auto res = detail::zero_matrix<res_matrix_t>();
+  c.for_each_block([&](auto blk) {
+    constexpr std::size_t B{decltype(blk)::value};
+    constexpr std::size_t off{
+        block_diagonal_matrix<block_ts...>::template offset<B>()};
+    constexpr std::size_t n{
+        block_diagonal_matrix<block_ts...>::template size<B>()};
+
+    using ac_matrix_t =
+        algebra::traits::get_matrix_t<c_matrix_t, R, n, value_t>;
+    using ac_getter_t = algebra::traits::element_getter_t<ac_matrix_t>;
+
+    // A_b * C_b for the columns of A that meet the block
+    auto ac = detail::zero_matrix<ac_matrix_t>();
+    detail::add_block_product<R, n, n>(ac, 0u, 0u, a, 0u, off,
+                                       c.template block<B>(), 0u, 0u);
+
+    // (A_b * C_b) * A_b^T
+    for (std::size_t j = 0u; j < R; ++j) {
+      for (std::size_t k = 0u; k < n; ++k) {
+        const auto a_jk = a_getter_t{}(a, j, off + k);
+        for (std::size_t i = 0u; i < R; ++i) {
+          res_getter_t{}(res, i, j) += ac_getter_t{}(ac, i, k) * a_jk;
+        }
+      }
+    }
+  });
+  return res;
+}
+
+}  // namespace algebra::storage
+
+namespace algebra::traits {
+
+/// Type traits of the block diagonal matrices
+/// @{
+template <typename... block_ts>
+struct index<storage::block_diagonal_matrix<block_ts...>> {
+  using type = typename storage::block_diagonal_matrix<block_ts...>::size_type;
+};
+
+template <typename... block_ts>
+struct dimensions<storage::block_diagonal_matrix<block_ts...>> {
+
+  using size_type = index_t<storage::block_diagonal_matrix<block_ts...>>;
+
+  static constexpr size_type dim{2};
+  static constexpr size_type rows{
+      storage::block_diagonal_matrix<block_ts...>::rows()};
+  static constexpr size_type columns{
+      storage::block_diagonal_matrix<block_ts...>::columns()};
+};
+
+template <typename... block_ts>
+struct value<storage::block_diagonal_matrix<block_ts...>> {
+  using type = typename storage::block_diagonal_matrix<block_ts...>::value_type;
+};
+
+template <typename... block_ts>
+struct scalar<storage::block_diagonal_matrix<block_ts...>> {
+  using type =
+      typename storage::block_diagonal_matrix<block_ts...>::scalar_type;
+};
+
+template <typename... block_ts>
+struct vector<storage::block_diagonal_matrix<block_ts...>>
+    : public vector<
+          typename storage::block_diagonal_matrix<block_ts...>::matrix_type> {
+};
+
+template <typename... block_ts>
+struct matrix<storage::block_diagonal_matrix<block_ts...>>
+    : public matrix<
+          typename storage::block_diagonal_matrix<block_ts...>::matrix_type> {
+};
+
+template <typename... block_ts>
+struct element_getter<storage::block_diagonal_matrix<block_ts...>> {
+  using type = storage::block_diagonal_element_getter;
+};
+
+template <typename... block_ts>
+struct block_getter<storage::block_diagonal_matrix<block_ts...>> {
+  using type = storage::block_diagonal_block_getter;
+};
+/// @}
+
+}  // namespace algebra::traits
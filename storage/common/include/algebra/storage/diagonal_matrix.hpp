@@ -0,0 +1,439 @@
+/** Algebra plugins library, part of the ACTS project
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "algebra/concepts.hpp"
+#include "algebra/qualifiers.hpp"
+#include "algebra/storage/matrix.hpp"
+#include "algebra/type_traits.hpp"
+
+// System include(s).
+#include <array>
+#include <cassert>
+#include <cstddef>
+
+namespace algebra::storage {
+
+/// Diagonal square matrix
+///
+/// Only the diagonal elements are stored. The matrix has the dimensions and
+/// the value type of the (dense) square matrix type @tparam matrix_t, which is
+/// also the type of the dense matrices that are created from it (e.g. by
+/// adding a dense matrix). Products with dense matrices and vectors only scale
+/// their rows or columns and the determinant and inverse are computed from
+/// the diagonal elements alone.
+template <concepts::square_matrix matrix_t>
+class diagonal_matrix {
+
+ public:
+  /// Dense matrix type
+  using matrix_type = matrix_t;
+  using value_type = algebra::traits::value_t<matrix_type>;
+  // Value type is a simd vector in SoA and a scalar in AoS
+  using scalar_type = algebra::traits::scalar_t<matrix_type>;
+  using size_type = algebra::traits::index_t<matrix_type>;
+  /// Storage of the diagonal elements
+  using array_type =
+      std::array<scalar_type, algebra::traits::rank<matrix_type>>;
+
+  /// Default constructor sets all entries to zero.
+  constexpr diagonal_matrix() = default;
+
+  /// Construct from the diagonal elements @param d
+  ALGEBRA_HOST_DEVICE
+  constexpr explicit diagonal_matrix(const array_type &d) : m_diag{d} {}
+
+  /// Construct from the vector of the diagonal elements @param v
+  template <concepts::vector vector_t>
+  requires(algebra::traits::rows<vector_t> ==
+           algebra::traits::rank<matrix_type>) ALGEBRA_HOST_DEVICE
+      constexpr explicit diagonal_matrix(const vector_t &v) {
+
+    using element_getter_t = algebra::traits::element_getter_t<vector_t>;
+
+    for (std::size_t i = 0u; i < rows(); ++i) {
+      m_diag[i] = element_getter_t{}(v, i);
+    }
+  }
+
+  /// @returns the element in row @param row and column @param col
+  ALGEBRA_HOST_DEVICE
+  constexpr scalar_type operator()(const std::size_t row,
+                                   const std::size_t col) const {
+    assert(row < rows());
+    assert(col < columns());
+    return row == col ? m_diag[row] : scalar_type(0);
+  }
+
+  /// Access to the diagonal element @param i
+  /// @{
+  ALGEBRA_HOST_DEVICE
+  constexpr scalar_type &operator[](const std::size_t i) {
+    assert(i < rows());
+    return m_diag[i];
+  }
+  ALGEBRA_HOST_DEVICE
+  constexpr const scalar_type &operator[](const std::size_t i) const {
+    assert(i < rows());
+    return m_diag[i];
+  }
+  /// @}
+
+  /// @returns the diagonal elements
+  ALGEBRA_HOST_DEVICE
+  constexpr const array_type &diagonal() const { return m_diag; }
+
+  /// @returns the number of rows
+  ALGEBRA_HOST_DEVICE
+  static consteval std::size_t rows() {
+    return algebra::traits::rank<matrix_type>;
+  }
+
+  /// @returns the number of columns
+  ALGEBRA_HOST_DEVICE
+  static consteval std::size_t columns() { return rows(); }
+
+  /// Conversion to the dense matrix type
+  ALGEBRA_HOST_DEVICE
+  constexpr operator matrix_type() const {
+
+    using element_getter_t = algebra::traits::element_getter_t<matrix_type>;
+
+    matrix_type m;
+    for (std::size_t j = 0u; j < columns(); ++j) {
+      for (std::size_t i = 0u; i < rows(); ++i) {
+        element_getter_t{}(m, i, j) = (*this)(i, j);
+      }
+    }
+    return m;
+  }
+
+ private:
+  /// The diagonal elements
+  array_type m_diag{};
+
+};  // class diagonal_matrix
+
+/// Check whether a type is a diagonal matrix
+/// @{
+template <typename T>
+inline constexpr bool is_diagonal{false};
+
+template <typename matrix_t>
+inline constexpr bool is_diagonal<diagonal_matrix<matrix_t>>{true};
+/// @}
+
+/// Functor used to read the elements of a diagonal matrix
+struct diagonal_element_getter {
+
+  /// @returns the element in row @param row and column @param col of the
+  /// diagonal matrix @param m (the off-diagonal elements cannot be written)
+  template <typename matrix_t>
+  ALGEBRA_HOST_DEVICE constexpr auto operator()(
+      const diagonal_matrix<matrix_t> &m, std::size_t row,
+      std::size_t col) const {
+    return m(row, col);
+  }
+
+};  // struct diagonal_element_getter
+
+/// Function extracting an element from a diagonal matrix
+template <typename matrix_t>
+ALGEBRA_HOST_DEVICE constexpr auto element(const diagonal_matrix<matrix_t> &m,
+                                           std::size_t row, std::size_t col) {
+  return diagonal_element_getter{}(m, row, col);
+}
+
+namespace detail {
+
+/// @returns the product of the diagonal matrix @param d with the matrix or
+/// vector @param b, i.e. @param b with its rows scaled
+template <typename matrix_t, typename MB>
+ALGEBRA_HOST_DEVICE constexpr auto scale_rows(
+    const diagonal_matrix<matrix_t> &d, const MB &b) {
+
+  using value_t = algebra::traits::value_t<matrix_t>;
+  using b_getter_t = algebra::traits::element_getter_t<MB>;
+
+  constexpr std::size_t N{diagonal_matrix<matrix_t>::rows()};
+
+  if constexpr (concepts::vector<MB>) {
+    using vector_t = algebra::traits::get_vector_t<matrix_t, N, value_t>;
+    using c_getter_t = algebra::traits::element_getter_t<vector_t>;
+
+    vector_t c;
+    for (std::size_t i = 0u; i < N; ++i) {
+      c_getter_t{}(c, i) = d[i] * b_getter_t{}(b, i);
+    }
+    return c;
+  } else {
+    constexpr std::size_t C{algebra::traits::columns<MB>};
+
+    using c_matrix_t = algebra::traits::get_matrix_t<matrix_t, N, C, value_t>;
+    using c_getter_t = algebra::traits::element_getter_t<c_matrix_t>;
+
+    c_matrix_t c;
+    for (std::size_t j = 0u; j < C; ++j) {
+      for (std::size_t i = 0u; i < N; ++i) {
+        c_getter_t{}(c, i, j) = d[i] * b_getter_t{}(b, i, j);
+      }
+    }
+    return c;
+  }
+}
+
+/// @returns the product of the matrix @param a with the diagonal matrix
+/// @param d, i.e. @param a with its columns scaled
+template <typename MA, typename matrix_t>
+ALGEBRA_HOST_DEVICE constexpr auto scale_columns(
+    const MA &a, const diagonal_matrix<matrix_t> &d) {
+
+  using value_t = algebra::traits::value_t<matrix_t>;
+  using a_getter_t = algebra::traits::element_getter_t<MA>;
+
+  constexpr std::size_t R{algebra::traits::rows<MA>};
+  constexpr std::size_t N{diagonal_matrix<matrix_t>::rows()};
+
+  using c_matrix_t = algebra::traits::get_matrix_t<matrix_t, R, N, value_t>;
+  using c_getter_t = algebra::traits::element_getter_t<c_matrix_t>;
+
+  c_matrix_t c;
+  for (std::size_t j = 0u; j < N; ++j) {
+    for (std::size_t i = 0u; i < R; ++i) {
+      c_getter_t{}(c, i, j) = a_getter_t{}(a, i, j) * d[j];
+    }
+  }
+  return c;
+}
+
+/// @returns the dense matrix @param m with the diagonal matrix @param d added
+/// (@tparam SIGN = 1) or subtracted (@tparam SIGN = -1). With
+/// @tparam NEGATE, the dense matrix is subtracted from the diagonal instead.
+template <int SIGN, bool NEGATE, typename M, typename matrix_t>
+ALGEBRA_HOST_DEVICE constexpr auto add_diagonal(
+    const M &m, const diagonal_matrix<matrix_t> &d) {
+
+  using m_getter_t = algebra::traits::element_getter_t<M>;
+  using c_matrix_t = algebra::traits::matrix_t<M>;
+  using c_getter_t = algebra::traits::element_getter_t<c_matrix_t>;
+
+  constexpr std::size_t N{diagonal_matrix<matrix_t>::rows()};
+
+  c_matrix_t c;
+  for (std::size_t j = 0u; j < N; ++j) {
+    for (std::size_t i = 0u; i < N; ++i) {
+      if constexpr (NEGATE) {
+        c_getter_t{}(c, i, j) = -m_getter_t{}(m, i, j);
+      } else {
+        c_getter_t{}(c, i, j) = m_getter_t{}(m, i, j);
+      }
+    }
+  }
+  for (std::size_t i = 0u; i < N; ++i) {
+    if constexpr (SIGN > 0) {
+      c_getter_t{}(c, i, i) += d[i];
+    } else {
+      c_getter_t{}(c, i, i) -= d[i];
+    }
+  }
+  return c;
+}
+
+}  // namespace detail
+
+/// Arithmetic operators between two diagonal matrices
+/// @{
+template <typename matrix_t>
+ALGEBRA_HOST_DEVICE constexpr diagonal_matrix<matrix_t> operator+(
+    const diagonal_matrix<matrix_t> &a, const diagonal_matrix<matrix_t> &b) {
+  diagonal_matrix<matrix_t> c;
+  for (std::size_t i = 0u; i < c.rows(); ++i) {
+    c[i] = a[i] + b[i];
+  }
+  return c;
+}
+
+template <typename matrix_t>
+ALGEBRA_HOST_DEVICE constexpr diagonal_matrix<matrix_t> operator-(
+    const diagonal_matrix<matrix_t> &a, const diagonal_matrix<matrix_t> &b) {
+  diagonal_matrix<matrix_t> c;
+  for (std::size_t i = 0u; i < c.rows(); ++i) {
+    c[i] = a[i] - b[i];
+  }
+  return c;
+}
+
+template <typename matrix_t>
+ALGEBRA_HOST_DEVICE constexpr diagonal_matrix<matrix_t> operator*(
+    const diagonal_matrix<matrix_t> &a, const diagonal_matrix<matrix_t> &b) {
+  diagonal_matrix<matrix_t> c;
+  for (std::size_t i = 0u; i < c.rows(); ++i) {
+    c[i] = a[i] * b[i];
+  }
+  return c;
+}
+/// @}
+
+/// Scaling of a diagonal matrix
+/// @{
+template <concepts::scalar scalar_t, typename matrix_t>
+ALGEBRA_HOST_DEVICE constexpr diagonal_matrix<matrix_t> operator*(
+    const scalar_t a, const diagonal_matrix<matrix_t> &d) {
+  diagonal_matrix<matrix_t> c;
+  for (std::size_t i = 0u; i < c.rows(); ++i) {
+    c[i] = a * d[i];
+  }
+  return c;
+}
+
+template <concepts::scalar scalar_t, typename matrix_t>
+ALGEBRA_HOST_DEVICE constexpr diagonal_matrix<matrix_t> operator*(
+    const diagonal_matrix<matrix_t> &d, const scalar_t a) {
+  return a * d;
+}
+/// @}
+
+/// Products of a diagonal matrix with dense matrices and vectors, which
+/// only scale the rows or columns of the dense operand
+/// @{
+template <typename matrix_t, typename MB>
+requires(!is_diagonal<MB> && (concepts::matrix<MB> || concepts::vector<MB>) &&
+         algebra::traits::rows<MB> == algebra::traits::rank<matrix_t>)
+    ALGEBRA_HOST_DEVICE constexpr auto
+    operator*(const diagonal_matrix<matrix_t> &d, const MB &b) {
+  return detail::scale_rows(d, b);
+}
+
+// Takes precedence over the scalar multiplication of storage::matrix
+template <typename matrix_t, template <typename, std::size_t> class array_t,
+          concepts::scalar scalar_t, std::size_t ROW, std::size_t COL>
+requires(ROW == algebra::traits::rank<matrix_t>) ALGEBRA_HOST_DEVICE
+    constexpr auto
+    operator*(const diagonal_matrix<matrix_t> &d,
+              const matrix<array_t, scalar_t, ROW, COL> &b) {
+  return detail::scale_rows(d, b);
+}
+
+template <concepts::matrix MA, typename matrix_t>
+requires(!is_diagonal<MA> &&
+         algebra::traits::columns<MA> == algebra::traits::rank<matrix_t>)
+    ALGEBRA_HOST_DEVICE constexpr auto
+    operator*(const MA &a, const diagonal_matrix<matrix_t> &d) {
+  return detail::scale_columns(a, d);
+}
+/// @}
+
+/// Sums and differences of a diagonal matrix with dense matrices, which only
+/// touch the diagonal of the dense operand
+/// @{
+template <typename matrix_t, concepts::square_matrix MB>
+requires(!is_diagonal<MB> &&
+         algebra::traits::rank<MB> == algebra::traits::rank<matrix_t>)
+    ALGEBRA_HOST_DEVICE constexpr auto
+    operator+(const diagonal_matrix<matrix_t> &d, const MB &b) {
+  return detail::add_diagonal<1, false>(b, d);
+}
+
+template <concepts::square_matrix MA, typename matrix_t>
+requires(!is_diagonal<MA> &&
+         algebra::traits::rank<MA> == algebra::traits::rank<matrix_t>)
+    ALGEBRA_HOST_DEVICE constexpr auto
+    operator+(const MA &a, const diagonal_matrix<matrix_t> &d) {
+  return detail::add_diagonal<1, false>(a, d);
+}
+
+template <typename matrix_t, concepts::square_matrix MB>
+requires(!is_diagonal<MB> &&
+         algebra::traits::rank<MB> == algebra::traits::rank<matrix_t>)
+    ALGEBRA_HOST_DEVICE constexpr auto
+    operator-(const diagonal_matrix<matrix_t> &d, const MB &b) {
+  return detail::add_diagonal<1, true>(b, d);
+}
+
+template <concepts::square_matrix MA, typename matrix_t>
+requires(!is_diagonal<MA> &&
+         algebra::traits::rank<MA> == algebra::traits::rank<matrix_t>)
+    ALGEBRA_HOST_DEVICE constexpr auto
+    operator-(const MA &a, const diagonal_matrix<matrix_t> &d) {
+  return detail::add_diagonal<-1, false>(a, d);
+}
+/// @}
+
+/// @returns the determinant of the diagonal matrix @param d
+template <typename matrix_t>
+ALGEBRA_HOST_DEVICE constexpr algebra::traits::scalar_t<matrix_t> determinant(
+    const diagonal_matrix<matrix_t> &d) {
+  algebra::traits::scalar_t<matrix_t> det{d[0]};
+  for (std::size_t i = 1u; i < d.rows(); ++i) {
+    det *= d[i];
+  }
+  return det;
+}
+
+/// @returns the inverse of the diagonal matrix @param d
+template <typename matrix_t>
+ALGEBRA_HOST_DEVICE constexpr diagonal_matrix<matrix_t> inverse(
+    const diagonal_matrix<matrix_t> &d) {
+
+  using scalar_t = algebra::traits::scalar_t<matrix_t>;
+
+  diagonal_matrix<matrix_t> inv;
+  for (std::size_t i = 0u; i < d.rows(); ++i) {
+    inv[i] = scalar_t(1) / d[i];
+  }
+  return inv;
+}
+
+/// @returns the transpose of the diagonal matrix @param d (itself)
+template <typename matrix_t>
+ALGEBRA_HOST_DEVICE constexpr diagonal_matrix<matrix_t> transpose(
+    const diagonal_matrix<matrix_t> &d) {
+  return d;
+}
+
+}  // namespace algebra::storage
+
+namespace algebra::traits {
+
+/// Type traits of the diagonal matrices
+/// @{
+template <typename matrix_t>
+struct index<storage::diagonal_matrix<matrix_t>> : public index<matrix_t> {};
+
+template <typename matrix_t>
+struct dimensions<storage::diagonal_matrix<matrix_t>> {
+
+  using size_type = index_t<storage::diagonal_matrix<matrix_t>>;
+
+  static constexpr size_type dim{2};
+  static constexpr size_type rows{
+      storage::diagonal_matrix<matrix_t>::rows()};
+  static constexpr size_type columns{
+      storage::diagonal_matrix<matrix_t>::columns()};
+};
+
+template <typename matrix_t>
+struct value<storage::diagonal_matrix<matrix_t>> : public value<matrix_t> {};
+
+template <typename matrix_t>
+struct scalar<storage::diagonal_matrix<matrix_t>> : public scalar<matrix_t> {};
+
+template <typename matrix_t>
+struct vector<storage::diagonal_matrix<matrix_t>> : public vector<matrix_t> {};
+
+template <typename matrix_t>
+struct matrix<storage::diagonal_matrix<matrix_t>> : public matrix<matrix_t> {};
+
+template <typename matrix_t>
+struct element_getter<storage::diagonal_matrix<matrix_t>> {
+  using type = storage::diagonal_element_getter;
+};
+/// @}
+
+}  // namespace algebra::traits
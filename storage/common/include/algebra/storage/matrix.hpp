@@ -65,6 +65,10 @@ struct ALGEBRA_ALIGN(alignof(storage::vector<ROW, scalar_t, array_t>)) matrix {
   ALGEBRA_HOST_DEVICE
   static consteval std::size_t columns() { return COL; }
 
+  /// @returns the number of vectors the matrix is stored in
+  ALGEBRA_HOST_DEVICE
+  static consteval std::size_t storage_vectors() { return COL; }
+
  private:
   /// Equality operator between two matrices
   template <std::size_t R, std::size_t C, typename S,
@@ -132,13 +136,14 @@ struct ALGEBRA_ALIGN(alignof(storage::vector<ROW, scalar_t, array_t>)) matrix {
 };  // struct matrix
 
 /// Get a zero-initialized matrix
-template <concepts::matrix matrix_t, std::size_t COLS = matrix_t::columns()>
+template <concepts::matrix matrix_t,
+          std::size_t N = matrix_t::storage_vectors()>
 ALGEBRA_HOST_DEVICE constexpr matrix_t zero() noexcept {
 
   matrix_t m;
 
-  ALGEBRA_UNROLL_N(COLS)
-  for (std::size_t j = 0u; j < COLS; ++j) {
+  ALGEBRA_UNROLL_N(N)
+  for (std::size_t j = 0u; j < N; ++j) {
     // Fill zero initialized vector
     m[j] = typename matrix_t::vector_type{};
   }
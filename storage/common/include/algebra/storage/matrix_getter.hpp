@@ -9,6 +9,7 @@
 // Project include(s).
 #include "algebra/concepts.hpp"
 #include "algebra/storage/matrix.hpp"
+#include "algebra/storage/row_major_matrix.hpp"
 #include "algebra/storage/vector.hpp"
 
 // System include(s).
@@ -66,6 +67,51 @@ struct element_getter {
     return m[0][row];
   }
 
+  /// Get const access to a row major matrix element
+  template <template <typename, std::size_t> class array_t,
+            concepts::scalar scalar_t, std::size_t ROW, std::size_t COL>
+  ALGEBRA_HOST_DEVICE constexpr decltype(auto) operator()(
+      const row_major_matrix<array_t, scalar_t, ROW, COL> &m, std::size_t row,
+      std::size_t col) const {
+
+    assert(row < ROW);
+    assert(col < COL);
+    return m[row][col];
+  }
+
+  /// Get non-const access to a row major matrix element
+  template <template <typename, std::size_t> class array_t,
+            concepts::scalar scalar_t, std::size_t ROW, std::size_t COL>
+  ALGEBRA_HOST_DEVICE constexpr decltype(auto) operator()(
+      row_major_matrix<array_t, scalar_t, ROW, COL> &m, std::size_t row,
+      std::size_t col) const {
+
+    assert(row < ROW);
+    assert(col < COL);
+    return m[row][col];
+  }
+
+  /// Get const access to a row major matrix element
+  template <template <typename, std::size_t> class array_t,
+            concepts::scalar scalar_t, std::size_t ROW>
+  ALGEBRA_HOST_DEVICE constexpr decltype(auto) operator()(
+      const row_major_matrix<array_t, scalar_t, ROW, 1> &m,
+      std::size_t row) const {
+
+    assert(row < ROW);
+    return m[row][0];
+  }
+
+  /// Get non-const access to a row major matrix element
+  template <template <typename, std::size_t> class array_t,
+            concepts::scalar scalar_t, std::size_t ROW>
+  ALGEBRA_HOST_DEVICE constexpr decltype(auto) operator()(
+      row_major_matrix<array_t, scalar_t, ROW, 1> &m, std::size_t row) const {
+
+    assert(row < ROW);
+    return m[row][0];
+  }
+
   /// Get const access to a vector element
   template <template <typename, std::size_t> class array_t,
             concepts::scalar scalar_t, std::size_t N>
@@ -121,6 +167,24 @@ ALGEBRA_HOST_DEVICE constexpr decltype(auto) element(
   return element_getter{}(m, row);
 }
 
+/// Function extracting an element from a row major matrix (const)
+template <std::size_t ROW, std::size_t COL, concepts::scalar scalar_t,
+          template <typename, std::size_t> class array_t>
+ALGEBRA_HOST_DEVICE constexpr decltype(auto) element(
+    const row_major_matrix<array_t, scalar_t, ROW, COL> &m, std::size_t row,
+    std::size_t col) {
+  return element_getter{}(m, row, col);
+}
+
+/// Function extracting an element from a row major matrix (non-const)
+template <std::size_t ROW, std::size_t COL, concepts::scalar scalar_t,
+          template <typename, std::size_t> class array_t>
+ALGEBRA_HOST_DEVICE constexpr decltype(auto) element(
+    row_major_matrix<array_t, scalar_t, ROW, COL> &m, std::size_t row,
+    std::size_t col) {
+  return element_getter{}(m, row, col);
+}
+
 /// Function extracting an element from a vector (const)
 template <std::size_t N, concepts::scalar scalar_t,
           template <typename, std::size_t> class array_t>
@@ -209,6 +273,67 @@ struct block_getter {
     return res_v;
   }
 
+  /// Get a block of a const row major matrix
+  template <std::size_t ROWS, std::size_t COLS, std::size_t mROW,
+            std::size_t mCOL, concepts::scalar scalar_t,
+            template <typename, std::size_t> class array_t>
+  ALGEBRA_HOST_DEVICE constexpr auto operator()(
+      const row_major_matrix<array_t, scalar_t, mROW, mCOL> &m,
+      const std::size_t row, const std::size_t col) noexcept {
+
+    static_assert(ROWS <= mROW);
+    static_assert(COLS <= mCOL);
+    assert(row + ROWS <= mROW);
+    assert(col + COLS <= mCOL);
+
+    using input_matrix_t = row_major_matrix<array_t, scalar_t, mROW, mCOL>;
+    using matrix_t = row_major_matrix<array_t, scalar_t, ROWS, COLS>;
+
+    matrix_t res_m;
+
+    // Don't access single elements in underlying vectors unless necessary
+    if constexpr (matrix_t::storage_columns() ==
+                  input_matrix_t::storage_columns()) {
+      if (col == 0u) {
+        for (std::size_t i = row; i < row + ROWS; ++i) {
+          res_m[i - row] = m[i];
+        }
+
+        return res_m;
+      }
+    }
+
+    for (std::size_t i = row; i < row + ROWS; ++i) {
+      for (std::size_t j = col; j < col + COLS; ++j) {
+        res_m[i - row][j - col] = m[i][j];
+      }
+    }
+
+    return res_m;
+  }
+
+  /// Get a (column) vector of a const row major matrix
+  template <std::size_t SIZE, std::size_t ROWS, std::size_t COLS,
+            concepts::scalar scalar_t,
+            template <typename, std::size_t> class array_t>
+  ALGEBRA_HOST_DEVICE constexpr auto vector(
+      const row_major_matrix<array_t, scalar_t, ROWS, COLS> &m,
+      const std::size_t row, const std::size_t col) noexcept {
+
+    static_assert(SIZE <= ROWS);
+    assert(row + SIZE <= ROWS);
+    assert(col < COLS);
+
+    algebra::storage::vector<SIZE, scalar_t, array_t> res_v{};
+
+    // The column is spread across the row vectors
+    for (std::size_t i = row; i < row + SIZE; ++i) {
+      res_v[i - row] = m[i][col];
+    }
+
+    return res_v;
+  }
+
 };  // struct block_getter
 
 /// Get a block of a const matrix
@@ -221,6 +346,16 @@ ALGEBRA_HOST_DEVICE constexpr auto block(
   return block_getter{}.template operator()<ROWS, COLS>(m, row, col);
 }
 
+/// Get a block of a const row major matrix
+template <std::size_t ROWS, std::size_t COLS, std::size_t mROW,
+          std::size_t mCOL, concepts::scalar scalar_t,
+          template <typename, std::size_t> class array_t>
+ALGEBRA_HOST_DEVICE constexpr auto block(
+    const row_major_matrix<array_t, scalar_t, mROW, mCOL> &m,
+    const std::size_t row, const std::size_t col) noexcept {
+  return block_getter{}.template operator()<ROWS, COLS>(m, row, col);
+}
+
 /// Get a block of a const matrix
 template <std::size_t ROWS, std::size_t COLS, std::size_t mROW,
           std::size_t mCOL, concepts::scalar scalar_t,
@@ -283,4 +418,55 @@ ALGEBRA_HOST_DEVICE constexpr void set_block(
   }
 }
 
+/// Operator setting a block of a row major matrix
+template <std::size_t ROWS, std::size_t COLS, std::size_t mROW,
+          std::size_t mCOL, concepts::scalar scalar_t,
+          template <typename, std::size_t> class array_t>
+ALGEBRA_HOST_DEVICE constexpr void set_block(
+    row_major_matrix<array_t, scalar_t, mROW, mCOL> &m,
+    const row_major_matrix<array_t, scalar_t, ROWS, COLS> &b,
+    const std::size_t row, const std::size_t col) noexcept {
+  static_assert(ROWS <= mROW);
+  static_assert(COLS <= mCOL);
+  assert(row + ROWS <= mROW);
+  assert(col + COLS <= mCOL);
+
+  using input_matrix_t = row_major_matrix<array_t, scalar_t, mROW, mCOL>;
+  using matrix_t = row_major_matrix<array_t, scalar_t, ROWS, COLS>;
+
+  // Don't access single elements in underlying vectors unless necessary
+  if constexpr (COLS == mCOL && matrix_t::storage_columns() ==
+                                    input_matrix_t::storage_columns()) {
+    if (col == 0u) {
+      for (std::size_t i = row; i < row + ROWS; ++i) {
+        m[i] = b[i - row];
+      }
+      return;
+    }
+  }
+  for (std::size_t i = row; i < row + ROWS; ++i) {
+    for (std::size_t j = col; j < col + COLS; ++j) {
+      m[i][j] = b[i - row][j - col];
+    }
+  }
+}
+
+/// Operator setting a (column) block of a row major matrix with a vector
+template <std::size_t ROWS, std::size_t COLS, std::size_t N,
+          concepts::scalar scalar_t,
+          template <typename, std::size_t> class array_t>
+ALGEBRA_HOST_DEVICE constexpr void set_block(
+    row_major_matrix<array_t, scalar_t, ROWS, COLS> &m,
+    const vector<N, scalar_t, array_t> &b, const std::size_t row,
+    const std::size_t col) noexcept {
+
+  static_assert(N <= ROWS);
+  assert(row + N <= ROWS);
+  assert(col < COLS);
+
+  for (std::size_t i = row; i < N + row; ++i) {
+    m[i][col] = b[i - row];
+  }
+}
+
 }  // namespace algebra::storage
@@ -0,0 +1,896 @@
+/** Algebra plugins library, part of the ACTS project
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "algebra/concepts.hpp"
+#include "algebra/qualifiers.hpp"
+#include "algebra/type_traits.hpp"
+
+// System include(s).
+#include <cassert>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+namespace algebra::storage {
+
+/// Stride of a view that is only known at runtime
+inline constexpr std::size_t dynamic_stride{
+    std::numeric_limits<std::size_t>::max()};
+
+namespace detail {
+
+/// Stride that is known at compile time
+template <std::size_t S>
+struct stride {
+
+  ALGEBRA_HOST_DEVICE
+  constexpr explicit stride([[maybe_unused]] const std::size_t s = S) {
+    assert(s == S);
+  }
+
+  ALGEBRA_HOST_DEVICE
+  constexpr std::size_t operator()() const { return S; }
+};
+
+/// Stride that is only known at runtime
+template <>
+struct stride<dynamic_stride> {
+
+  ALGEBRA_HOST_DEVICE
+  constexpr explicit stride(const std::size_t s) : m_value{s} {
+    assert(s != dynamic_stride);
+  }
+
+  ALGEBRA_HOST_DEVICE
+  constexpr std::size_t operator()() const { return m_value; }
+
+ private:
+  std::size_t m_value;
+};
+
+}  // namespace detail
+
+/// Non-owning view of a matrix in an external buffer
+///
+/// The view has the dimensions and the value type of the matrix type
+/// @tparam matrix_t, which is also the type of new matrices that are created
+/// from the view (e.g. by @c transpose or @c inverse). The element (i, j) is
+/// found at @c data[i * ROW_STRIDE + j * COL_STRIDE], i.e. the default strides
+/// describe a densely packed column major matrix. Strides that are only known
+/// at runtime are given as @c dynamic_stride and passed to the constructor.
+///
+/// A @c const qualified @tparam matrix_t makes a read-only view. Like for
+/// @c std::span, the view is shallow const. Like for @c Eigen::Map, assigning
+/// to the view copies the elements into the buffer and converting it to
+/// @c matrix_t copies them out of the buffer.
+template <typename matrix_t, std::size_t ROW_STRIDE = 1u,
+          std::size_t COL_STRIDE =
+              algebra::traits::rows<std::remove_const_t<matrix_t>>>
+requires concepts::matrix<std::remove_const_t<matrix_t>> class matrix_view {
+
+ public:
+  /// Matrix type that owns its elements
+  using matrix_type = std::remove_const_t<matrix_t>;
+  using value_type = algebra::traits::value_t<matrix_type>;
+  using size_type = algebra::traits::index_t<matrix_type>;
+  using element_type =
+      std::conditional_t<std::is_const_v<matrix_t>, const value_type,
+                         value_type>;
+
+  /// Construct from the buffer @param data and the strides
+  ALGEBRA_HOST_DEVICE
+  constexpr explicit matrix_view(element_type *data,
+                                 const std::size_t row_stride = ROW_STRIDE,
+                                 const std::size_t col_stride = COL_STRIDE)
+      : m_data{data}, m_row_stride{row_stride}, m_col_stride{col_stride} {
+    assert(data != nullptr);
+  }
+
+  matrix_view(const matrix_view &) = default;
+
+  /// Copy the elements of @param other into the buffer
+  ALGEBRA_HOST_DEVICE
+  constexpr matrix_view &operator=(const matrix_view &other) {
+    return assign(other);
+  }
+
+  /// Copy the elements of the matrix @param m into the buffer
+  template <concepts::matrix other_matrix_t>
+  requires(algebra::traits::rows<other_matrix_t> ==
+               algebra::traits::rows<matrix_type> &&
+           algebra::traits::columns<other_matrix_t> ==
+               algebra::traits::columns<matrix_type>)
+      ALGEBRA_HOST_DEVICE constexpr matrix_view &operator=(
+          const other_matrix_t &m) {
+    return assign(m);
+  }
+
+  /// Copy the elements into a new matrix that owns them
+  ALGEBRA_HOST_DEVICE
+  constexpr operator matrix_type() const {
+
+    using element_getter_t = algebra::traits::element_getter_t<matrix_type>;
+
+    matrix_type m;
+    for (std::size_t j = 0u; j < columns(); ++j) {
+      for (std::size_t i = 0u; i < rows(); ++i) {
+        element_getter_t{}(m, i, j) = (*this)(i, j);
+      }
+    }
+    return m;
+  }
+
+  /// Element access
+  ALGEBRA_HOST_DEVICE
+  constexpr element_type &operator()(const std::size_t row,
+                                     const std::size_t col) const {
+    assert(row < rows());
+    assert(col < columns());
+    return m_data[row * m_row_stride() + col * m_col_stride()];
+  }
+
+  /// @returns the number of rows
+  ALGEBRA_HOST_DEVICE
+  static consteval std::size_t rows() {
+    return algebra::traits::rows<matrix_type>;
+  }
+
+  /// @returns the number of columns
+  ALGEBRA_HOST_DEVICE
+  static consteval std::size_t columns() {
+    return algebra::traits::columns<matrix_type>;
+  }
+
+  /// @returns the distance between two rows in the buffer
+  ALGEBRA_HOST_DEVICE
+  constexpr std::size_t row_stride() const { return m_row_stride(); }
+
+  /// @returns the distance between two columns in the buffer
+  ALGEBRA_HOST_DEVICE
+  constexpr std::size_t col_stride() const { return m_col_stride(); }
+
+  /// @returns the underlying buffer
+  ALGEBRA_HOST_DEVICE
+  constexpr element_type *data() const { return m_data; }
+
+ private:
+  /// Element-wise copy of the matrix @param m into the buffer
+  template <concepts::matrix other_matrix_t>
+  ALGEBRA_HOST_DEVICE constexpr matrix_view &assign(const other_matrix_t &m) {
+    static_assert(!std::is_const_v<matrix_t>,
+                  "Cannot assign to a read-only view");
+
+    using element_getter_t = algebra::traits::element_getter_t<other_matrix_t>;
+
+    for (std::size_t j = 0u; j < columns(); ++j) {
+      for (std::size_t i = 0u; i < rows(); ++i) {
+        (*this)(i, j) = element_getter_t{}(m, i, j);
+      }
+    }
+    return *this;
+  }
+
+  /// Start of the matrix in the external buffer
+  element_type *m_data;
+  /// Distances between the rows and columns in the buffer
+  [[no_unique_address]] detail::stride<ROW_STRIDE> m_row_stride;
+  [[no_unique_address]] detail::stride<COL_STRIDE> m_col_stride;
+
+};  // class matrix_view
+
+/// Non-owning view of a vector in an external buffer
+///
+/// The element i is found at @c data[i * STRIDE]. See @c matrix_view.
+template <typename vector_t, std::size_t STRIDE = 1u>
+requires concepts::vector<std::remove_const_t<vector_t>> class vector_view {
+
+ public:
+  /// Vector type that owns its elements
+  using vector_type = std::remove_const_t<vector_t>;
+  using value_type = algebra::traits::value_t<vector_type>;
+  using size_type = algebra::traits::index_t<vector_type>;
+  using element_type =
+      std::conditional_t<std::is_const_v<vector_t>, const value_type,
+                         value_type>;
+
+  /// Construct from the buffer @param data and the stride
+  ALGEBRA_HOST_DEVICE
+  constexpr explicit vector_view(element_type *data,
+                                 const std::size_t stride = STRIDE)
+      : m_data{data}, m_stride{stride} {
+    assert(data != nullptr);
+  }
+
+  vector_view(const vector_view &) = default;
+
+  /// Copy the elements of @param other into the buffer
+  ALGEBRA_HOST_DEVICE
+  constexpr vector_view &operator=(const vector_view &other) {
+    return assign(other);
+  }
+
+  /// Copy the elements of the vector @param v into the buffer
+  template <concepts::vector other_vector_t>
+  requires(algebra::traits::rows<other_vector_t> ==
+           algebra::traits::rows<vector_type>)
+      ALGEBRA_HOST_DEVICE constexpr vector_view &operator=(
+          const other_vector_t &v) {
+    return assign(v);
+  }
+
+  /// Copy the elements into a new vector that owns them
+  ALGEBRA_HOST_DEVICE
+  constexpr operator vector_type() const {
+
+    using element_getter_t = algebra::traits::element_getter_t<vector_type>;
+
+    vector_type v;
+    for (std::size_t i = 0u; i < size(); ++i) {
+      element_getter_t{}(v, i) = (*this)(i);
+    }
+    return v;
+  }
+
+  /// Element access
+  /// @{
+  ALGEBRA_HOST_DEVICE
+  constexpr element_type &operator()(const std::size_t i) const {
+    assert(i < size());
+    return m_data[i * m_stride()];
+  }
+  ALGEBRA_HOST_DEVICE
+  constexpr element_type &operator[](const std::size_t i) const {
+    return (*this)(i);
+  }
+  /// @}
+
+  /// @returns the number of elements
+  ALGEBRA_HOST_DEVICE
+  static consteval std::size_t size() {
+    return algebra::traits::rows<vector_type>;
+  }
+
+  /// @returns the distance between two elements in the buffer
+  ALGEBRA_HOST_DEVICE
+  constexpr std::size_t stride() const { return m_stride(); }
+
+  /// @returns the underlying buffer
+  ALGEBRA_HOST_DEVICE
+  constexpr element_type *data() const { return m_data; }
+
+ private:
+  /// Element-wise copy of the vector @param v into the buffer
+  template <concepts::vector other_vector_t>
+  ALGEBRA_HOST_DEVICE constexpr vector_view &assign(const other_vector_t &v) {
+    static_assert(!std::is_const_v<vector_t>,
+                  "Cannot assign to a read-only view");
+
+    using element_getter_t = algebra::traits::element_getter_t<other_vector_t>;
+
+    for (std::size_t i = 0u; i < size(); ++i) {
+      (*this)(i) = element_getter_t{}(v, i);
+    }
+    return *this;
+  }
+
+  /// Start of the vector in the external buffer
+  element_type *m_data;
+  /// Distance between the elements in the buffer
+  [[no_unique_address]] detail::stride<STRIDE> m_stride;
+
+};  // class vector_view
+
+/// Lazy transpose of a matrix
+///
+/// Refers to the elements of the matrix @tparam matrix_t instead of copying
+/// them, so writing to the view modifies the matrix. A @c const qualified
+/// @tparam matrix_t makes a read-only view.
+template <typename matrix_t>
+requires concepts::matrix<std::remove_const_t<matrix_t>> class transpose_view {
+
+ public:
+  /// Type of the matrix that is being transposed
+  using parent_type = std::remove_const_t<matrix_t>;
+  using value_type = algebra::traits::value_t<parent_type>;
+  using size_type = algebra::traits::index_t<parent_type>;
+
+  /// Construct from the matrix @param m
+  ALGEBRA_HOST_DEVICE
+  constexpr explicit transpose_view(matrix_t &m) : m_matrix{m} {}
+
+  transpose_view(const transpose_view &) = default;
+
+  /// Copy the elements of the matrix @param m into the transposed matrix
+  template <concepts::matrix other_matrix_t>
+  requires(algebra::traits::rows<other_matrix_t> ==
+               algebra::traits::columns<parent_type> &&
+           algebra::traits::columns<other_matrix_t> ==
+               algebra::traits::rows<parent_type>)
+      ALGEBRA_HOST_DEVICE constexpr transpose_view &operator=(
+          const other_matrix_t &m) {
+
+    using element_getter_t = algebra::traits::element_getter_t<other_matrix_t>;
+
+    for (std::size_t j = 0u; j < columns(); ++j) {
+      for (std::size_t i = 0u; i < rows(); ++i) {
+        (*this)(i, j) = element_getter_t{}(m, i, j);
+      }
+    }
+    return *this;
+  }
+
+  /// Element access
+  ALGEBRA_HOST_DEVICE
+  constexpr decltype(auto) operator()(const std::size_t row,
+                                      const std::size_t col) const {
+    return algebra::traits::element_getter_t<parent_type>{}(m_matrix, col,
+                                                             row);
+  }
+
+  /// @returns the number of rows
+  ALGEBRA_HOST_DEVICE
+  static consteval std::size_t rows() {
+    return algebra::traits::columns<parent_type>;
+  }
+
+  /// @returns the number of columns
+  ALGEBRA_HOST_DEVICE
+  static consteval std::size_t columns() {
+    return algebra::traits::rows<parent_type>;
+  }
+
+  /// @returns the matrix that is being transposed
+  ALGEBRA_HOST_DEVICE
+  constexpr matrix_t &matrix() const { return m_matrix; }
+
+ private:
+  matrix_t &m_matrix;
+
+};  // class transpose_view
+
+/// Lazy block of size @tparam ROWS x @tparam COLS of a matrix
+///
+/// Refers to the elements of the matrix @tparam matrix_t instead of copying
+/// them, so writing to the view modifies the matrix. A @c const qualified
+/// @tparam matrix_t makes a read-only view.
+template <typename matrix_t, std::size_t ROWS, std::size_t COLS>
+requires concepts::matrix<std::remove_const_t<matrix_t>> class block_view {
+
+ public:
+  /// Type of the matrix that the block is taken from
+  using parent_type = std::remove_const_t<matrix_t>;
+  using value_type = algebra::traits::value_t<parent_type>;
+  using size_type = algebra::traits::index_t<parent_type>;
+
+  static_assert(ROWS <= algebra::traits::rows<parent_type>);
+  static_assert(COLS <= algebra::traits::columns<parent_type>);
+
+  /// Construct from the matrix @param m and the position of the block
+  ALGEBRA_HOST_DEVICE
+  constexpr block_view(matrix_t &m, const std::size_t row,
+                       const std::size_t col)
+      : m_matrix{m}, m_row{row}, m_col{col} {
+    assert(row + ROWS <= algebra::traits::rows<parent_type>);
+    assert(col + COLS <= algebra::traits::columns<parent_type>);
+  }
+
+  block_view(const block_view &) = default;
+
+  /// Copy the elements of the matrix @param m into the block
+  template <concepts::matrix other_matrix_t>
+  requires(algebra::traits::rows<other_matrix_t> == ROWS &&
+           algebra::traits::columns<other_matrix_t> == COLS)
+      ALGEBRA_HOST_DEVICE constexpr block_view &operator=(
+          const other_matrix_t &m) {
+
+    using element_getter_t = algebra::traits::element_getter_t<other_matrix_t>;
+
+    for (std::size_t j = 0u; j < COLS; ++j) {
+      for (std::size_t i = 0u; i < ROWS; ++i) {
+        (*this)(i, j) = element_getter_t{}(m, i, j);
+      }
+    }
+    return *this;
+  }
+
+  /// Element access
+  ALGEBRA_HOST_DEVICE
+  constexpr decltype(auto) operator()(const std::size_t row,
+                                      const std::size_t col) const {
+    assert(row < ROWS);
+    assert(col < COLS);
+    return algebra::traits::element_getter_t<parent_type>{}(
+        m_matrix, m_row + row, m_col + col);
+  }
+
+  /// @returns the number of rows
+  ALGEBRA_HOST_DEVICE
+  static consteval std::size_t rows() { return ROWS; }
+
+  /// @returns the number of columns
+  ALGEBRA_HOST_DEVICE
+  static consteval std::size_t columns() { return COLS; }
+
+  /// @returns the matrix that the block is taken from
+  ALGEBRA_HOST_DEVICE
+  constexpr matrix_t &matrix() const { return m_matrix; }
+
+  /// @returns the first row of the block in the matrix
+  ALGEBRA_HOST_DEVICE
+  constexpr std::size_t row() const { return m_row; }
+
+  /// @returns the first column of the block in the matrix
+  ALGEBRA_HOST_DEVICE
+  constexpr std::size_t col() const { return m_col; }
+
+ private:
+  matrix_t &m_matrix;
+  /// Position of the block in the matrix
+  std::size_t m_row;
+  std::size_t m_col;
+
+};  // class block_view
+
+/// Check whether a type is a matrix or vector view
+/// @{
+template <typename T>
+inline constexpr bool is_view{false};
+
+template <typename matrix_t, std::size_t RS, std::size_t CS>
+inline constexpr bool is_view<matrix_view<matrix_t, RS, CS>>{true};
+
+template <typename vector_t, std::size_t S>
+inline constexpr bool is_view<vector_view<vector_t, S>>{true};
+
+template <typename matrix_t>
+inline constexpr bool is_view<transpose_view<matrix_t>>{true};
+
+template <typename matrix_t, std::size_t ROWS, std::size_t COLS>
+inline constexpr bool is_view<block_view<matrix_t, ROWS, COLS>>{true};
+/// @}
+
+/// Functor used to access elements of matrix and vector views
+///
+/// The owning matrices that the algorithms create from a view (e.g. the
+/// result of an inversion) are accessed through their own element getter.
+struct view_element_getter {
+
+  /// Get access to a matrix element
+  template <typename matrix_t, std::size_t RS, std::size_t CS>
+  ALGEBRA_HOST_DEVICE constexpr decltype(auto) operator()(
+      const matrix_view<matrix_t, RS, CS> &m, std::size_t row,
+      std::size_t col) const {
+    return m(row, col);
+  }
+
+  /// Get access to an element of a column matrix
+  template <typename matrix_t, std::size_t RS, std::size_t CS>
+  requires(algebra::traits::columns<std::remove_const_t<matrix_t>> == 1)
+      ALGEBRA_HOST_DEVICE constexpr decltype(auto)
+      operator()(const matrix_view<matrix_t, RS, CS> &m,
+                 std::size_t row) const {
+    return m(row, 0u);
+  }
+
+  /// Get access to a vector element
+  template <typename vector_t, std::size_t S>
+  ALGEBRA_HOST_DEVICE constexpr decltype(auto) operator()(
+      const vector_view<vector_t, S> &v, std::size_t row) const {
+    return v(row);
+  }
+
+  /// Get access to a vector element, treating the vector as column matrix
+  template <typename vector_t, std::size_t S>
+  ALGEBRA_HOST_DEVICE constexpr decltype(auto) operator()(
+      const vector_view<vector_t, S> &v, std::size_t row,
+      [[maybe_unused]] std::size_t col) const {
+    assert(col == 0u);
+    return v(row);
+  }
+
+  /// Get access to an element of a lazy transpose
+  template <typename matrix_t>
+  ALGEBRA_HOST_DEVICE constexpr decltype(auto) operator()(
+      const transpose_view<matrix_t> &m, std::size_t row,
+      std::size_t col) const {
+    return m(row, col);
+  }
+
+  /// Get access to an element of a lazy block
+  template <typename matrix_t, std::size_t ROWS, std::size_t COLS>
+  ALGEBRA_HOST_DEVICE constexpr decltype(auto) operator()(
+      const block_view<matrix_t, ROWS, COLS> &m, std::size_t row,
+      std::size_t col) const {
+    return m(row, col);
+  }
+
+  /// Get access to an element of an owning matrix or vector
+  template <typename T, typename... I>
+  requires(!is_view<std::remove_cvref_t<T>>) ALGEBRA_HOST_DEVICE
+      constexpr decltype(auto)
+      operator()(T &&m, I... indices) const {
+    using element_getter_t =
+        algebra::traits::element_getter_t<std::remove_cvref_t<T>>;
+    return element_getter_t{}(std::forward<T>(m), indices...);
+  }
+
+};  // struct view_element_getter
+
+/// Functor used to access blocks of matrix views
+///
+/// The blocks are views into the same buffer, i.e. no elements are copied.
+struct view_block_getter {
+
+  /// @returns a view of the block of size @tparam ROWS x @tparam COLS of
+  /// @param m, starting at row @param row and column @param col
+  template <std::size_t ROWS, std::size_t COLS, typename matrix_t,
+            std::size_t RS, std::size_t CS>
+  ALGEBRA_HOST_DEVICE constexpr auto operator()(
+      const matrix_view<matrix_t, RS, CS> &m, std::size_t row,
+      std::size_t col) const {
+
+    static_assert(ROWS <= m.rows());
+    static_assert(COLS <= m.columns());
+    assert(row + ROWS <= m.rows());
+    assert(col + COLS <= m.columns());
+
+    using view_t = matrix_view<matrix_t, RS, CS>;
+    using block_t =
+        algebra::traits::get_matrix_t<typename view_t::matrix_type, ROWS,
+                                      COLS, typename view_t::value_type>;
+
+    return matrix_view<
+        std::conditional_t<std::is_const_v<matrix_t>, const block_t, block_t>,
+        RS, CS>{&m(row, col), m.row_stride(), m.col_stride()};
+  }
+
+  /// @returns a view of the column vector of size @tparam SIZE of @param m,
+  /// starting at row @param row in the column @param col
+  template <std::size_t SIZE, typename matrix_t, std::size_t RS,
+            std::size_t CS>
+  ALGEBRA_HOST_DEVICE constexpr auto vector(
+      const matrix_view<matrix_t, RS, CS> &m, std::size_t row,
+      std::size_t col) const {
+
+    static_assert(SIZE <= m.rows());
+    assert(row + SIZE <= m.rows());
+    assert(col < m.columns());
+
+    using view_t = matrix_view<matrix_t, RS, CS>;
+    using vector_t =
+        algebra::traits::get_vector_t<typename view_t::matrix_type, SIZE,
+                                      typename view_t::value_type>;
+
+    return vector_view<std::conditional_t<std::is_const_v<matrix_t>,
+                                          const vector_t, vector_t>,
+                       RS>{&m(row, col), m.row_stride()};
+  }
+
+  /// @returns the block of size @tparam ROWS x @tparam COLS of the lazy
+  /// block @param m, as a lazy block of the underlying matrix
+  template <std::size_t ROWS, std::size_t COLS, typename matrix_t,
+            std::size_t bROWS, std::size_t bCOLS>
+  ALGEBRA_HOST_DEVICE constexpr auto operator()(
+      const block_view<matrix_t, bROWS, bCOLS> &m, std::size_t row,
+      std::size_t col) const {
+
+    static_assert(ROWS <= bROWS);
+    static_assert(COLS <= bCOLS);
+    assert(row + ROWS <= bROWS);
+    assert(col + COLS <= bCOLS);
+
+    return block_view<matrix_t, ROWS, COLS>{m.matrix(), m.row() + row,
+                                            m.col() + col};
+  }
+
+};  // struct view_block_getter
+
+/// Function extracting an element from a matrix view
+template <typename matrix_t, std::size_t RS, std::size_t CS>
+ALGEBRA_HOST_DEVICE constexpr decltype(auto) element(
+    const matrix_view<matrix_t, RS, CS> &m, std::size_t row, std::size_t col) {
+  return view_element_getter{}(m, row, col);
+}
+
+/// Function extracting an element from a vector view
+template <typename vector_t, std::size_t S>
+ALGEBRA_HOST_DEVICE constexpr decltype(auto) element(
+    const vector_view<vector_t, S> &v, std::size_t row) {
+  return view_element_getter{}(v, row);
+}
+
+/// @returns a view of the block of size @tparam ROWS x @tparam COLS of the
+/// view @param m, starting at row @param row and column @param col
+template <std::size_t ROWS, std::size_t COLS, typename matrix_t,
+          std::size_t RS, std::size_t CS>
+ALGEBRA_HOST_DEVICE constexpr auto block(const matrix_view<matrix_t, RS, CS> &m,
+                                         std::size_t row, std::size_t col) {
+  return view_block_getter{}.template operator()<ROWS, COLS>(m, row, col);
+}
+
+/// Function extracting an element from a lazy transpose
+template <typename matrix_t>
+ALGEBRA_HOST_DEVICE constexpr decltype(auto) element(
+    const transpose_view<matrix_t> &m, std::size_t row, std::size_t col) {
+  return view_element_getter{}(m, row, col);
+}
+
+/// Function extracting an element from a lazy block
+template <typename matrix_t, std::size_t ROWS, std::size_t COLS>
+ALGEBRA_HOST_DEVICE constexpr decltype(auto) element(
+    const block_view<matrix_t, ROWS, COLS> &m, std::size_t row,
+    std::size_t col) {
+  return view_element_getter{}(m, row, col);
+}
+
+/// @returns the lazy transpose of the matrix @param m
+/// @{
+template <typename matrix_t>
+requires concepts::matrix<matrix_t> ALGEBRA_HOST_DEVICE constexpr auto
+lazy_transpose(matrix_t &m) {
+  return transpose_view<matrix_t>{m};
+}
+
+// The view must not outlive the matrix
+template <typename matrix_t>
+void lazy_transpose(const matrix_t &&) = delete;
+/// @}
+
+/// @returns the lazy block of size @tparam ROWS x @tparam COLS of the matrix
+/// @param m, starting at row @param row and column @param col
+/// @{
+template <std::size_t ROWS, std::size_t COLS, typename matrix_t>
+requires concepts::matrix<matrix_t> ALGEBRA_HOST_DEVICE constexpr auto
+lazy_block(matrix_t &m, std::size_t row, std::size_t col) {
+  return block_view<matrix_t, ROWS, COLS>{m, row, col};
+}
+
+// The view must not outlive the matrix
+template <std::size_t ROWS, std::size_t COLS, typename matrix_t>
+void lazy_block(const matrix_t &&, std::size_t, std::size_t) = delete;
+/// @}
+
+/// Sets the elements of the view @param b as the submatrix of @param m
+/// beginning at row @param row and column @param col, without copying the
+/// view into a temporary matrix first
+template <concepts::matrix matrix_t, concepts::matrix view_t>
+requires is_view<view_t> ALGEBRA_HOST_DEVICE constexpr void set_block(
+    matrix_t &m, const view_t &b, std::size_t row, std::size_t col) {
+
+  using element_getter_t = algebra::traits::element_getter_t<matrix_t>;
+
+  for (std::size_t j = 0u; j < algebra::traits::columns<view_t>; ++j) {
+    for (std::size_t i = 0u; i < algebra::traits::rows<view_t>; ++i) {
+      element_getter_t{}(m, i + row, j + col) = view_element_getter{}(b, i, j);
+    }
+  }
+}
+
+/// Matrix-matrix and matrix-vector products that involve views
+///
+/// The elements of the views are read in place and the result is a new
+/// matrix (or vector) that owns its elements.
+template <concepts::matrix MA, typename MB>
+requires((is_view<MA> || is_view<MB>) &&
+         (concepts::matrix<MB> || concepts::vector<MB>) &&
+         algebra::traits::columns<MA> == algebra::traits::rows<MB>)
+    ALGEBRA_HOST_DEVICE constexpr auto
+    operator*(const MA &a, const MB &b) {
+
+  using value_t = algebra::traits::value_t<MA>;
+  using a_getter_t = algebra::traits::element_getter_t<MA>;
+  using b_getter_t = algebra::traits::element_getter_t<MB>;
+
+  constexpr std::size_t R{algebra::traits::rows<MA>};
+  constexpr std::size_t K{algebra::traits::columns<MA>};
+
+  if constexpr (concepts::vector<MB>) {
+    using vector_t =
+        algebra::traits::get_vector_t<algebra::traits::matrix_t<MA>, R,
+                                      value_t>;
+    using c_getter_t = algebra::traits::element_getter_t<vector_t>;
+
+    vector_t c;
+    for (std::size_t i = 0u; i < R; ++i) {
+      value_t t{0};
+      for (std::size_t k = 0u; k < K; ++k) {
+        t += a_getter_t{}(a, i, k) * b_getter_t{}(b, k);
+      }
+      c_getter_t{}(c, i) = t;
+    }
+    return c;
+  } else {
+    constexpr std::size_t C{algebra::traits::columns<MB>};
+
+    using matrix_t =
+        algebra::traits::get_matrix_t<algebra::traits::matrix_t<MA>, R, C,
+                                      value_t>;
+    using c_getter_t = algebra::traits::element_getter_t<matrix_t>;
+
+    matrix_t c;
+    for (std::size_t j = 0u; j < C; ++j) {
+      for (std::size_t i = 0u; i < R; ++i) {
+        value_t t{0};
+        for (std::size_t k = 0u; k < K; ++k) {
+          t += a_getter_t{}(a, i, k) * b_getter_t{}(b, k, j);
+        }
+        c_getter_t{}(c, i, j) = t;
+      }
+    }
+    return c;
+  }
+}
+
+}  // namespace algebra::storage
+
+namespace algebra::traits {
+
+/// Type traits of the matrix views
+/// @{
+template <typename matrix_t, std::size_t RS, std::size_t CS>
+struct index<storage::matrix_view<matrix_t, RS, CS>> {
+  using type = typename storage::matrix_view<matrix_t, RS, CS>::size_type;
+};
+
+template <typename matrix_t, std::size_t RS, std::size_t CS>
+struct dimensions<storage::matrix_view<matrix_t, RS, CS>> {
+
+  using size_type = index_t<storage::matrix_view<matrix_t, RS, CS>>;
+
+  static constexpr size_type dim{2};
+  static constexpr size_type rows{
+      storage::matrix_view<matrix_t, RS, CS>::rows()};
+  static constexpr size_type columns{
+      storage::matrix_view<matrix_t, RS, CS>::columns()};
+};
+
+template <typename matrix_t, std::size_t RS, std::size_t CS>
+struct value<storage::matrix_view<matrix_t, RS, CS>> {
+  using type = typename storage::matrix_view<matrix_t, RS, CS>::value_type;
+};
+
+template <typename matrix_t, std::size_t RS, std::size_t CS>
+struct vector<storage::matrix_view<matrix_t, RS, CS>>
+    : public vector<std::remove_const_t<matrix_t>> {};
+
+template <typename matrix_t, std::size_t RS, std::size_t CS>
+struct matrix<storage::matrix_view<matrix_t, RS, CS>>
+    : public matrix<std::remove_const_t<matrix_t>> {};
+
+template <typename matrix_t, std::size_t RS, std::size_t CS>
+struct element_getter<storage::matrix_view<matrix_t, RS, CS>> {
+  using type = storage::view_element_getter;
+};
+
+template <typename matrix_t, std::size_t RS, std::size_t CS>
+struct block_getter<storage::matrix_view<matrix_t, RS, CS>> {
+  using type = storage::view_block_getter;
+};
+/// @}
+
+/// Type traits of the lazy transposes
+/// @{
+template <typename matrix_t>
+struct index<storage::transpose_view<matrix_t>>
+    : public index<std::remove_const_t<matrix_t>> {};
+
+template <typename matrix_t>
+struct dimensions<storage::transpose_view<matrix_t>> {
+
+  using size_type = index_t<storage::transpose_view<matrix_t>>;
+
+  static constexpr size_type dim{2};
+  static constexpr size_type rows{storage::transpose_view<matrix_t>::rows()};
+  static constexpr size_type columns{
+      storage::transpose_view<matrix_t>::columns()};
+};
+
+template <typename matrix_t>
+struct value<storage::transpose_view<matrix_t>>
+    : public value<std::remove_const_t<matrix_t>> {};
+
+template <typename matrix_t>
+struct vector<storage::transpose_view<matrix_t>>
+    : public vector<std::remove_const_t<matrix_t>> {};
+
+template <typename matrix_t>
+struct matrix<storage::transpose_view<matrix_t>>
+    : public matrix<std::remove_const_t<matrix_t>> {
+  using type = get_matrix_t<std::remove_const_t<matrix_t>,
+                            columns<std::remove_const_t<matrix_t>>,
+                            rows<std::remove_const_t<matrix_t>>,
+                            value_t<std::remove_const_t<matrix_t>>>;
+};
+
+template <typename matrix_t>
+struct element_getter<storage::transpose_view<matrix_t>> {
+  using type = storage::view_element_getter;
+};
+/// @}
+
+/// Type traits of the lazy blocks
+/// @{
+template <typename matrix_t, std::size_t ROWS, std::size_t COLS>
+struct index<storage::block_view<matrix_t, ROWS, COLS>>
+    : public index<std::remove_const_t<matrix_t>> {};
+
+template <typename matrix_t, std::size_t ROWS, std::size_t COLS>
+struct dimensions<storage::block_view<matrix_t, ROWS, COLS>> {
+
+  using size_type = index_t<storage::block_view<matrix_t, ROWS, COLS>>;
+
+  static constexpr size_type dim{2};
+  static constexpr size_type rows{ROWS};
+  static constexpr size_type columns{COLS};
+};
+
+template <typename matrix_t, std::size_t ROWS, std::size_t COLS>
+struct value<storage::block_view<matrix_t, ROWS, COLS>>
+    : public value<std::remove_const_t<matrix_t>> {};
+
+template <typename matrix_t, std::size_t ROWS, std::size_t COLS>
+struct vector<storage::block_view<matrix_t, ROWS, COLS>>
+    : public vector<std::remove_const_t<matrix_t>> {};
+
+template <typename matrix_t, std::size_t ROWS, std::size_t COLS>
+struct matrix<storage::block_view<matrix_t, ROWS, COLS>>
+    : public matrix<std::remove_const_t<matrix_t>> {
+  using type = get_matrix_t<std::remove_const_t<matrix_t>, ROWS, COLS,
+                            value_t<std::remove_const_t<matrix_t>>>;
+};
+
+template <typename matrix_t, std::size_t ROWS, std::size_t COLS>
+struct element_getter<storage::block_view<matrix_t, ROWS, COLS>> {
+  using type = storage::view_element_getter;
+};
+
+template <typename matrix_t, std::size_t ROWS, std::size_t COLS>
+struct block_getter<storage::block_view<matrix_t, ROWS, COLS>> {
+  using type = storage::view_block_getter;
+};
+/// @}
+
+/// Type traits of the vector views
+/// @{
+template <typename vector_t, std::size_t S>
+struct index<storage::vector_view<vector_t, S>> {
+  using type = typename storage::vector_view<vector_t, S>::size_type;
+};
+
+template <typename vector_t, std::size_t S>
+struct dimensions<storage::vector_view<vector_t, S>> {
+
+  using size_type = index_t<storage::vector_view<vector_t, S>>;
+
+  static constexpr size_type dim{1};
+  static constexpr size_type rows{storage::vector_view<vector_t, S>::size()};
+  static constexpr size_type columns{1};
+};
+
+template <typename vector_t, std::size_t S>
+struct value<storage::vector_view<vector_t, S>> {
+  using type = typename storage::vector_view<vector_t, S>::value_type;
+};
+
+template <typename vector_t, std::size_t S>
+struct vector<storage::vector_view<vector_t, S>>
+    : public vector<std::remove_const_t<vector_t>> {};
+
+template <typename vector_t, std::size_t S>
+struct matrix<storage::vector_view<vector_t, S>>
+    : public matrix<std::remove_const_t<vector_t>> {};
+
+template <typename vector_t, std::size_t S>
+struct element_getter<storage::vector_view<vector_t, S>> {
+  using type = storage::view_element_getter;
+};
+/// @}
+
+}  // namespace algebra::traits
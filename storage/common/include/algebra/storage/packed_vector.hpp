@@ -0,0 +1,107 @@
+/** Algebra plugins library, part of the ACTS project
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "algebra/concepts.hpp"
+#include "algebra/qualifiers.hpp"
+#include "algebra/storage/vector.hpp"
+
+// System include(s).
+#include <array>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+
+namespace algebra::storage {
+
+/// Unpadded storage form of @c storage::vector
+///
+/// Holds exactly @tparam N elements, where @c storage::vector pads its data
+/// array to the next power of two for the use in registers. This is meant for
+/// large collections of vectors (e.g. track parameters), which are converted
+/// to the padded @c storage::vector (and back) for computations.
+template <std::size_t N, concepts::scalar scalar_t,
+          template <typename, std::size_t> class array_t>
+class packed_vector {
+
+ public:
+  // Value type is a simd vector in SoA and a scalar in AoS
+  using scalar_type = scalar_t;
+  /// Padded vector type that is used for the computations
+  using vector_type = storage::vector<N, scalar_t, array_t>;
+
+  /// Default constructor sets all entries to zero.
+  constexpr packed_vector() = default;
+
+  /// Construct from a padded vector @param v
+  /// @{
+  ALGEBRA_HOST_DEVICE
+  constexpr packed_vector(const vector_type &v) { store(v); }
+
+  ALGEBRA_HOST_DEVICE
+  constexpr packed_vector(const typename vector_type::array_type &v) {
+    store(v);
+  }
+  /// @}
+
+  /// @returns the number of (stored) elements
+  ALGEBRA_HOST_DEVICE
+  static consteval std::size_t size() { return N; }
+
+  /// Subscript operator[]
+  /// @{
+  ALGEBRA_HOST_DEVICE
+  constexpr decltype(auto) operator[](std::size_t i) {
+    assert(i < N);
+    return m_data[i];
+  }
+  ALGEBRA_HOST_DEVICE
+  constexpr decltype(auto) operator[](std::size_t i) const {
+    assert(i < N);
+    return m_data[i];
+  }
+  /// @}
+
+  /// @returns the padded vector, with the trailing entries set to zero
+  ALGEBRA_HOST_DEVICE
+  constexpr vector_type load() const {
+
+    // Zero initialized in AoS, no padding in SoA
+    vector_type v;
+
+    ALGEBRA_UNROLL_N(N)
+    for (std::size_t i = 0u; i < N; ++i) {
+      v[i] = m_data[i];
+    }
+
+    return v;
+  }
+
+  /// Conversion operator to the padded vector type
+  ALGEBRA_HOST_DEVICE
+  constexpr operator vector_type() const { return load(); }
+
+  /// Write the first @tparam N elements of the padded vector @param v
+  template <typename other_t>
+  requires(std::same_as<other_t, vector_type> ||
+           std::same_as<other_t, typename vector_type::array_type>)
+      ALGEBRA_HOST_DEVICE constexpr void store(const other_t &v) {
+
+    ALGEBRA_UNROLL_N(N)
+    for (std::size_t i = 0u; i < N; ++i) {
+      m_data[i] = v[i];
+    }
+  }
+
+ private:
+  /// Holds exactly N data values
+  std::array<scalar_t, N> m_data{};
+};
+
+}  // namespace algebra::storage
@@ -0,0 +1,391 @@
+/** Algebra plugins library, part of the ACTS project
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "algebra/concepts.hpp"
+#include "algebra/qualifiers.hpp"
+#include "algebra/storage/matrix.hpp"
+#include "algebra/type_traits.hpp"
+
+// System include(s).
+#include <array>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+
+namespace algebra::storage {
+
+/// Projection matrix
+///
+/// M x N matrix with a single one per row, which selects M of the N elements
+/// of a vector (e.g. the measured track parameters). Only the column indices
+/// of the ones are stored, either at compile time (@c constexpr projection)
+/// or at run time. Products with dense matrices and vectors gather their
+/// rows or columns (or, for the transpose, scatter them) instead of
+/// multiplying.
+///
+/// @tparam matrix_t the dense M x N matrix type, which provides the value
+///                  type and the type of the matrices that are created
+/// @tparam TRANSPOSED the N x M transpose of the projection
+template <concepts::matrix matrix_t, bool TRANSPOSED = false>
+class projection_matrix {
+
+ public:
+  using value_type = algebra::traits::value_t<matrix_t>;
+  // Value type is a simd vector in SoA and a scalar in AoS
+  using scalar_type = algebra::traits::scalar_t<matrix_t>;
+  using size_type = algebra::traits::index_t<matrix_t>;
+  /// Column indices of the ones in the rows of the projection
+  using index_array = std::array<size_type, algebra::traits::rows<matrix_t>>;
+  /// Dense matrix type
+  using matrix_type = std::conditional_t<
+      TRANSPOSED,
+      algebra::traits::get_matrix_t<
+          matrix_t, algebra::traits::columns<matrix_t>,
+          algebra::traits::rows<matrix_t>, value_type>,
+      matrix_t>;
+
+  /// Default constructor selects the first M elements
+  ALGEBRA_HOST_DEVICE
+  constexpr projection_matrix() {
+    for (std::size_t i = 0u; i < m_indices.size(); ++i) {
+      m_indices[i] = static_cast<size_type>(i);
+    }
+  }
+
+  /// Construct from the column indices @param idx of the ones
+  ALGEBRA_HOST_DEVICE
+  constexpr explicit projection_matrix(const index_array &idx)
+      : m_indices{idx} {
+    for ([[maybe_unused]] const size_type i : m_indices) {
+      assert(static_cast<std::size_t>(i) < algebra::traits::columns<matrix_t>);
+    }
+  }
+
+  /// Construct from the column indices @param idx of the ones
+  template <std::convertible_to<size_type>... index_t>
+  requires(sizeof...(index_t) == algebra::traits::rows<matrix_t>)
+      ALGEBRA_HOST_DEVICE constexpr explicit projection_matrix(
+          const index_t... idx)
+      : projection_matrix{index_array{static_cast<size_type>(idx)...}} {}
+
+  /// @returns the element in row @param row and column @param col
+  ALGEBRA_HOST_DEVICE
+  constexpr scalar_type operator()(const std::size_t row,
+                                   const std::size_t col) const {
+    assert(row < rows());
+    assert(col < columns());
+    if constexpr (TRANSPOSED) {
+      return index(col) == row ? scalar_type(1) : scalar_type(0);
+    } else {
+      return index(row) == col ? scalar_type(1) : scalar_type(0);
+    }
+  }
+
+  /// @returns the index of the element that is selected by row @param i of
+  /// the (untransposed) projection
+  ALGEBRA_HOST_DEVICE
+  constexpr std::size_t index(const std::size_t i) const {
+    assert(i < m_indices.size());
+    return static_cast<std::size_t>(m_indices[i]);
+  }
+
+  /// @returns the indices of the selected elements
+  ALGEBRA_HOST_DEVICE
+  constexpr const index_array &indices() const { return m_indices; }
+
+  /// @returns the number of rows
+  ALGEBRA_HOST_DEVICE
+  static consteval std::size_t rows() {
+    return TRANSPOSED ? algebra::traits::columns<matrix_t>
+                      : algebra::traits::rows<matrix_t>;
+  }
+
+  /// @returns the number of columns
+  ALGEBRA_HOST_DEVICE
+  static consteval std::size_t columns() {
+    return TRANSPOSED ? algebra::traits::rows<matrix_t>
+                      : algebra::traits::columns<matrix_t>;
+  }
+
+  /// Conversion to the dense matrix type
+  ALGEBRA_HOST_DEVICE
+  constexpr operator matrix_type() const {
+
+    using element_getter_t = algebra::traits::element_getter_t<matrix_type>;
+
+    matrix_type m;
+    for (std::size_t j = 0u; j < columns(); ++j) {
+      for (std::size_t i = 0u; i < rows(); ++i) {
+        element_getter_t{}(m, i, j) = (*this)(i, j);
+      }
+    }
+    return m;
+  }
+
+ private:
+  /// The indices of the selected elements
+  index_array m_indices;
+
+};  // class projection_matrix
+
+/// Check whether a type is a projection matrix
+/// @{
+template <typename T>
+inline constexpr bool is_projection{false};
+
+template <typename matrix_t, bool TRANSPOSED>
+inline constexpr bool is_projection<projection_matrix<matrix_t, TRANSPOSED>>{
+    true};
+/// @}
+
+/// Functor used to read the elements of a projection matrix
+struct projection_element_getter {
+
+  /// @returns the element in row @param row and column @param col of the
+  /// projection matrix @param m (the elements cannot be written)
+  template <typename matrix_t, bool TRANSPOSED>
+  ALGEBRA_HOST_DEVICE constexpr auto operator()(
+      const projection_matrix<matrix_t, TRANSPOSED> &m, std::size_t row,
+      std::size_t col) const {
+    return m(row, col);
+  }
+
+};  // struct projection_element_getter
+
+/// Function extracting an element from a projection matrix
+template <typename matrix_t, bool TRANSPOSED>
+ALGEBRA_HOST_DEVICE constexpr auto element(
+    const projection_matrix<matrix_t, TRANSPOSED> &m, std::size_t row,
+    std::size_t col) {
+  return projection_element_getter{}(m, row, col);
+}
+
+namespace detail {
+
+/// Set @param c to the product of the projection @param h with the matrix
+/// or vector @param b: Gather the selected rows of @param b, or scatter its
+/// rows to the selected rows of @param c for the transpose
+template <typename MC, typename matrix_t, bool TRANSPOSED, typename MB>
+ALGEBRA_HOST_DEVICE constexpr void set_projected_rows(
+    MC &c, const projection_matrix<matrix_t, TRANSPOSED> &h, const MB &b) {
+
+  using scalar_t = algebra::traits::scalar_t<matrix_t>;
+  using b_getter_t = algebra::traits::element_getter_t<MB>;
+  using c_getter_t = algebra::traits::element_getter_t<MC>;
+
+  constexpr std::size_t R{algebra::traits::rows<matrix_t>};
+
+  if constexpr (concepts::vector<MB>) {
+    if constexpr (TRANSPOSED) {
+      for (std::size_t i = 0u; i < h.rows(); ++i) {
+        c_getter_t{}(c, i) = scalar_t(0);
+      }
+      for (std::size_t k = 0u; k < R; ++k) {
+        c_getter_t{}(c, h.index(k)) += b_getter_t{}(b, k);
+      }
+    } else {
+      for (std::size_t i = 0u; i < R; ++i) {
+        c_getter_t{}(c, i) = b_getter_t{}(b, h.index(i));
+      }
+    }
+  } else {
+    constexpr std::size_t C{algebra::traits::columns<MB>};
+
+    for (std::size_t j = 0u; j < C; ++j) {
+      if constexpr (TRANSPOSED) {
+        for (std::size_t i = 0u; i < h.rows(); ++i) {
+          c_getter_t{}(c, i, j) = scalar_t(0);
+        }
+        for (std::size_t k = 0u; k < R; ++k) {
+          c_getter_t{}(c, h.index(k), j) += b_getter_t{}(b, k, j);
+        }
+      } else {
+        for (std::size_t i = 0u; i < R; ++i) {
+          c_getter_t{}(c, i, j) = b_getter_t{}(b, h.index(i), j);
+        }
+      }
+    }
+  }
+}
+
+/// Set @param c to the product of the matrix @param a with the projection
+/// @param h: Gather the selected columns of @param a for the transpose, or
+/// scatter its columns to the selected columns of @param c
+template <typename MC, typename MA, typename matrix_t, bool TRANSPOSED>
+ALGEBRA_HOST_DEVICE constexpr void set_projected_columns(
+    MC &c, const MA &a, const projection_matrix<matrix_t, TRANSPOSED> &h) {
+
+  using scalar_t = algebra::traits::scalar_t<matrix_t>;
+  using a_getter_t = algebra::traits::element_getter_t<MA>;
+  using c_getter_t = algebra::traits::element_getter_t<MC>;
+
+  constexpr std::size_t R{algebra::traits::rows<MA>};
+  constexpr std::size_t M{algebra::traits::rows<matrix_t>};
+
+  if constexpr (TRANSPOSED) {
+    for (std::size_t j = 0u; j < M; ++j) {
+      for (std::size_t i = 0u; i < R; ++i) {
+        c_getter_t{}(c, i, j) = a_getter_t{}(a, i, h.index(j));
+      }
+    }
+  } else {
+    for (std::size_t j = 0u; j < h.columns(); ++j) {
+      for (std::size_t i = 0u; i < R; ++i) {
+        c_getter_t{}(c, i, j) = scalar_t(0);
+      }
+    }
+    for (std::size_t k = 0u; k < M; ++k) {
+      for (std::size_t i = 0u; i < R; ++i) {
+        c_getter_t{}(c, i, h.index(k)) += a_getter_t{}(a, i, k);
+      }
+    }
+  }
+}
+
+/// @returns the product of the projection @param h with the matrix or
+/// vector @param b
+template <typename matrix_t, bool TRANSPOSED, typename MB>
+ALGEBRA_HOST_DEVICE constexpr auto project_rows(
+    const projection_matrix<matrix_t, TRANSPOSED> &h, const MB &b) {
+
+  using value_t = algebra::traits::value_t<matrix_t>;
+
+  constexpr std::size_t N{projection_matrix<matrix_t, TRANSPOSED>::rows()};
+
+  if constexpr (concepts::vector<MB>) {
+    using vector_t = algebra::traits::get_vector_t<matrix_t, N, value_t>;
+
+    vector_t c;
+    set_projected_rows(c, h, b);
+    return c;
+  } else {
+    constexpr std::size_t C{algebra::traits::columns<MB>};
+
+    using c_matrix_t = algebra::traits::get_matrix_t<matrix_t, N, C, value_t>;
+
+    c_matrix_t c;
+    set_projected_rows(c, h, b);
+    return c;
+  }
+}
+
+/// @returns the product of the matrix @param a with the projection @param h
+template <typename MA, typename matrix_t, bool TRANSPOSED>
+ALGEBRA_HOST_DEVICE constexpr auto project_columns(
+    const MA &a, const projection_matrix<matrix_t, TRANSPOSED> &h) {
+
+  using value_t = algebra::traits::value_t<matrix_t>;
+
+  constexpr std::size_t R{algebra::traits::rows<MA>};
+  constexpr std::size_t N{projection_matrix<matrix_t, TRANSPOSED>::columns()};
+
+  using c_matrix_t = algebra::traits::get_matrix_t<matrix_t, R, N, value_t>;
+
+  c_matrix_t c;
+  set_projected_columns(c, a, h);
+  return c;
+}
+
+}  // namespace detail
+
+/// Products of a projection matrix with dense matrices and vectors, which
+/// only gather or scatter the rows or columns of the dense operand (e.g.
+/// @c H*C*H^T only selects elements of @c C)
+/// @{
+template <typename matrix_t, bool TRANSPOSED, typename MB>
+requires(!is_projection<MB> && (concepts::matrix<MB> || concepts::vector<MB>) &&
+         algebra::traits::rows<MB> ==
+             projection_matrix<matrix_t, TRANSPOSED>::columns())
+    ALGEBRA_HOST_DEVICE constexpr auto
+    operator*(const projection_matrix<matrix_t, TRANSPOSED> &h, const MB &b) {
+  return detail::project_rows(h, b);
+}
+
+// Takes precedence over the scalar multiplication of storage::matrix
+template <typename matrix_t, bool TRANSPOSED,
+          template <typename, std::size_t> class array_t,
+          concepts::scalar scalar_t, std::size_t ROW, std::size_t COL>
+requires(ROW == projection_matrix<matrix_t, TRANSPOSED>::columns())
+    ALGEBRA_HOST_DEVICE constexpr auto
+    operator*(const projection_matrix<matrix_t, TRANSPOSED> &h,
+              const matrix<array_t, scalar_t, ROW, COL> &b) {
+  return detail::project_rows(h, b);
+}
+
+template <concepts::matrix MA, typename matrix_t, bool TRANSPOSED>
+requires(!is_projection<MA> &&
+         algebra::traits::columns<MA> ==
+             projection_matrix<matrix_t, TRANSPOSED>::rows())
+    ALGEBRA_HOST_DEVICE constexpr auto
+    operator*(const MA &a, const projection_matrix<matrix_t, TRANSPOSED> &h) {
+  return detail::project_columns(a, h);
+}
+/// @}
+
+/// @returns the transpose of the projection matrix @param h
+template <typename matrix_t, bool TRANSPOSED>
+ALGEBRA_HOST_DEVICE constexpr projection_matrix<matrix_t, !TRANSPOSED>
+transpose(const projection_matrix<matrix_t, TRANSPOSED> &h) {
+  return projection_matrix<matrix_t, !TRANSPOSED>{h.indices()};
+}
+
+}  // namespace algebra::storage
+
+namespace algebra::traits {
+
+/// Type traits of the projection matrices
+/// @{
+template <typename matrix_t, bool TRANSPOSED>
+struct index<storage::projection_matrix<matrix_t, TRANSPOSED>>
+    : public index<matrix_t> {};
+
+template <typename matrix_t, bool TRANSPOSED>
+struct dimensions<storage::projection_matrix<matrix_t, TRANSPOSED>> {
+
+  using size_type = index_t<storage::projection_matrix<matrix_t, TRANSPOSED>>;
+
+  static constexpr size_type dim{2};
+  static constexpr size_type rows{
+      storage::projection_matrix<matrix_t, TRANSPOSED>::rows()};
+  static constexpr size_type columns{
+      storage::projection_matrix<matrix_t, TRANSPOSED>::columns()};
+};
+
+template <typename matrix_t, bool TRANSPOSED>
+struct value<storage::projection_matrix<matrix_t, TRANSPOSED>>
+    : public value<matrix_t> {};
+
+template <typename matrix_t, bool TRANSPOSED>
+struct scalar<storage::projection_matrix<matrix_t, TRANSPOSED>>
+    : public scalar<matrix_t> {};
+
+template <typename matrix_t, bool TRANSPOSED>
+struct vector<storage::projection_matrix<matrix_t, TRANSPOSED>>
+    : public vector<matrix_t> {};
+
+template <typename matrix_t, bool TRANSPOSED>
+struct matrix<storage::projection_matrix<matrix_t, TRANSPOSED>> {
+  template <typename other_T, auto other_ROWS, auto other_COLS>
+  using other_type =
+      typename matrix<matrix_t>::template other_type<other_T, other_ROWS,
+                                                     other_COLS>;
+
+  using type =
+      typename storage::projection_matrix<matrix_t, TRANSPOSED>::matrix_type;
+};
+
+template <typename matrix_t, bool TRANSPOSED>
+struct element_getter<storage::projection_matrix<matrix_t, TRANSPOSED>> {
+  using type = storage::projection_element_getter;
+};
+/// @}
+
+}  // namespace algebra::traits
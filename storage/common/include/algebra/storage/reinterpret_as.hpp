@@ -0,0 +1,142 @@
+/** Algebra plugins library, part of the ACTS project
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "algebra/concepts.hpp"
+#include "algebra/qualifiers.hpp"
+#include "algebra/storage/matrix_view.hpp"
+#include "algebra/type_traits.hpp"
+
+// System include(s).
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+
+namespace algebra {
+
+namespace storage {
+
+/// Creates a non-owning view of type @tparam M on a buffer that holds the
+/// elements of @tparam M densely packed in column major order
+///
+/// Plugins specialize this for types that come with their own view types
+/// (e.g. @c Eigen::Map), so that the view works with the native operations.
+template <typename M>
+struct mapped {
+
+  template <typename value_t>
+  ALGEBRA_HOST_DEVICE constexpr auto operator()(value_t *data) const {
+
+    using view_t = std::conditional_t<std::is_const_v<value_t>, const M, M>;
+
+    if constexpr (concepts::vector<M>) {
+      return vector_view<view_t>{data};
+    } else {
+      return matrix_view<view_t>{data};
+    }
+  }
+};
+
+}  // namespace storage
+
+namespace traits {
+
+/// Check whether the objects of the two (unqualified) types @tparam M1 and
+/// @tparam M2 hold the same elements at the same positions in memory
+///
+/// The views created by @c reinterpret_as access the elements through
+/// pointers to the value type, so the alignment of the objects themselves
+/// does not have to agree.
+template <typename M1, typename M2>
+inline constexpr bool is_layout_compatible{
+    std::same_as<value_t<M1>, value_t<M2>> && rows<M1> == rows<M2> &&
+    columns<M1> == columns<M2> && is_column_major<M1> &&
+    is_column_major<M2> && sizeof(M1) == size<M1> * sizeof(value_t<M1>) &&
+    sizeof(M2) == sizeof(M1)};
+
+}  // namespace traits
+
+namespace detail {
+
+/// The type that corresponds to @tparam M in the algebra plugin @tparam A
+template <typename A, typename M>
+struct plugin_type {
+  using type =
+      typename A::template matrix<algebra::traits::rows<M>,
+                                  algebra::traits::columns<M>>;
+};
+
+template <typename A, concepts::vector V>
+struct plugin_type<A, V> {
+  using type = algebra::traits::get_vector_t<
+      typename A::template matrix<algebra::traits::size<V>, 1>,
+      algebra::traits::size<V>, typename A::value_type>;
+};
+
+}  // namespace detail
+
+/// Access the matrix or vector @param obj as a type of the plugin @tparam A
+///
+/// If the type of @param obj is the type of the plugin, @param obj is
+/// returned by reference. If the two types have the same memory layout (as
+/// determined by @c traits::is_layout_compatible at compile time), a view of
+/// the plugin type on the elements of @param obj is returned (see
+/// @c storage::mapped), i.e. writing to the view modifies @param obj.
+/// Otherwise, the elements are copied into a new object of the plugin type.
+template <typename A, typename T>
+requires(concepts::matrix<T> || concepts::vector<T>) ALGEBRA_HOST_DEVICE
+    constexpr decltype(auto) reinterpret_as(T &obj) {
+
+  using source_t = std::remove_const_t<T>;
+  using target_t = typename detail::plugin_type<A, source_t>::type;
+  using value_type = algebra::traits::value_t<source_t>;
+
+  using source_getter_t = algebra::traits::element_getter_t<source_t>;
+
+  if constexpr (std::same_as<source_t, target_t>) {
+    return (obj);
+  } else if constexpr (algebra::traits::is_layout_compatible<source_t,
+                                                              target_t>) {
+    // The element getters only give a reference for non-const objects
+    auto &m = const_cast<source_t &>(obj);
+
+    value_type *data{nullptr};
+    if constexpr (concepts::vector<source_t>) {
+      data = &source_getter_t{}(m, 0);
+    } else {
+      data = &source_getter_t{}(m, 0, 0);
+    }
+
+    using data_t = std::conditional_t<std::is_const_v<T>, const value_type *,
+                                      value_type *>;
+
+    return storage::mapped<target_t>{}(static_cast<data_t>(data));
+  } else {
+    using target_getter_t = algebra::traits::element_getter_t<target_t>;
+    using target_value_t = algebra::traits::value_t<target_t>;
+
+    target_t ret;
+    if constexpr (concepts::vector<source_t>) {
+      for (std::size_t i = 0u; i < algebra::traits::size<source_t>; ++i) {
+        target_getter_t{}(ret, i) =
+            static_cast<target_value_t>(source_getter_t{}(obj, i));
+      }
+    } else {
+      for (std::size_t j = 0u; j < algebra::traits::columns<source_t>; ++j) {
+        for (std::size_t i = 0u; i < algebra::traits::rows<source_t>; ++i) {
+          target_getter_t{}(ret, i, j) =
+              static_cast<target_value_t>(source_getter_t{}(obj, i, j));
+        }
+      }
+    }
+    return ret;
+  }
+}
+
+}  // namespace algebra
@@ -0,0 +1,334 @@
+/** Algebra plugins library, part of the ACTS project
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "algebra/concepts.hpp"
+#include "algebra/qualifiers.hpp"
+#include "algebra/storage/matrix.hpp"
+#include "algebra/storage/vector.hpp"
+#include "algebra/type_traits.hpp"
+
+// System include(s).
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace algebra::storage {
+
+/// Generic matrix type that keeps its rows in vectors
+///
+/// Sibling of @c storage::matrix for kernels that work on rows, e.g. the
+/// product with a row-selection matrix or @c v^T*M, which would otherwise
+/// access single elements across all of the column vectors.
+template <template <typename, std::size_t> class array_t,
+          concepts::scalar scalar_t, std::size_t ROW, std::size_t COL>
+struct ALGEBRA_ALIGN(alignof(storage::vector<COL, scalar_t, array_t>))
+    row_major_matrix {
+
+  // The matrix consists of row vectors
+  using vector_type = storage::vector<COL, scalar_t, array_t>;
+  // Value type: Can be simd types
+  using scalar_type = scalar_t;
+
+  /// Default constructor
+  constexpr row_major_matrix() = default;
+
+  /// Construct from given row vectors @param v
+  template <concepts::vector... vector_t>
+  ALGEBRA_HOST_DEVICE requires(sizeof...(vector_t) ==
+                               ROW) explicit row_major_matrix(vector_t &&... v)
+      : m_storage{std::forward<vector_t>(v)...} {}
+
+  /// Subscript operator: Access to the rows
+  /// @{
+  ALGEBRA_HOST_DEVICE
+  constexpr const vector_type &operator[](const std::size_t i) const {
+    assert(i < ROW);
+    return m_storage[i];
+  }
+  ALGEBRA_HOST_DEVICE
+  constexpr vector_type &operator[](const std::size_t i) {
+    assert(i < ROW);
+    return m_storage[i];
+  }
+  /// @}
+
+  /// @returns the number of rows
+  ALGEBRA_HOST_DEVICE
+  static consteval std::size_t rows() { return ROW; }
+
+  /// @returns the number of columns
+  ALGEBRA_HOST_DEVICE
+  static consteval std::size_t columns() { return COL; }
+
+  /// @returns the number of columns of the underlying vector storage
+  /// @note can be different from the matrix columns due to padding
+  ALGEBRA_HOST_DEVICE
+  static consteval std::size_t storage_columns() {
+    return vector_type::simd_size();
+  }
+
+  /// @returns the number of vectors the matrix is stored in
+  ALGEBRA_HOST_DEVICE
+  static consteval std::size_t storage_vectors() { return ROW; }
+
+ private:
+  /// Equality operator between two matrices
+  template <std::size_t R, std::size_t C, typename S,
+            template <typename, std::size_t> class A>
+  ALGEBRA_HOST_DEVICE friend constexpr bool operator==(
+      const row_major_matrix<A, S, R, C> &lhs,
+      const row_major_matrix<A, S, R, C> &rhs);
+
+  /// Compare the rows of two matrices
+  /// @{
+  // AoS
+  template <std::size_t... I>
+  ALGEBRA_HOST_DEVICE requires(!std::is_scalar_v<scalar_t>) constexpr bool
+  equal(const row_major_matrix &rhs, std::index_sequence<I...>) const {
+    return (... && (m_storage[I] == rhs[I]));
+  }
+
+  // SoA
+  template <std::size_t... I>
+  ALGEBRA_HOST requires(std::is_scalar_v<scalar_t>) constexpr bool equal(
+      const row_major_matrix &rhs, std::index_sequence<I...>) const {
+    return (... && ((m_storage[I].get() == rhs[I].get()).isFull()));
+  }
+  /// @}
+
+  /// Matrix storage
+  std::array<vector_type, ROW> m_storage;
+
+};  // struct row_major_matrix
+
+/// Transpose the matrix @param m
+template <std::size_t ROW, std::size_t COL, concepts::scalar scalar_t,
+          template <typename, std::size_t> class array_t, std::size_t... I>
+ALGEBRA_HOST_DEVICE constexpr auto transpose(
+    const row_major_matrix<array_t, scalar_t, ROW, COL> &m,
+    std::index_sequence<I...>) noexcept {
+
+  using matrix_T_t = row_major_matrix<array_t, scalar_t, COL, ROW>;
+  using row_t = typename matrix_T_t::vector_type;
+
+  matrix_T_t res_m;
+
+  ALGEBRA_UNROLL_N(COL)
+  for (std::size_t j = 0u; j < COL; ++j) {
+    res_m[j] = row_t{m[I][j]...};
+  }
+
+  return res_m;
+}
+
+/// Transpose the matrix @param m
+template <std::size_t ROW, std::size_t COL, concepts::scalar scalar_t,
+          template <typename, std::size_t> class array_t>
+ALGEBRA_HOST_DEVICE constexpr auto transpose(
+    const row_major_matrix<array_t, scalar_t, ROW, COL> &m) noexcept {
+  return transpose(m, std::make_index_sequence<ROW>());
+}
+
+/// Equality operator between two matrices
+template <std::size_t ROW, std::size_t COL, typename scalar_t,
+          template <typename, std::size_t> class array_t>
+ALGEBRA_HOST_DEVICE constexpr bool operator==(
+    const row_major_matrix<array_t, scalar_t, ROW, COL> &lhs,
+    const row_major_matrix<array_t, scalar_t, ROW, COL> &rhs) {
+  return lhs.equal(rhs, std::make_index_sequence<ROW>());
+}
+
+/// Arithmetic operators
+/// @{
+template <std::size_t ROW, std::size_t COL, concepts::scalar scalar_t,
+          template <typename, std::size_t> class array_t>
+ALGEBRA_HOST_DEVICE constexpr decltype(auto) operator+(
+    const row_major_matrix<array_t, scalar_t, ROW, COL> &lhs,
+    const row_major_matrix<array_t, scalar_t, ROW, COL> &rhs) noexcept {
+
+  return matrix_add(lhs, rhs, std::make_index_sequence<ROW>());
+}
+
+template <std::size_t ROW, std::size_t COL, concepts::scalar scalar_t,
+          template <typename, std::size_t> class array_t>
+ALGEBRA_HOST_DEVICE constexpr decltype(auto) operator-(
+    const row_major_matrix<array_t, scalar_t, ROW, COL> &lhs,
+    const row_major_matrix<array_t, scalar_t, ROW, COL> &rhs) noexcept {
+
+  return matrix_sub(lhs, rhs, std::make_index_sequence<ROW>());
+}
+
+template <std::size_t R, std::size_t C, concepts::scalar S1,
+          concepts::scalar S2, template <typename, std::size_t> class A>
+ALGEBRA_HOST_DEVICE constexpr decltype(auto) operator*(
+    const S2 a, const row_major_matrix<A, S1, R, C> &rhs) noexcept {
+
+  return matrix_scalar_mul(static_cast<S1>(a), rhs,
+                           std::make_index_sequence<R>());
+}
+
+template <std::size_t R, std::size_t C, concepts::scalar S1,
+          concepts::scalar S2, template <typename, std::size_t> class A>
+ALGEBRA_HOST_DEVICE constexpr decltype(auto) operator*(
+    const row_major_matrix<A, S1, R, C> &lhs, const S2 a) noexcept {
+  return static_cast<S1>(a) * lhs;
+}
+
+/// Matrix-vector multiplication
+template <std::size_t ROW, std::size_t COL, concepts::scalar scalar_t,
+          template <typename, std::size_t> class array_t>
+ALGEBRA_HOST_DEVICE constexpr decltype(auto) operator*(
+    const row_major_matrix<array_t, scalar_t, ROW, COL> &lhs,
+    const vector<COL, scalar_t, array_t> &v) noexcept {
+
+  vector<ROW, scalar_t, array_t> res_v;
+
+  ALGEBRA_UNROLL_N(ROW)
+  for (std::size_t i = 0u; i < ROW; ++i) {
+    // Multiply the row, then sum up the (unpadded) elements
+    const auto prod = lhs[i] * v;
+
+    scalar_t res{prod[0]};
+    ALGEBRA_UNROLL_N(COL)
+    for (std::size_t j = 1u; j < COL; ++j) {
+      res = res + prod[j];
+    }
+    res_v[i] = res;
+  }
+
+  return res_v;
+}
+
+/// Vector-matrix multiplication: @c v^T*M, returned as a (column) vector
+template <std::size_t ROW, std::size_t COL, concepts::scalar scalar_t,
+          template <typename, std::size_t> class array_t>
+ALGEBRA_HOST_DEVICE constexpr decltype(auto) operator*(
+    const vector<ROW, scalar_t, array_t> &v,
+    const row_major_matrix<array_t, scalar_t, ROW, COL> &rhs) noexcept {
+
+  // Init vector
+  vector<COL, scalar_t, array_t> res_v{v[0] * rhs[0]};
+
+  // Add the rest per row
+  ALGEBRA_UNROLL_N(ROW)
+  for (std::size_t i = 1u; i < ROW; ++i) {
+    // fma
+    res_v = res_v + v[i] * rhs[i];
+  }
+
+  return res_v;
+}
+
+/// Matrix-matrix multiplication
+template <std::size_t LROW, std::size_t COL, std::size_t RCOL,
+          concepts::scalar scalar_t,
+          template <typename, std::size_t> class array_t>
+ALGEBRA_HOST_DEVICE constexpr decltype(auto) operator*(
+    const row_major_matrix<array_t, scalar_t, LROW, COL> &lhs,
+    const row_major_matrix<array_t, scalar_t, COL, RCOL> &rhs) noexcept {
+
+  row_major_matrix<array_t, scalar_t, LROW, RCOL> res_m;
+
+  ALGEBRA_UNROLL_N(LROW)
+  for (std::size_t i = 0u; i < LROW; ++i) {
+    // Init row i
+    res_m[i] = lhs[i][0] * rhs[0];
+
+    // Add the rest per row
+    ALGEBRA_UNROLL_N(COL)
+    for (std::size_t k = 1u; k < COL; ++k) {
+      // fma
+      res_m[i] = res_m[i] + lhs[i][k] * rhs[k];
+    }
+  }
+
+  return res_m;
+}
+/// @}
+
+/// Functors used to access elements and blocks (@see matrix_getter.hpp)
+/// @{
+struct element_getter;
+struct block_getter;
+/// @}
+
+}  // namespace algebra::storage
+
+namespace algebra::traits {
+
+/// Type traits of the row major matrices
+/// @{
+template <template <typename, std::size_t> class array_t,
+          concepts::scalar scalar_t, std::size_t ROW, std::size_t COL>
+struct index<storage::row_major_matrix<array_t, scalar_t, ROW, COL>> {
+  using type = std::size_t;
+};
+
+template <template <typename, std::size_t> class array_t,
+          concepts::scalar scalar_t, std::size_t ROW, std::size_t COL>
+struct dimensions<storage::row_major_matrix<array_t, scalar_t, ROW, COL>> {
+
+  using size_type = std::size_t;
+
+  static constexpr size_type dim{2};
+  static constexpr size_type rows{ROW};
+  static constexpr size_type columns{COL};
+};
+
+template <template <typename, std::size_t> class array_t,
+          concepts::scalar scalar_t, std::size_t ROW, std::size_t COL>
+struct value<storage::row_major_matrix<array_t, scalar_t, ROW, COL>> {
+  using type = value_t<scalar_t>;
+};
+
+template <template <typename, std::size_t> class array_t,
+          concepts::scalar scalar_t, std::size_t ROW, std::size_t COL>
+struct scalar<storage::row_major_matrix<array_t, scalar_t, ROW, COL>> {
+  using type = scalar_t;
+};
+
+template <template <typename, std::size_t> class array_t,
+          concepts::scalar scalar_t, std::size_t ROW, std::size_t COL>
+struct vector<storage::row_major_matrix<array_t, scalar_t, ROW, COL>> {
+
+  template <typename other_T, auto other_N>
+  using other_type = storage::vector<other_N, other_T, array_t>;
+
+  using type = other_type<scalar_t, ROW>;
+};
+
+template <template <typename, std::size_t> class array_t,
+          concepts::scalar scalar_t, std::size_t ROW, std::size_t COL>
+struct matrix<storage::row_major_matrix<array_t, scalar_t, ROW, COL>> {
+
+  template <typename other_T, auto other_ROWS, auto other_COLS>
+  using other_type =
+      storage::row_major_matrix<array_t, other_T, other_ROWS, other_COLS>;
+
+  using type = other_type<scalar_t, ROW, COL>;
+};
+
+template <template <typename, std::size_t> class array_t,
+          concepts::scalar scalar_t, std::size_t ROW, std::size_t COL>
+struct element_getter<
+    storage::row_major_matrix<array_t, scalar_t, ROW, COL>> {
+  using type = storage::element_getter;
+};
+
+template <template <typename, std::size_t> class array_t,
+          concepts::scalar scalar_t, std::size_t ROW, std::size_t COL>
+struct block_getter<storage::row_major_matrix<array_t, scalar_t, ROW, COL>> {
+  using type = storage::block_getter;
+};
+/// @}
+
+}  // namespace algebra::traits
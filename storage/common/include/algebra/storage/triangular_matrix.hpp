@@ -0,0 +1,604 @@
+/** Algebra plugins library, part of the ACTS project
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "algebra/concepts.hpp"
+#include "algebra/qualifiers.hpp"
+#include "algebra/storage/matrix.hpp"
+#include "algebra/type_traits.hpp"
+
+// System include(s).
+#include <array>
+#include <cassert>
+#include <cstddef>
+
+namespace algebra::storage {
+
+/// Triangular square matrix
+///
+/// Only the N(N+1)/2 elements of the lower (or upper) triangle are stored,
+/// packed column by column. The matrix has the dimensions and the value type
+/// of the (dense) square matrix type @tparam matrix_t, which is also the type
+/// of the dense matrices that are created from it.
+///
+/// @tparam UPPER whether the matrix is upper (or lower) triangular
+template <concepts::square_matrix matrix_t, bool UPPER>
+class triangular_matrix {
+
+ public:
+  /// Dense matrix type
+  using matrix_type = matrix_t;
+  using value_type = algebra::traits::value_t<matrix_type>;
+  // Value type is a simd vector in SoA and a scalar in AoS
+  using scalar_type = algebra::traits::scalar_t<matrix_type>;
+  using size_type = algebra::traits::index_t<matrix_type>;
+  /// Packed storage of the elements in the triangle
+  using array_type =
+      std::array<scalar_type, algebra::traits::rank<matrix_type> *
+                                  (algebra::traits::rank<matrix_type> + 1u) /
+                                  2u>;
+
+  /// Default constructor sets all entries to zero.
+  constexpr triangular_matrix() = default;
+
+  /// Construct from the packed elements @param d of the triangle
+  ALGEBRA_HOST_DEVICE
+  constexpr explicit triangular_matrix(const array_type &d) : m_data{d} {}
+
+  /// Construct from the triangle of the square matrix @param m
+  template <concepts::square_matrix other_matrix_t>
+  requires(algebra::traits::rank<other_matrix_t> ==
+           algebra::traits::rank<matrix_type>) ALGEBRA_HOST_DEVICE
+      constexpr explicit triangular_matrix(const other_matrix_t &m) {
+
+    using element_getter_t = algebra::traits::element_getter_t<other_matrix_t>;
+
+    for (std::size_t j = 0u; j < columns(); ++j) {
+      for (std::size_t i = first_row(j); i <= last_row(j); ++i) {
+        element(i, j) = element_getter_t{}(m, i, j);
+      }
+    }
+  }
+
+  /// @returns the element in row @param row and column @param col
+  ALGEBRA_HOST_DEVICE
+  constexpr scalar_type operator()(const std::size_t row,
+                                   const std::size_t col) const {
+    assert(row < rows());
+    assert(col < columns());
+    return is_in_triangle(row, col) ? m_data[packed_index(row, col)]
+                                    : scalar_type(0);
+  }
+
+  /// Access to the element in row @param row and column @param col, which
+  /// has to be part of the triangle
+  /// @{
+  ALGEBRA_HOST_DEVICE
+  constexpr scalar_type &element(const std::size_t row, const std::size_t col) {
+    assert(is_in_triangle(row, col));
+    return m_data[packed_index(row, col)];
+  }
+  ALGEBRA_HOST_DEVICE
+  constexpr const scalar_type &element(const std::size_t row,
+                                       const std::size_t col) const {
+    assert(is_in_triangle(row, col));
+    return m_data[packed_index(row, col)];
+  }
+  /// @}
+
+  /// @returns the packed elements
+  ALGEBRA_HOST_DEVICE
+  constexpr const array_type &data() const { return m_data; }
+
+  /// @returns whether the matrix is upper triangular
+  ALGEBRA_HOST_DEVICE
+  static consteval bool is_upper() { return UPPER; }
+
+  /// @returns the number of rows
+  ALGEBRA_HOST_DEVICE
+  static consteval std::size_t rows() {
+    return algebra::traits::rank<matrix_type>;
+  }
+
+  /// @returns the number of columns
+  ALGEBRA_HOST_DEVICE
+  static consteval std::size_t columns() { return rows(); }
+
+  /// @returns the first row of the triangle in column @param col
+  ALGEBRA_HOST_DEVICE
+  static constexpr std::size_t first_row(const std::size_t col) {
+    return UPPER ? 0u : col;
+  }
+
+  /// @returns the last row of the triangle in column @param col
+  ALGEBRA_HOST_DEVICE
+  static constexpr std::size_t last_row(const std::size_t col) {
+    return UPPER ? col : rows() - 1u;
+  }
+
+  /// @returns whether the element in row @param row and column @param col
+  /// is part of the triangle
+  ALGEBRA_HOST_DEVICE
+  static constexpr bool is_in_triangle(const std::size_t row,
+                                       const std::size_t col) {
+    return UPPER ? row <= col : row >= col;
+  }
+
+  /// Conversion to the dense matrix type
+  ALGEBRA_HOST_DEVICE
+  constexpr operator matrix_type() const {
+
+    using element_getter_t = algebra::traits::element_getter_t<matrix_type>;
+
+    matrix_type m;
+    for (std::size_t j = 0u; j < columns(); ++j) {
+      for (std::size_t i = 0u; i < rows(); ++i) {
+        element_getter_t{}(m, i, j) = (*this)(i, j);
+      }
+    }
+    return m;
+  }
+
+ private:
+  /// @returns the position of the element in row @param row and column
+  /// @param col in the packed storage
+  ALGEBRA_HOST_DEVICE
+  static constexpr std::size_t packed_index(const std::size_t row,
+                                            const std::size_t col) {
+    if constexpr (UPPER) {
+      return col * (col + 1u) / 2u + row;
+    } else {
+      return col * (2u * rows() + 1u - col) / 2u + (row - col);
+    }
+  }
+
+  /// The packed elements of the triangle
+  array_type m_data{};
+
+};  // class triangular_matrix
+
+/// Lower triangular matrix
+template <concepts::square_matrix matrix_t>
+using lower_triangular = triangular_matrix<matrix_t, false>;
+
+/// Upper triangular matrix
+template <concepts::square_matrix matrix_t>
+using upper_triangular = triangular_matrix<matrix_t, true>;
+
+/// Check whether a type is a triangular matrix
+/// @{
+template <typename T>
+inline constexpr bool is_triangular{false};
+
+template <typename matrix_t, bool UPPER>
+inline constexpr bool is_triangular<triangular_matrix<matrix_t, UPPER>>{true};
+/// @}
+
+/// Functor used to read the elements of a triangular matrix
+struct triangular_element_getter {
+
+  /// @returns the element in row @param row and column @param col of the
+  /// triangular matrix @param m (the elements cannot be written)
+  template <typename matrix_t, bool UPPER>
+  ALGEBRA_HOST_DEVICE constexpr auto operator()(
+      const triangular_matrix<matrix_t, UPPER> &m, std::size_t row,
+      std::size_t col) const {
+    return m(row, col);
+  }
+
+};  // struct triangular_element_getter
+
+/// Function extracting an element from a triangular matrix
+template <typename matrix_t, bool UPPER>
+ALGEBRA_HOST_DEVICE constexpr auto element(
+    const triangular_matrix<matrix_t, UPPER> &m, std::size_t row,
+    std::size_t col) {
+  return triangular_element_getter{}(m, row, col);
+}
+
+namespace detail {
+
+/// Apply the kernel @param f to every column of the matrix (or the vector)
+/// @param c, passing an accessor to the column elements
+template <typename MC, typename function_t>
+ALGEBRA_HOST_DEVICE constexpr void for_each_column(MC &c, function_t &&f) {
+
+  using c_getter_t = algebra::traits::element_getter_t<MC>;
+
+  if constexpr (concepts::vector<MC>) {
+    f([&c](const std::size_t i) -> decltype(auto) {
+      return c_getter_t{}(c, i);
+    });
+  } else {
+    for (std::size_t j = 0u; j < algebra::traits::columns<MC>; ++j) {
+      f([&c, j](const std::size_t i) -> decltype(auto) {
+        return c_getter_t{}(c, i, j);
+      });
+    }
+  }
+}
+
+/// @returns a matrix (or vector) with the type and dimensions of the product
+/// of the triangular matrix @param t with the matrix (or vector) @tparam MB,
+/// initialized with the elements of @param b
+template <typename matrix_t, bool UPPER, typename MB>
+ALGEBRA_HOST_DEVICE constexpr auto copy_operand(
+    const triangular_matrix<matrix_t, UPPER> &, const MB &b) {
+
+  using value_t = algebra::traits::value_t<matrix_t>;
+  using b_getter_t = algebra::traits::element_getter_t<MB>;
+
+  constexpr std::size_t N{algebra::traits::rank<matrix_t>};
+
+  if constexpr (concepts::vector<MB>) {
+    using vector_t = algebra::traits::get_vector_t<matrix_t, N, value_t>;
+    using c_getter_t = algebra::traits::element_getter_t<vector_t>;
+
+    vector_t c;
+    for (std::size_t i = 0u; i < N; ++i) {
+      c_getter_t{}(c, i) = b_getter_t{}(b, i);
+    }
+    return c;
+  } else {
+    constexpr std::size_t C{algebra::traits::columns<MB>};
+
+    using c_matrix_t = algebra::traits::get_matrix_t<matrix_t, N, C, value_t>;
+    using c_getter_t = algebra::traits::element_getter_t<c_matrix_t>;
+
+    c_matrix_t c;
+    for (std::size_t j = 0u; j < C; ++j) {
+      for (std::size_t i = 0u; i < N; ++i) {
+        c_getter_t{}(c, i, j) = b_getter_t{}(b, i, j);
+      }
+    }
+    return c;
+  }
+}
+
+/// Multiply the column @param x in place with the triangular matrix @param t
+///
+/// The loops are fully unrolled for matrices up to rank 8.
+template <typename matrix_t, bool UPPER, typename column_t>
+ALGEBRA_HOST_DEVICE constexpr void multiply_column(
+    const triangular_matrix<matrix_t, UPPER> &t, column_t &&x) {
+
+  constexpr std::size_t N{algebra::traits::rank<matrix_t>};
+
+  if constexpr (UPPER) {
+    // Row i only depends on the rows below it
+    ALGEBRA_UNROLL_N(8)
+    for (std::size_t i = 0u; i < N; ++i) {
+      x(i) = t.element(i, i) * x(i);
+      ALGEBRA_UNROLL_N(8)
+      for (std::size_t k = i + 1u; k < N; ++k) {
+        x(i) += t.element(i, k) * x(k);
+      }
+    }
+  } else {
+    // Row i only depends on the rows above it
+    ALGEBRA_UNROLL_N(8)
+    for (std::size_t r = 0u; r < N; ++r) {
+      const std::size_t i{N - 1u - r};
+      x(i) = t.element(i, i) * x(i);
+      ALGEBRA_UNROLL_N(8)
+      for (std::size_t k = 0u; k < i; ++k) {
+        x(i) += t.element(i, k) * x(k);
+      }
+    }
+  }
+}
+
+/// Solve the triangular system @c t*x=b in place for the column @param x,
+/// which holds @c b on input
+///
+/// The loops are fully unrolled for matrices up to rank 8.
+///
+/// @tparam UNIT_DIAGONAL assume ones on the diagonal of @param t
+template <bool UNIT_DIAGONAL, typename matrix_t, bool UPPER, typename column_t>
+ALGEBRA_HOST_DEVICE constexpr void solve_column(
+    const triangular_matrix<matrix_t, UPPER> &t, column_t &&x) {
+
+  constexpr std::size_t N{algebra::traits::rank<matrix_t>};
+
+  if constexpr (UPPER) {
+    // Back substitution, column by column of the packed storage
+    ALGEBRA_UNROLL_N(8)
+    for (std::size_t r = 0u; r < N; ++r) {
+      const std::size_t j{N - 1u - r};
+      if constexpr (!UNIT_DIAGONAL) {
+        x(j) /= t.element(j, j);
+      }
+      ALGEBRA_UNROLL_N(8)
+      for (std::size_t i = 0u; i < j; ++i) {
+        x(i) -= t.element(i, j) * x(j);
+      }
+    }
+  } else {
+    // Forward substitution, column by column of the packed storage
+    ALGEBRA_UNROLL_N(8)
+    for (std::size_t j = 0u; j < N; ++j) {
+      if constexpr (!UNIT_DIAGONAL) {
+        x(j) /= t.element(j, j);
+      }
+      ALGEBRA_UNROLL_N(8)
+      for (std::size_t i = j + 1u; i < N; ++i) {
+        x(i) -= t.element(i, j) * x(j);
+      }
+    }
+  }
+}
+
+}  // namespace detail
+
+/// @returns the product of the triangular matrix @param t with the vector
+/// @param v
+template <typename matrix_t, bool UPPER, concepts::vector vector_t>
+requires(algebra::traits::rows<vector_t> ==
+         algebra::traits::rank<matrix_t>) ALGEBRA_HOST_DEVICE
+    constexpr auto trmv(const triangular_matrix<matrix_t, UPPER> &t,
+                        const vector_t &v) {
+  auto c = detail::copy_operand(t, v);
+  detail::for_each_column(c, [&t](auto &&x) { detail::multiply_column(t, x); });
+  return c;
+}
+
+/// @returns the product of the triangular matrix @param t with the matrix
+/// @param b
+template <typename matrix_t, bool UPPER, concepts::matrix MB>
+requires(!is_triangular<MB> &&
+         algebra::traits::rows<MB> == algebra::traits::rank<matrix_t>)
+    ALGEBRA_HOST_DEVICE constexpr auto trmm(
+        const triangular_matrix<matrix_t, UPPER> &t, const MB &b) {
+  auto c = detail::copy_operand(t, b);
+  detail::for_each_column(c, [&t](auto &&x) { detail::multiply_column(t, x); });
+  return c;
+}
+
+/// @returns the product of the matrix @param a with the triangular matrix
+/// @param t
+template <concepts::matrix MA, typename matrix_t, bool UPPER>
+requires(!is_triangular<MA> &&
+         algebra::traits::columns<MA> == algebra::traits::rank<matrix_t>)
+    ALGEBRA_HOST_DEVICE constexpr auto trmm(
+        const MA &a, const triangular_matrix<matrix_t, UPPER> &t) {
+
+  using value_t = algebra::traits::value_t<matrix_t>;
+  using a_getter_t = algebra::traits::element_getter_t<MA>;
+
+  constexpr std::size_t R{algebra::traits::rows<MA>};
+  constexpr std::size_t N{algebra::traits::rank<matrix_t>};
+
+  using c_matrix_t = algebra::traits::get_matrix_t<matrix_t, R, N, value_t>;
+  using c_getter_t = algebra::traits::element_getter_t<c_matrix_t>;
+
+  // Column j of the product only depends on the columns of a that meet the
+  // triangle in column j of t
+  c_matrix_t c;
+  for (std::size_t j = 0u; j < N; ++j) {
+    for (std::size_t i = 0u; i < R; ++i) {
+      c_getter_t{}(c, i, j) = a_getter_t{}(a, i, j) * t.element(j, j);
+    }
+    for (std::size_t k = t.first_row(j); k <= t.last_row(j); ++k) {
+      if (k != j) {
+        for (std::size_t i = 0u; i < R; ++i) {
+          c_getter_t{}(c, i, j) += a_getter_t{}(a, i, k) * t.element(k, j);
+        }
+      }
+    }
+  }
+  return c;
+}
+
+/// @returns the solution @c x of the system @c l*x=b with the lower
+/// triangular matrix @param l and the vector (or matrix) @param b
+///
+/// @tparam UNIT_DIAGONAL assume ones on the diagonal of @param l (e.g. the
+/// L factor of an LU decomposition), which are then not read
+template <bool UNIT_DIAGONAL = false, typename matrix_t, typename MB>
+requires((concepts::vector<MB> || concepts::matrix<MB>) &&
+         algebra::traits::rows<MB> == algebra::traits::rank<matrix_t>)
+    ALGEBRA_HOST_DEVICE constexpr auto solve_lower(
+        const lower_triangular<matrix_t> &l, const MB &b) {
+  auto x = detail::copy_operand(l, b);
+  detail::for_each_column(x, [&l](auto &&c) {
+    detail::solve_column<UNIT_DIAGONAL>(l, c);
+  });
+  return x;
+}
+
+/// @returns the solution @c x of the system @c u*x=b with the upper
+/// triangular matrix @param u and the vector (or matrix) @param b
+///
+/// @tparam UNIT_DIAGONAL assume ones on the diagonal of @param u, which are
+/// then not read
+template <bool UNIT_DIAGONAL = false, typename matrix_t, typename MB>
+requires((concepts::vector<MB> || concepts::matrix<MB>) &&
+         algebra::traits::rows<MB> == algebra::traits::rank<matrix_t>)
+    ALGEBRA_HOST_DEVICE constexpr auto solve_upper(
+        const upper_triangular<matrix_t> &u, const MB &b) {
+  auto x = detail::copy_operand(u, b);
+  detail::for_each_column(x, [&u](auto &&c) {
+    detail::solve_column<UNIT_DIAGONAL>(u, c);
+  });
+  return x;
+}
+
+/// Products of a triangular matrix with dense matrices and vectors
+/// @{
+template <typename matrix_t, bool UPPER, typename MB>
+requires(!is_triangular<MB> && (concepts::matrix<MB> || concepts::vector<MB>) &&
+         algebra::traits::rows<MB> == algebra::traits::rank<matrix_t>)
+    ALGEBRA_HOST_DEVICE constexpr auto
+    operator*(const triangular_matrix<matrix_t, UPPER> &t, const MB &b) {
+  if constexpr (concepts::vector<MB>) {
+    return trmv(t, b);
+  } else {
+    return trmm(t, b);
+  }
+}
+
+// Takes precedence over the scalar multiplication of storage::matrix
+template <typename matrix_t, bool UPPER,
+          template <typename, std::size_t> class array_t,
+          concepts::scalar scalar_t, std::size_t ROW, std::size_t COL>
+requires(ROW == algebra::traits::rank<matrix_t>) ALGEBRA_HOST_DEVICE
+    constexpr auto
+    operator*(const triangular_matrix<matrix_t, UPPER> &t,
+              const matrix<array_t, scalar_t, ROW, COL> &b) {
+  return trmm(t, b);
+}
+
+template <concepts::matrix MA, typename matrix_t, bool UPPER>
+requires(!is_triangular<MA> &&
+         algebra::traits::columns<MA> == algebra::traits::rank<matrix_t>)
+    ALGEBRA_HOST_DEVICE constexpr auto
+    operator*(const MA &a, const triangular_matrix<matrix_t, UPPER> &t) {
+  return trmm(a, t);
+}
+/// @}
+
+/// @returns the product of two lower (or upper) triangular matrices, which
+/// is again lower (or upper) triangular
+template <typename matrix_t, bool UPPER>
+ALGEBRA_HOST_DEVICE constexpr triangular_matrix<matrix_t, UPPER> operator*(
+    const triangular_matrix<matrix_t, UPPER> &a,
+    const triangular_matrix<matrix_t, UPPER> &b) {
+
+  constexpr std::size_t N{algebra::traits::rank<matrix_t>};
+
+  triangular_matrix<matrix_t, UPPER> c;
+  for (std::size_t j = 0u; j < N; ++j) {
+    for (std::size_t i = c.first_row(j); i <= c.last_row(j); ++i) {
+      // Only the k between the column and the row meet both triangles
+      const std::size_t k_min{UPPER ? i : j};
+      const std::size_t k_max{UPPER ? j : i};
+      for (std::size_t k = k_min; k <= k_max; ++k) {
+        c.element(i, j) += a.element(i, k) * b.element(k, j);
+      }
+    }
+  }
+  return c;
+}
+
+/// @returns the product of a lower and an upper triangular matrix (or vice
+/// versa), which is dense
+template <typename matrix_t, bool UPPER>
+ALGEBRA_HOST_DEVICE constexpr auto operator*(
+    const triangular_matrix<matrix_t, UPPER> &a,
+    const triangular_matrix<matrix_t, !UPPER> &b) {
+  return trmm(a, static_cast<matrix_t>(b));
+}
+
+/// @returns the determinant of the triangular matrix @param t
+template <typename matrix_t, bool UPPER>
+ALGEBRA_HOST_DEVICE constexpr algebra::traits::scalar_t<matrix_t> determinant(
+    const triangular_matrix<matrix_t, UPPER> &t) {
+  algebra::traits::scalar_t<matrix_t> det{t.element(0u, 0u)};
+  for (std::size_t i = 1u; i < t.rows(); ++i) {
+    det *= t.element(i, i);
+  }
+  return det;
+}
+
+/// @returns the inverse of the triangular matrix @param t, which is again
+/// lower (or upper) triangular
+template <typename matrix_t, bool UPPER>
+ALGEBRA_HOST_DEVICE constexpr triangular_matrix<matrix_t, UPPER> inverse(
+    const triangular_matrix<matrix_t, UPPER> &t) {
+
+  using scalar_t = algebra::traits::scalar_t<matrix_t>;
+
+  constexpr std::size_t N{algebra::traits::rank<matrix_t>};
+
+  // Solve for the unit vectors, skipping the known zeros of the inverse
+  triangular_matrix<matrix_t, UPPER> inv;
+  for (std::size_t j = 0u; j < N; ++j) {
+    inv.element(j, j) = scalar_t(1) / t.element(j, j);
+
+    if constexpr (UPPER) {
+      for (std::size_t m = j; m-- > 0u;) {
+        for (std::size_t k = m + 1u; k <= j; ++k) {
+          inv.element(m, j) -= t.element(m, k) * inv.element(k, j);
+        }
+        inv.element(m, j) /= t.element(m, m);
+      }
+    } else {
+      for (std::size_t m = j + 1u; m < N; ++m) {
+        for (std::size_t k = j; k < m; ++k) {
+          inv.element(m, j) -= t.element(m, k) * inv.element(k, j);
+        }
+        inv.element(m, j) /= t.element(m, m);
+      }
+    }
+  }
+  return inv;
+}
+
+/// @returns the transpose of the triangular matrix @param t, which is upper
+/// triangular if @param t is lower triangular and vice versa
+template <typename matrix_t, bool UPPER>
+ALGEBRA_HOST_DEVICE constexpr triangular_matrix<matrix_t, !UPPER> transpose(
+    const triangular_matrix<matrix_t, UPPER> &t) {
+
+  constexpr std::size_t N{algebra::traits::rank<matrix_t>};
+
+  triangular_matrix<matrix_t, !UPPER> res;
+  for (std::size_t j = 0u; j < N; ++j) {
+    for (std::size_t i = t.first_row(j); i <= t.last_row(j); ++i) {
+      res.element(j, i) = t.element(i, j);
+    }
+  }
+  return res;
+}
+
+}  // namespace algebra::storage
+
+namespace algebra::traits {
+
+/// Type traits of the triangular matrices
+/// @{
+template <typename matrix_t, bool UPPER>
+struct index<storage::triangular_matrix<matrix_t, UPPER>>
+    : public index<matrix_t> {};
+
+template <typename matrix_t, bool UPPER>
+struct dimensions<storage::triangular_matrix<matrix_t, UPPER>> {
+
+  using size_type = index_t<storage::triangular_matrix<matrix_t, UPPER>>;
+
+  static constexpr size_type dim{2};
+  static constexpr size_type rows{
+      storage::triangular_matrix<matrix_t, UPPER>::rows()};
+  static constexpr size_type columns{
+      storage::triangular_matrix<matrix_t, UPPER>::columns()};
+};
+
+template <typename matrix_t, bool UPPER>
+struct value<storage::triangular_matrix<matrix_t, UPPER>>
+    : public value<matrix_t> {};
+
+template <typename matrix_t, bool UPPER>
+struct scalar<storage::triangular_matrix<matrix_t, UPPER>>
+    : public scalar<matrix_t> {};
+
+template <typename matrix_t, bool UPPER>
+struct vector<storage::triangular_matrix<matrix_t, UPPER>>
+    : public vector<matrix_t> {};
+
+template <typename matrix_t, bool UPPER>
+struct matrix<storage::triangular_matrix<matrix_t, UPPER>>
+    : public matrix<matrix_t> {};
+
+template <typename matrix_t, bool UPPER>
+struct element_getter<storage::triangular_matrix<matrix_t, UPPER>> {
+  using type = storage::triangular_element_getter;
+};
+/// @}
+
+}  // namespace algebra::traits
@@ -9,12 +9,18 @@
 
 // Project include(s).
 #include "algebra/concepts.hpp"
+#include "algebra/storage/block_diagonal_matrix.hpp"
+#include "algebra/storage/diagonal_matrix.hpp"
 #include "algebra/storage/impl/eigen_array.hpp"
 #include "algebra/storage/impl/eigen_getter.hpp"
+#include "algebra/storage/projection_matrix.hpp"
+#include "algebra/storage/reinterpret_as.hpp"
+#include "algebra/storage/triangular_matrix.hpp"
 #include "algebra/type_traits.hpp"
 
 // System include(s).
 #include <cstddef>
+#include <type_traits>
 
 namespace algebra {
 
@@ -38,6 +44,26 @@ using vector_type = storage_type<T, N>;
 /// If the number of rows is 1, make it RowMajor
 template <concepts::scalar T, size_type ROWS, size_type COLS>
 using matrix_type = Eigen::Matrix<T, ROWS, COLS, (ROWS == 1), ROWS, COLS>;
+/// Diagonal matrix type that only stores the diagonal elements
+template <concepts::scalar T, size_type N>
+using diagonal_matrix =
+    algebra::storage::diagonal_matrix<matrix_type<T, N, N>>;
+/// Projection matrix type that only stores the indices of the selected
+/// elements
+template <concepts::scalar T, size_type M, size_type N>
+using projection_matrix =
+    algebra::storage::projection_matrix<matrix_type<T, M, N>>;
+/// Triangular matrix types that only store the elements of the triangle
+template <concepts::scalar T, size_type N>
+using lower_triangular =
+    algebra::storage::lower_triangular<matrix_type<T, N, N>>;
+template <concepts::scalar T, size_type N>
+using upper_triangular =
+    algebra::storage::upper_triangular<matrix_type<T, N, N>>;
+/// Block diagonal matrix type with square blocks of the ranks @tparam N
+template <concepts::scalar T, size_type... N>
+using block_diagonal_matrix =
+    algebra::storage::block_diagonal_matrix<matrix_type<T, N, N>...>;
 
 /// 3-element "vector" type, using @c eigen::vector_type
 template <concepts::scalar T>
@@ -152,8 +178,7 @@ struct matrix<Eigen::Block<Eigen::Matrix<T, ROWS, COLS, OPT, ROWS, COLS>, bROWS,
   template <typename other_T, int other_ROWS, int other_COLS>
   using other_type = eigen::matrix_type<other_T, other_ROWS, other_COLS>;
 
-  using type = Eigen::Block<Eigen::Matrix<T, ROWS, COLS, OPT, ROWS, COLS>,
-                            bROWS, bCOLS, false>;
+  using type = other_type<T, bROWS, bCOLS>;
 };
 /// @}
 
@@ -179,6 +204,43 @@ struct block_getter<Eigen::MatrixBase<derived_t>> {
 };
 /// @}
 
+/// Memory layout (a single row or column is contiguous in either order)
+/// @{
+template <typename T, int ROWS, int COLS, int OPT>
+struct column_major<Eigen::Matrix<T, ROWS, COLS, OPT, ROWS, COLS>>
+    : public std::bool_constant<!(OPT & Eigen::RowMajor) || ROWS == 1 ||
+                                COLS == 1> {};
+
+template <typename T, int N>
+struct column_major<eigen::array<T, N>> : public std::true_type {};
+/// @}
+
 }  // namespace traits
 
+namespace storage {
+
+/// Map external buffers onto Eigen types, so that the Eigen operations work
+/// on them. The buffers do not have to fulfill the Eigen alignment.
+/// @{
+template <typename T, int ROWS, int COLS, int OPT>
+struct mapped<Eigen::Matrix<T, ROWS, COLS, OPT, ROWS, COLS>> {
+
+  template <typename value_t>
+  ALGEBRA_HOST_DEVICE auto operator()(value_t *data) const {
+
+    using matrix_t = Eigen::Matrix<T, ROWS, COLS, OPT, ROWS, COLS>;
+    using map_t = std::conditional_t<std::is_const_v<value_t>,
+                                     const matrix_t, matrix_t>;
+
+    return Eigen::Map<map_t, Eigen::Unaligned>{data};
+  }
+};
+
+template <typename T, int N>
+struct mapped<eigen::array<T, N>>
+    : public mapped<Eigen::Matrix<T, N, 1, 0, N, 1>> {};
+/// @}
+
+}  // namespace storage
+
 }  // namespace algebra
@@ -9,8 +9,12 @@
 
 // Project include(s).
 #include "algebra/concepts.hpp"
+#include "algebra/storage/block_diagonal_matrix.hpp"
+#include "algebra/storage/diagonal_matrix.hpp"
 #include "algebra/storage/impl/fastor_getter.hpp"
 #include "algebra/storage/impl/fastor_matrix.hpp"
+#include "algebra/storage/projection_matrix.hpp"
+#include "algebra/storage/triangular_matrix.hpp"
 #include "algebra/type_traits.hpp"
 
 // System include(s).
@@ -37,6 +41,26 @@ using vector_type = storage_type<T, N>;
 /// Matrix type used in the Fastor storage model
 template <concepts::scalar T, size_type ROWS, size_type COLS>
 using matrix_type = algebra::fastor::Matrix<T, ROWS, COLS>;
+/// Diagonal matrix type that only stores the diagonal elements
+template <concepts::scalar T, size_type N>
+using diagonal_matrix =
+    algebra::storage::diagonal_matrix<matrix_type<T, N, N>>;
+/// Projection matrix type that only stores the indices of the selected
+/// elements
+template <concepts::scalar T, size_type M, size_type N>
+using projection_matrix =
+    algebra::storage::projection_matrix<matrix_type<T, M, N>>;
+/// Triangular matrix types that only store the elements of the triangle
+template <concepts::scalar T, size_type N>
+using lower_triangular =
+    algebra::storage::lower_triangular<matrix_type<T, N, N>>;
+template <concepts::scalar T, size_type N>
+using upper_triangular =
+    algebra::storage::upper_triangular<matrix_type<T, N, N>>;
+/// Block diagonal matrix type with square blocks of the ranks @tparam N
+template <concepts::scalar T, size_type... N>
+using block_diagonal_matrix =
+    algebra::storage::block_diagonal_matrix<matrix_type<T, N, N>...>;
 
 /// 3-element "vector" type, using @c Fastor::Tensor
 template <concepts::scalar T>
@@ -9,7 +9,11 @@
 
 // Project include(s)
 #include "algebra/concepts.hpp"
+#include "algebra/storage/block_diagonal_matrix.hpp"
+#include "algebra/storage/diagonal_matrix.hpp"
 #include "algebra/storage/impl/smatrix_getter.hpp"
+#include "algebra/storage/projection_matrix.hpp"
+#include "algebra/storage/triangular_matrix.hpp"
 #include "algebra/type_traits.hpp"
 
 // ROOT/Smatrix include(s).
@@ -40,6 +44,26 @@ using vector_type = storage_type<T, N>;
 /// Matrix type used in the SMatrix storage model
 template <concepts::scalar T, size_type ROWS, size_type COLS>
 using matrix_type = ROOT::Math::SMatrix<T, ROWS, COLS>;
+/// Diagonal matrix type that only stores the diagonal elements
+template <concepts::scalar T, size_type N>
+using diagonal_matrix =
+    algebra::storage::diagonal_matrix<matrix_type<T, N, N>>;
+/// Projection matrix type that only stores the indices of the selected
+/// elements
+template <concepts::scalar T, size_type M, size_type N>
+using projection_matrix =
+    algebra::storage::projection_matrix<matrix_type<T, M, N>>;
+/// Triangular matrix types that only store the elements of the triangle
+template <concepts::scalar T, size_type N>
+using lower_triangular =
+    algebra::storage::lower_triangular<matrix_type<T, N, N>>;
+template <concepts::scalar T, size_type N>
+using upper_triangular =
+    algebra::storage::upper_triangular<matrix_type<T, N, N>>;
+/// Block diagonal matrix type with square blocks of the ranks @tparam N
+template <concepts::scalar T, size_type... N>
+using block_diagonal_matrix =
+    algebra::storage::block_diagonal_matrix<matrix_type<T, N, N>...>;
 
 /// 3-element "vector" type, using @c ROOT::Math::SVector
 template <concepts::scalar T>
@@ -63,4 +87,133 @@ using block_getter = smatrix::storage::block_getter;
 
 ALGEBRA_PLUGINS_DEFINE_TYPE_TRAITS(smatrix)
 
+namespace storage {
+
+/// Arithmetic operators between SMatrix and diagonal matrices, which would
+/// otherwise be ambiguous with the (unconstrained) scalar operators of SMatrix
+/// @{
+template <concepts::scalar T, smatrix::size_type N, typename matrix_t>
+inline auto operator+(const smatrix::matrix_type<T, N, N> &a,
+                      const diagonal_matrix<matrix_t> &d) {
+  return detail::add_diagonal<1, false>(a, d);
+}
+
+template <typename matrix_t, concepts::scalar T, smatrix::size_type N>
+inline auto operator+(const diagonal_matrix<matrix_t> &d,
+                      const smatrix::matrix_type<T, N, N> &b) {
+  return detail::add_diagonal<1, false>(b, d);
+}
+
+template <concepts::scalar T, smatrix::size_type N, typename matrix_t>
+inline auto operator-(const smatrix::matrix_type<T, N, N> &a,
+                      const diagonal_matrix<matrix_t> &d) {
+  return detail::add_diagonal<-1, false>(a, d);
+}
+
+template <typename matrix_t, concepts::scalar T, smatrix::size_type N>
+inline auto operator-(const diagonal_matrix<matrix_t> &d,
+                      const smatrix::matrix_type<T, N, N> &b) {
+  return detail::add_diagonal<1, true>(b, d);
+}
+
+template <concepts::scalar T, smatrix::size_type ROWS,
+          smatrix::size_type COLS, typename matrix_t>
+inline auto operator*(const smatrix::matrix_type<T, ROWS, COLS> &a,
+                      const diagonal_matrix<matrix_t> &d) {
+  return detail::scale_columns(a, d);
+}
+
+template <typename matrix_t, concepts::scalar T, smatrix::size_type ROWS,
+          smatrix::size_type COLS>
+inline auto operator*(const diagonal_matrix<matrix_t> &d,
+                      const smatrix::matrix_type<T, ROWS, COLS> &b) {
+  return detail::scale_rows(d, b);
+}
+/// @}
+
+/// Products of SMatrix types with projection matrices, which would otherwise
+/// be ambiguous with the (unconstrained) scalar operators of SMatrix
+/// @{
+template <typename matrix_t, bool TRANSPOSED, concepts::scalar T,
+          smatrix::size_type ROWS, smatrix::size_type COLS>
+requires(ROWS == projection_matrix<matrix_t, TRANSPOSED>::columns()) inline auto
+operator*(const projection_matrix<matrix_t, TRANSPOSED> &h,
+          const smatrix::matrix_type<T, ROWS, COLS> &b) {
+  return detail::project_rows(h, b);
+}
+
+template <typename matrix_t, bool TRANSPOSED, concepts::scalar T,
+          smatrix::size_type N>
+requires(N == projection_matrix<matrix_t, TRANSPOSED>::columns()) inline auto
+operator*(const projection_matrix<matrix_t, TRANSPOSED> &h,
+          const smatrix::vector_type<T, N> &v) {
+  return detail::project_rows(h, v);
+}
+
+template <concepts::scalar T, smatrix::size_type ROWS,
+          smatrix::size_type COLS, typename matrix_t, bool TRANSPOSED>
+requires(COLS == projection_matrix<matrix_t, TRANSPOSED>::rows()) inline auto
+operator*(const smatrix::matrix_type<T, ROWS, COLS> &a,
+          const projection_matrix<matrix_t, TRANSPOSED> &h) {
+  return detail::project_columns(a, h);
+}
+/// @}
+
+/// Products of SMatrix types with triangular matrices, which would otherwise
+/// be ambiguous with the (unconstrained) scalar operators of SMatrix
+/// @{
+template <typename matrix_t, bool UPPER, concepts::scalar T,
+          smatrix::size_type ROWS, smatrix::size_type COLS>
+requires(ROWS == algebra::traits::rank<matrix_t>) inline auto operator*(
+    const triangular_matrix<matrix_t, UPPER> &t,
+    const smatrix::matrix_type<T, ROWS, COLS> &b) {
+  return trmm(t, b);
+}
+
+template <typename matrix_t, bool UPPER, concepts::scalar T,
+          smatrix::size_type N>
+requires(N == algebra::traits::rank<matrix_t>) inline auto operator*(
+    const triangular_matrix<matrix_t, UPPER> &t,
+    const smatrix::vector_type<T, N> &v) {
+  return trmv(t, v);
+}
+
+template <concepts::scalar T, smatrix::size_type ROWS,
+          smatrix::size_type COLS, typename matrix_t, bool UPPER>
+requires(COLS == algebra::traits::rank<matrix_t>) inline auto operator*(
+    const smatrix::matrix_type<T, ROWS, COLS> &a,
+    const triangular_matrix<matrix_t, UPPER> &t) {
+  return trmm(a, t);
+}
+/// @}
+
+/// Products of SMatrix types with block diagonal matrices, which would
+/// otherwise be ambiguous with the (unconstrained) scalar operators of SMatrix
+/// @{
+template <typename... block_ts, concepts::scalar T, smatrix::size_type ROWS,
+          smatrix::size_type COLS>
+requires(ROWS == block_diagonal_matrix<block_ts...>::rows()) inline auto
+operator*(const block_diagonal_matrix<block_ts...> &d,
+          const smatrix::matrix_type<T, ROWS, COLS> &b) {
+  return detail::multiply_block_rows(d, b);
+}
+
+template <typename... block_ts, concepts::scalar T, smatrix::size_type N>
+requires(N == block_diagonal_matrix<block_ts...>::rows()) inline auto
+operator*(const block_diagonal_matrix<block_ts...> &d,
+          const smatrix::vector_type<T, N> &v) {
+  return detail::multiply_block_rows(d, v);
+}
+
+template <concepts::scalar T, smatrix::size_type ROWS,
+          smatrix::size_type COLS, typename... block_ts>
+requires(COLS == block_diagonal_matrix<block_ts...>::rows()) inline auto
+operator*(const smatrix::matrix_type<T, ROWS, COLS> &a,
+          const block_diagonal_matrix<block_ts...> &d) {
+  return detail::multiply_block_columns(a, d);
+}
+/// @}
+
+}  // namespace storage
+
 }  // namespace algebra
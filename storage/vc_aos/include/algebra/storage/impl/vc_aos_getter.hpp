@@ -28,4 +28,14 @@ ALGEBRA_HOST_DEVICE constexpr decltype(auto) vector(
   return algebra::storage::block_getter{}.template vector<SIZE>(m, row, col);
 }
 
+/// Get a (column) vector of a const row major matrix
+template <std::size_t SIZE, std::size_t ROW, std::size_t COL,
+          concepts::scalar scalar_t,
+          template <typename, std::size_t> class array_t>
+ALGEBRA_HOST_DEVICE constexpr decltype(auto) vector(
+    const algebra::storage::row_major_matrix<array_t, scalar_t, ROW, COL> &m,
+    const std::size_t row, const std::size_t col) noexcept {
+  return algebra::storage::block_getter{}.template vector<SIZE>(m, row, col);
+}
+
 }  // namespace algebra::vc_aos::storage
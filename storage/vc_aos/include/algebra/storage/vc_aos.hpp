@@ -9,10 +9,16 @@
 
 // Project include(s).
 #include "algebra/concepts.hpp"
+#include "algebra/storage/block_diagonal_matrix.hpp"
+#include "algebra/storage/diagonal_matrix.hpp"
 #include "algebra/storage/impl/vc_aos_approximately_equal.hpp"
 #include "algebra/storage/impl/vc_aos_concepts.hpp"
 #include "algebra/storage/impl/vc_aos_getter.hpp"
 #include "algebra/storage/matrix.hpp"
+#include "algebra/storage/packed_vector.hpp"
+#include "algebra/storage/projection_matrix.hpp"
+#include "algebra/storage/row_major_matrix.hpp"
+#include "algebra/storage/triangular_matrix.hpp"
 #include "algebra/storage/vector.hpp"
 #include "algebra/type_traits.hpp"
 
@@ -53,9 +59,36 @@ using scalar_type = T;
 /// Vector type used in the Vc AoS storage model
 template <concepts::value T, std::size_t N>
 using vector_type = algebra::storage::vector<N, T, storage_type>;
+/// Unpadded vector type for the storage in large collections
+template <concepts::value T, std::size_t N>
+using packed_vector_type = algebra::storage::packed_vector<N, T, storage_type>;
 /// Matrix type used in the Vc AoS storage model
 template <concepts::value T, size_type ROWS, size_type COLS>
 using matrix_type = algebra::storage::matrix<storage_type, T, ROWS, COLS>;
+/// Diagonal matrix type that only stores the diagonal elements
+template <concepts::value T, size_type N>
+using diagonal_matrix =
+    algebra::storage::diagonal_matrix<matrix_type<T, N, N>>;
+/// Projection matrix type that only stores the indices of the selected
+/// elements
+template <concepts::value T, size_type M, size_type N>
+using projection_matrix =
+    algebra::storage::projection_matrix<matrix_type<T, M, N>>;
+/// Triangular matrix types that only store the elements of the triangle
+template <concepts::value T, size_type N>
+using lower_triangular =
+    algebra::storage::lower_triangular<matrix_type<T, N, N>>;
+template <concepts::value T, size_type N>
+using upper_triangular =
+    algebra::storage::upper_triangular<matrix_type<T, N, N>>;
+/// Block diagonal matrix type with square blocks of the ranks @tparam N
+template <concepts::value T, size_type... N>
+using block_diagonal_matrix =
+    algebra::storage::block_diagonal_matrix<matrix_type<T, N, N>...>;
+/// Matrix type with row vector storage, for kernels that work on rows
+template <concepts::value T, size_type ROWS, size_type COLS>
+using row_major_matrix_type =
+    algebra::storage::row_major_matrix<storage_type, T, ROWS, COLS>;
 
 /// 2-element "vector" type, using @c Vc::SimdArray
 template <concepts::value T>
@@ -0,0 +1,277 @@
+/** Algebra plugins library, part of the ACTS project
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "algebra/concepts.hpp"
+#include "algebra/qualifiers.hpp"
+#include "algebra/storage/matrix.hpp"
+#include "algebra/storage/vc_aos.hpp"
+#include "algebra/storage/vc_soa.hpp"
+#include "algebra/storage/vector.hpp"
+
+// Vc include(s).
+#ifdef _MSC_VER
+#pragma warning(push, 0)
+#endif  // MSVC
+#include <Vc/Vc>
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif  // MSVC
+
+// System include(s).
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace algebra::vc_soa {
+
+/// Read and write single lanes of the SoA type @tparam soa_t as AoS objects
+///
+/// Provides the simd type of the lanes (@c simd_type), the corresponding AoS
+/// type (@c aos_type) and the static functions @c get and @c set.
+template <typename soa_t>
+struct lane_access;
+
+/// Lanes of a simd scalar
+template <concepts::value T>
+struct lane_access<Vc::Vector<T>> {
+
+  using simd_type = Vc::Vector<T>;
+  using aos_type = T;
+
+  ALGEBRA_HOST
+  static aos_type get(const simd_type &s, const std::size_t lane) {
+    return s[lane];
+  }
+
+  ALGEBRA_HOST
+  static void set(simd_type &s, const std::size_t lane, const aos_type &v) {
+    s[lane] = v;
+  }
+};
+
+/// Lanes of an SoA vector
+template <concepts::value T, std::size_t N>
+struct lane_access<algebra::storage::vector<N, Vc::Vector<T>, storage_type>> {
+
+  using simd_type = Vc::Vector<T>;
+  using soa_type = algebra::storage::vector<N, simd_type, storage_type>;
+  using aos_type = algebra::vc_aos::vector_type<T, N>;
+
+  ALGEBRA_HOST
+  static aos_type get(const soa_type &s, const std::size_t lane) {
+    assert(lane < simd_type::Size);
+
+    aos_type v;
+    for (std::size_t i = 0u; i < N; ++i) {
+      v[i] = s[i][lane];
+    }
+    return v;
+  }
+
+  ALGEBRA_HOST
+  static void set(soa_type &s, const std::size_t lane, const aos_type &v) {
+    assert(lane < simd_type::Size);
+
+    for (std::size_t i = 0u; i < N; ++i) {
+      s[i][lane] = v[i];
+    }
+  }
+};
+
+/// Lanes of an SoA matrix
+template <concepts::value T, std::size_t ROWS, std::size_t COLS>
+struct lane_access<
+    algebra::storage::matrix<storage_type, Vc::Vector<T>, ROWS, COLS>> {
+
+  using simd_type = Vc::Vector<T>;
+  using soa_type =
+      algebra::storage::matrix<storage_type, simd_type, ROWS, COLS>;
+  using aos_type = algebra::vc_aos::matrix_type<T, ROWS, COLS>;
+
+  ALGEBRA_HOST
+  static aos_type get(const soa_type &s, const std::size_t lane) {
+    assert(lane < simd_type::Size);
+
+    aos_type m;
+    for (std::size_t j = 0u; j < COLS; ++j) {
+      for (std::size_t i = 0u; i < ROWS; ++i) {
+        m[j][i] = s[j][i][lane];
+      }
+    }
+    return m;
+  }
+
+  ALGEBRA_HOST
+  static void set(soa_type &s, const std::size_t lane, const aos_type &m) {
+    assert(lane < simd_type::Size);
+
+    for (std::size_t j = 0u; j < COLS; ++j) {
+      for (std::size_t i = 0u; i < ROWS; ++i) {
+        s[j][i][lane] = m[j][i];
+      }
+    }
+  }
+};
+
+/// Tiled (AoSoA) container of vectors, matrices or transforms
+///
+/// The elements are kept in chunks of the SoA type @tparam soa_t, each of
+/// which holds as many elements as there are lanes in a simd vector. Single
+/// elements are accessed as AoS objects, while bulk operations run on the
+/// chunks, which are the plain @c vc_soa types.
+///
+/// @note The lanes in the last chunk that are beyond @c size() hold
+/// default constructed values.
+template <typename soa_t>
+class aosoa {
+
+ public:
+  /// Lane access of the chunks
+  using access_type = lane_access<soa_t>;
+  /// Type of the chunks
+  using chunk_type = soa_t;
+  /// Type of the single elements
+  using value_type = typename access_type::aos_type;
+  /// Size type
+  using size_type = vc_soa::size_type;
+
+  /// Number of elements per chunk
+  static constexpr size_type width{access_type::simd_type::Size};
+
+  /// Proxy that reads and writes a single element as an AoS object
+  class reference {
+
+   public:
+    /// Construct the proxy for the element in @param lane of @param chunk
+    ALGEBRA_HOST
+    reference(chunk_type &chunk, const size_type lane)
+        : m_chunk{&chunk}, m_lane{lane} {}
+
+    /// Copy the element in
+    ALGEBRA_HOST
+    reference &operator=(const value_type &v) {
+      access_type::set(*m_chunk, m_lane, v);
+      return *this;
+    }
+
+    /// Copy the element from another proxy
+    ALGEBRA_HOST
+    reference &operator=(const reference &other) {
+      return *this = other.get();
+    }
+
+    /// @returns a copy of the element
+    ALGEBRA_HOST
+    value_type get() const { return access_type::get(*m_chunk, m_lane); }
+
+    /// Conversion to the AoS type
+    ALGEBRA_HOST
+    operator value_type() const { return get(); }
+
+   private:
+    /// The chunk that holds the element
+    chunk_type *m_chunk;
+    /// Position of the element in the chunk
+    size_type m_lane;
+  };
+
+  /// Default constructor: Empty container
+  aosoa() = default;
+
+  /// Construct a container for @param n default constructed elements
+  ALGEBRA_HOST
+  explicit aosoa(const size_type n) : m_chunks(n_chunks_for(n)), m_size{n} {}
+
+  /// @returns the number of elements
+  ALGEBRA_HOST
+  size_type size() const { return m_size; }
+
+  /// @returns the number of chunks
+  ALGEBRA_HOST
+  size_type n_chunks() const { return m_chunks.size(); }
+
+  /// Resize the container to @param n elements
+  ALGEBRA_HOST
+  void resize(const size_type n) {
+    m_chunks.resize(n_chunks_for(n));
+    m_size = n;
+  }
+
+  /// Append the element @param v
+  ALGEBRA_HOST
+  void push_back(const value_type &v) {
+    resize(m_size + 1u);
+    (*this)[m_size - 1u] = v;
+  }
+
+  /// Element access
+  /// @{
+  ALGEBRA_HOST
+  reference operator[](const size_type i) {
+    assert(i < m_size);
+    return reference{m_chunks[i / width], i % width};
+  }
+  ALGEBRA_HOST
+  value_type operator[](const size_type i) const {
+    assert(i < m_size);
+    return access_type::get(m_chunks[i / width], i % width);
+  }
+  /// @}
+
+  /// Chunk access (no copy)
+  /// @{
+  ALGEBRA_HOST
+  chunk_type &chunk(const size_type c) {
+    assert(c < m_chunks.size());
+    return m_chunks[c];
+  }
+  ALGEBRA_HOST
+  const chunk_type &chunk(const size_type c) const {
+    assert(c < m_chunks.size());
+    return m_chunks[c];
+  }
+  /// @}
+
+  /// @returns the underlying chunks
+  /// @{
+  ALGEBRA_HOST
+  std::vector<chunk_type> &chunks() { return m_chunks; }
+  ALGEBRA_HOST
+  const std::vector<chunk_type> &chunks() const { return m_chunks; }
+  /// @}
+
+ private:
+  /// @returns the number of chunks needed for @param n elements
+  ALGEBRA_HOST
+  static constexpr size_type n_chunks_for(const size_type n) {
+    return (n + width - 1u) / width;
+  }
+
+  /// The chunks of SoA objects
+  std::vector<chunk_type> m_chunks;
+  /// Number of elements
+  size_type m_size{0u};
+};
+
+/// Apply @param f chunk-wise to the elements of @param in and write the
+/// results to @param out
+template <typename soa_in_t, typename soa_out_t, typename function_t>
+ALGEBRA_HOST void transform_chunks(const aosoa<soa_in_t> &in,
+                                   aosoa<soa_out_t> &out, function_t &&f) {
+  out.resize(in.size());
+
+  for (std::size_t c = 0u; c < in.n_chunks(); ++c) {
+    out.chunk(c) = f(in.chunk(c));
+  }
+}
+
+}  // namespace algebra::vc_soa
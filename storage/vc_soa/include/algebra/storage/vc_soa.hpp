@@ -9,10 +9,14 @@
 
 // Project include(s).
 #include "algebra/concepts.hpp"
+#include "algebra/storage/block_diagonal_matrix.hpp"
+#include "algebra/storage/diagonal_matrix.hpp"
 #include "algebra/storage/impl/vc_aos_approximately_equal.hpp"
 #include "algebra/storage/impl/vc_soa_casts.hpp"
 #include "algebra/storage/impl/vc_soa_getter.hpp"
 #include "algebra/storage/matrix.hpp"
+#include "algebra/storage/projection_matrix.hpp"
+#include "algebra/storage/triangular_matrix.hpp"
 #include "algebra/storage/vector.hpp"
 #include "algebra/type_traits.hpp"
 
@@ -51,6 +55,26 @@ using vector_type = algebra::storage::vector<N, Vc::Vector<T>, storage_type>;
 template <concepts::value T, size_type ROWS, size_type COLS>
 using matrix_type =
     algebra::storage::matrix<storage_type, Vc::Vector<T>, ROWS, COLS>;
+/// Diagonal matrix type that only stores the diagonal elements
+template <concepts::value T, size_type N>
+using diagonal_matrix =
+    algebra::storage::diagonal_matrix<matrix_type<T, N, N>>;
+/// Projection matrix type that only stores the indices of the selected
+/// elements
+template <concepts::value T, size_type M, size_type N>
+using projection_matrix =
+    algebra::storage::projection_matrix<matrix_type<T, M, N>>;
+/// Triangular matrix types that only store the elements of the triangle
+template <concepts::value T, size_type N>
+using lower_triangular =
+    algebra::storage::lower_triangular<matrix_type<T, N, N>>;
+template <concepts::value T, size_type N>
+using upper_triangular =
+    algebra::storage::upper_triangular<matrix_type<T, N, N>>;
+/// Block diagonal matrix type with square blocks of the ranks @tparam N
+template <concepts::value T, size_type... N>
+using block_diagonal_matrix =
+    algebra::storage::block_diagonal_matrix<matrix_type<T, N, N>...>;
 
 /// 2-element "vector" type, using @c Vc::Vector in every element
 template <concepts::value T>
@@ -7,6 +7,8 @@
 
 // Project include(s).
 #include "algebra/array_cmath.hpp"
+#include "algebra/math/kernels/fits.hpp"
+#include "algebra/math/kernels/track_parameters.hpp"
 
 // Test include(s).
 #include "test_host_basics.hpp"
@@ -15,7 +17,14 @@
 #include <gtest/gtest.h>
 
 // System include(s).
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <concepts>
+#include <limits>
+#include <numbers>
 #include <string>
+#include <type_traits>
 
 /// Struct providing a readable name for the test
 struct test_specialisation_name {
@@ -37,7 +46,7 @@ REGISTER_TYPED_TEST_SUITE_P(test_host_basics_vector, local_vectors, vector3,
                             getter);
 TEST_HOST_BASICS_MATRIX_TESTS();
 REGISTER_TYPED_TEST_SUITE_P(test_host_basics_transform, transform3,
-                            global_transformations);
+                            global_transformations, alignment);
 
 // Instantiate the test(s).
 typedef testing::Types<
@@ -58,3 +67,820 @@ INSTANTIATE_TYPED_TEST_SUITE_P(algebra_plugins, test_host_basics_matrix,
                                array_generic_types, test_specialisation_name);
 INSTANTIATE_TYPED_TEST_SUITE_P(algebra_plugins, test_host_basics_transform,
                                array_generic_types, test_specialisation_name);
+
+// Check the fast precision mode against the exact results
+TEST(test_array_cmath, precision) {
+
+  constexpr algebra::precision::fast fast{};
+  constexpr algebra::precision::exact exact{};
+
+  const algebra::array::vector3<float> v_f{1.f, 2.f, 3.f};
+  const algebra::array::vector3<double> v_d{1., 2., 3.};
+
+  // Near single precision accuracy in the fast mode
+  constexpr float tol_f{1e-6f};
+  EXPECT_NEAR(algebra::vector::norm(v_f, fast), algebra::vector::norm(v_f),
+              tol_f * algebra::vector::norm(v_f));
+  EXPECT_NEAR(algebra::vector::eta(v_f, fast), algebra::vector::eta(v_f),
+              tol_f);
+  const auto n_f = algebra::vector::normalize(v_f, fast);
+  EXPECT_NEAR(algebra::vector::norm(n_f), 1.f, tol_f);
+
+  const auto n_d = algebra::vector::normalize(v_d, fast);
+  EXPECT_NEAR(algebra::vector::norm(n_d), 1., 1e-6);
+
+  // Exact mode is the default
+  EXPECT_EQ(algebra::vector::norm(v_f, exact), algebra::vector::norm(v_f));
+  EXPECT_EQ(algebra::vector::eta(v_d, exact), algebra::vector::eta(v_d));
+  EXPECT_EQ(algebra::vector::normalize(v_d, exact),
+            algebra::vector::normalize(v_d));
+
+  // Zero length vectors have zero norm
+  EXPECT_EQ(algebra::vector::norm(algebra::array::vector3<float>{}, fast), 0.f);
+}
+
+// Check the polynomial approximations against the libm results
+TEST(test_array_cmath, vec_math) {
+
+  namespace vec = algebra::math::vec;
+
+  constexpr float tol_f{2e-6f};
+  constexpr double tol_d{1e-14};
+
+  for (int i = -100; i <= 100; ++i) {
+    const float x_f{0.0099f * static_cast<float>(i)};
+    const double x_d{0.0099 * static_cast<double>(i)};
+
+    EXPECT_NEAR(vec::atanh(x_f), std::atanh(x_f), tol_f);
+    EXPECT_NEAR(vec::atanh(x_d), std::atanh(x_d), tol_d);
+    EXPECT_NEAR(vec::acos(x_f), std::acos(x_f), tol_f);
+    EXPECT_NEAR(vec::acos(x_d), std::acos(x_d), tol_d);
+    EXPECT_NEAR(vec::atan2(x_f, 0.5f - x_f), std::atan2(x_f, 0.5f - x_f),
+                tol_f);
+    EXPECT_NEAR(vec::atan2(x_d, 0.5 - x_d), std::atan2(x_d, 0.5 - x_d),
+                tol_d);
+
+    // Scale to the ranges of exp, log and sincos
+    EXPECT_NEAR(vec::exp(50.f * x_f) / std::exp(50.f * x_f), 1.f, tol_f);
+    EXPECT_NEAR(vec::exp(500. * x_d) / std::exp(500. * x_d), 1., tol_d);
+    EXPECT_NEAR(vec::log(std::exp(50.f * x_f)), 50.f * x_f,
+                tol_f * std::max(1.f, std::abs(50.f * x_f)));
+    EXPECT_NEAR(vec::log(std::exp(500. * x_d)), 500. * x_d,
+                tol_d * std::max(1., std::abs(500. * x_d)));
+
+    const auto [sin_f, cos_f] = vec::sincos(1000.f * x_f);
+    EXPECT_NEAR(sin_f, std::sin(1000.f * x_f), tol_f);
+    EXPECT_NEAR(cos_f, std::cos(1000.f * x_f), tol_f);
+    const auto [sin_d, cos_d] = vec::sincos(1000. * x_d);
+    EXPECT_NEAR(sin_d, std::sin(1000. * x_d), tol_d);
+    EXPECT_NEAR(cos_d, std::cos(1000. * x_d), tol_d);
+  }
+
+  // Special values
+  constexpr double inf{std::numeric_limits<double>::infinity()};
+  EXPECT_EQ(vec::exp(1000.), inf);
+  EXPECT_EQ(vec::exp(-1000.), 0.);
+  EXPECT_EQ(vec::log(0.), -inf);
+  EXPECT_EQ(vec::log(inf), inf);
+  EXPECT_TRUE(std::isnan(vec::log(-1.)));
+  EXPECT_EQ(vec::atanh(1.), inf);
+  EXPECT_EQ(vec::atanh(-1.), -inf);
+  EXPECT_EQ(vec::acos(1.), 0.);
+  EXPECT_DOUBLE_EQ(vec::atan2(0., -1.), std::numbers::pi);
+
+  // Rounding beyond the range of the 32 bit integers
+  using ops_f = vec::simd_ops<float>;
+  using ops_d = vec::simd_ops<double>;
+  EXPECT_EQ(ops_f::round(3.5e9f), 3.5e9f);
+  EXPECT_EQ(ops_f::floor(-3.5e9f), -3.5e9f);
+  EXPECT_EQ(ops_d::round(-5e9 - 0.5), -5e9 - 1.);
+  EXPECT_EQ(ops_d::floor(-5e9 - 0.5), -5e9 - 1.);
+  EXPECT_EQ(ops_d::floor(1e300), 1e300);
+  EXPECT_EQ(ops_d::floor(-inf), -inf);
+  EXPECT_TRUE(std::isnan(ops_d::round(std::nan(""))));
+
+  // Large arguments of sincos: accurate up to the end of the valid range,
+  // NaN beyond it
+  const auto [sin_f_max, cos_f_max] = vec::sincos(1.3e5f);
+  EXPECT_NEAR(sin_f_max, std::sin(1.3e5), tol_f);
+  EXPECT_NEAR(cos_f_max, std::cos(1.3e5), tol_f);
+  const auto [sin_d_max, cos_d_max] = vec::sincos(2e9);
+  EXPECT_NEAR(sin_d_max, std::sin(2e9), tol_d);
+  EXPECT_NEAR(cos_d_max, std::cos(2e9), tol_d);
+  EXPECT_TRUE(std::isnan(vec::sin(3.4e9f)));
+  EXPECT_TRUE(std::isnan(vec::cos(1e10)));
+  EXPECT_TRUE(std::isnan(vec::sin(inf)));
+
+  // Opt into the approximations through the precision policy
+  constexpr algebra::precision::fast fast{};
+  const algebra::array::vector3<float> v{1.f, 2.f, 3.f};
+  EXPECT_NEAR(algebra::vector::phi(v, fast), algebra::vector::phi(v), tol_f);
+  EXPECT_NEAR(algebra::vector::theta(v, fast), algebra::vector::theta(v),
+              tol_f);
+  EXPECT_NEAR(algebra::vector::eta(v, fast), algebra::vector::eta(v), tol_f);
+}
+
+// Check the bound <-> free track parameter conversion kernels
+TEST(test_array_cmath, track_parameters) {
+
+  using namespace algebra::kernels;
+
+  using vector3 = algebra::array::vector3<double>;
+  using transform3 = algebra::array::transform3<double>;
+  using bound_vector = algebra::array::matrix_type<double, e_bound_size, 1>;
+  using bound_to_free_jacobian =
+      algebra::array::matrix_type<double, e_free_size, e_bound_size>;
+  using free_to_bound_jacobian =
+      algebra::array::matrix_type<double, e_bound_size, e_free_size>;
+
+  constexpr double tol{1e-12};
+
+  const vector3 z = algebra::vector::normalize(vector3{3., 2., 1.});
+  const vector3 x = algebra::vector::normalize(vector3{2., -3., 0.});
+  const transform3 trf(vector3{2., 3., 4.}, z, x);
+
+  bound_vector bound_vec;
+  algebra::getter::element(bound_vec, e_bound_loc0, 0) = 1.5;
+  algebra::getter::element(bound_vec, e_bound_loc1, 0) = -0.5;
+  algebra::getter::element(bound_vec, e_bound_phi, 0) = 2.;
+  algebra::getter::element(bound_vec, e_bound_theta, 0) = 0.7;
+  algebra::getter::element(bound_vec, e_bound_qoverp, 0) = -0.1;
+  algebra::getter::element(bound_vec, e_bound_time, 0) = 10.;
+
+  bound_to_free_jacobian b2f_jac;
+  const auto free_vec = bound_to_free(trf, bound_vec, b2f_jac);
+
+  // The position is on the surface
+  const vector3 pos{algebra::getter::element(free_vec, e_free_pos0, 0),
+                    algebra::getter::element(free_vec, e_free_pos1, 0),
+                    algebra::getter::element(free_vec, e_free_pos2, 0)};
+  EXPECT_NEAR(trf.point_to_local(pos)[2], 0., tol);
+
+  const vector3 dir{algebra::getter::element(free_vec, e_free_dir0, 0),
+                    algebra::getter::element(free_vec, e_free_dir1, 0),
+                    algebra::getter::element(free_vec, e_free_dir2, 0)};
+  EXPECT_NEAR(algebra::vector::norm(dir), 1., tol);
+  EXPECT_NEAR(algebra::vector::phi(dir), 2., tol);
+  EXPECT_NEAR(algebra::vector::theta(dir), 0.7, tol);
+
+  // Round trip
+  free_to_bound_jacobian f2b_jac;
+  const auto bound_vec_r = free_to_bound(trf, free_vec, f2b_jac);
+
+  for (unsigned int i = 0u; i < e_bound_size; ++i) {
+    EXPECT_NEAR(algebra::getter::element(bound_vec_r, i, 0),
+                algebra::getter::element(bound_vec, i, 0), tol);
+  }
+
+  // The jacobians are inverse to each other
+  const auto id = f2b_jac * b2f_jac;
+  for (unsigned int i = 0u; i < e_bound_size; ++i) {
+    for (unsigned int j = 0u; j < e_bound_size; ++j) {
+      EXPECT_NEAR(algebra::getter::element(id, i, j), i == j ? 1. : 0., tol);
+    }
+  }
+
+  // Compare the bound to free jacobian with finite differences
+  constexpr double h{1e-6};
+  bound_to_free_jacobian tmp_jac;
+  for (unsigned int j = 0u; j < e_bound_size; ++j) {
+    bound_vector bound_up{bound_vec};
+    bound_vector bound_down{bound_vec};
+    algebra::getter::element(bound_up, j, 0) += h;
+    algebra::getter::element(bound_down, j, 0) -= h;
+
+    const auto free_up = bound_to_free(trf, bound_up, tmp_jac);
+    const auto free_down = bound_to_free(trf, bound_down, tmp_jac);
+
+    for (unsigned int i = 0u; i < e_free_size; ++i) {
+      const double diff{(algebra::getter::element(free_up, i, 0) -
+                         algebra::getter::element(free_down, i, 0)) /
+                        (2. * h)};
+      EXPECT_NEAR(algebra::getter::element(b2f_jac, i, j), diff, 1e-8);
+    }
+  }
+}
+
+// Check the straight line and circle fit kernels
+TEST(test_array_cmath, fits) {
+
+  using namespace algebra::kernels;
+
+  using point2 = algebra::array::point2<double>;
+  using point3 = algebra::array::point3<double>;
+  using line_covariance =
+      algebra::array::matrix_type<double, e_line_size, e_line_size>;
+  using circle_covariance =
+      algebra::array::matrix_type<double, e_circle_size, e_circle_size>;
+
+  constexpr double tol{1e-10};
+
+  // Hits on a straight line, with alternating residuals
+  constexpr double res{0.01};
+  std::array<point3, 4> line_hits;
+  for (unsigned int i = 0u; i < line_hits.size(); ++i) {
+    const double z{10. * static_cast<double>(i) - 5.};
+    const double sign{(i % 2u == 0u) ? 1. : -1.};
+    line_hits[i] = {1. + 0.5 * z + sign * res, -2. - 0.1 * z, z};
+  }
+
+  line_covariance line_cov;
+  double chi2{0.};
+  const auto line_vec = line_fit(line_hits, line_cov, chi2);
+
+  // The alternating residuals in x tilt the line by -0.0004 around the
+  // centroid at z = 10
+  EXPECT_NEAR(algebra::getter::element(line_vec, e_line_y0, 0), -2., tol);
+  EXPECT_NEAR(algebra::getter::element(line_vec, e_line_ty, 0), -0.1, tol);
+  EXPECT_NEAR(algebra::getter::element(line_vec, e_line_tx, 0), 0.4996, tol);
+  EXPECT_NEAR(algebra::getter::element(line_vec, e_line_x0, 0), 1.004, tol);
+  EXPECT_NEAR(chi2, 4. * res * res * 0.8, tol);
+
+  // Covariance for unit hit uncertainties: var(tx) = 1 / sum (z - <z>)^2
+  EXPECT_NEAR(algebra::getter::element(line_cov, e_line_tx, e_line_tx),
+              1. / 500., tol);
+  EXPECT_NEAR(algebra::getter::element(line_cov, e_line_ty, e_line_ty),
+              1. / 500., tol);
+  EXPECT_NEAR(algebra::getter::element(line_cov, e_line_x0, e_line_tx),
+              -10. / 500., tol);
+  EXPECT_NEAR(algebra::getter::element(line_cov, e_line_x0, e_line_y0), 0.,
+              tol);
+
+  // Hits on a circle around (30, -40) with radius 100, bending
+  // counterclockwise
+  constexpr double r{100.};
+  std::array<point2, 5> circle_hits;
+  for (unsigned int i = 0u; i < circle_hits.size(); ++i) {
+    const double alpha{0.5 + 0.15 * static_cast<double>(i)};
+    circle_hits[i] = {30. + r * std::cos(alpha), -40. + r * std::sin(alpha)};
+  }
+
+  circle_covariance circle_cov;
+  auto circle_vec = circle_fit(circle_hits, circle_cov, chi2);
+
+  const double rho{algebra::getter::element(circle_vec, e_circle_rho, 0)};
+  const double phi{algebra::getter::element(circle_vec, e_circle_phi, 0)};
+  const double d0{algebra::getter::element(circle_vec, e_circle_d0, 0)};
+
+  EXPECT_NEAR(rho, -1. / r, tol);
+  EXPECT_NEAR(std::abs(d0), r - 50., 1e-8);
+  EXPECT_NEAR(std::sin(phi) * (1. / rho + d0), 30., 1e-8);
+  EXPECT_NEAR(-std::cos(phi) * (1. / rho + d0), -40., 1e-8);
+  EXPECT_NEAR(chi2, 0., tol);
+
+  // The direction points along the hits
+  const double dx{circle_hits[4][0] - circle_hits[0][0]};
+  const double dy{circle_hits[4][1] - circle_hits[0][1]};
+  EXPECT_GT(std::cos(phi) * dx + std::sin(phi) * dy, 0.);
+
+  // Same circle in the opposite direction
+  std::ranges::reverse(circle_hits);
+  circle_vec = circle_fit(circle_hits, circle_cov, chi2);
+
+  EXPECT_NEAR(algebra::getter::element(circle_vec, e_circle_rho, 0), -rho,
+              tol);
+  EXPECT_NEAR(algebra::getter::element(circle_vec, e_circle_d0, 0), -d0,
+              1e-8);
+  EXPECT_NEAR(std::abs(algebra::getter::element(circle_vec, e_circle_phi, 0) -
+                       phi),
+              std::numbers::pi, tol);
+
+  // The covariance is symmetric and positive definite
+  for (unsigned int i = 0u; i < e_circle_size; ++i) {
+    EXPECT_GT(algebra::getter::element(circle_cov, i, i), 0.);
+    for (unsigned int j = 0u; j < i; ++j) {
+      EXPECT_DOUBLE_EQ(algebra::getter::element(circle_cov, i, j),
+                       algebra::getter::element(circle_cov, j, i));
+    }
+  }
+
+  // Straight line (zero curvature) through (1, 5) with direction (1, 2)
+  std::array<point2, 3> straight_hits{point2{1., 5.}, point2{2., 7.},
+                                      point2{3., 9.}};
+  circle_vec = circle_fit(straight_hits, circle_cov, chi2);
+
+  EXPECT_NEAR(algebra::getter::element(circle_vec, e_circle_rho, 0), 0., tol);
+  EXPECT_NEAR(algebra::getter::element(circle_vec, e_circle_phi, 0),
+              std::atan2(2., 1.), tol);
+  EXPECT_NEAR(algebra::getter::element(circle_vec, e_circle_d0, 0),
+              -3. / std::sqrt(5.), tol);
+
+  // Hits on a circle around the origin: No point of closest approach
+  std::array<point2, 3> centered_hits;
+  for (unsigned int i = 0u; i < centered_hits.size(); ++i) {
+    const double angle{0.3 + 1.2 * static_cast<double>(i)};
+    centered_hits[i] = {2. * std::cos(angle), 2. * std::sin(angle)};
+  }
+  circle_vec = circle_fit(centered_hits, circle_cov, chi2);
+
+  EXPECT_TRUE(std::isinf(chi2));
+  EXPECT_EQ(algebra::getter::element(circle_vec, e_circle_rho, 0), 0.);
+  EXPECT_TRUE(std::isfinite(algebra::getter::element(circle_vec, e_circle_phi,
+                                                     0)));
+  EXPECT_TRUE(
+      std::isfinite(algebra::getter::element(circle_vec, e_circle_d0, 0)));
+
+  // Hits in a plane of constant z: No slopes
+  std::array<point3, 3> flat_hits{point3{1., 2., 3.}, point3{2., 1., 3.},
+                                  point3{4., 4., 3.}};
+  const auto flat_vec = line_fit(flat_hits, line_cov, chi2);
+
+  EXPECT_TRUE(std::isinf(chi2));
+  EXPECT_EQ(algebra::getter::element(flat_vec, e_line_tx, 0), 0.);
+  EXPECT_EQ(algebra::getter::element(flat_vec, e_line_ty, 0), 0.);
+  EXPECT_NEAR(algebra::getter::element(flat_vec, e_line_x0, 0), 7. / 3., tol);
+  EXPECT_NEAR(algebra::getter::element(flat_vec, e_line_y0, 0), 7. / 3., tol);
+  EXPECT_TRUE(
+      std::isinf(algebra::getter::element(line_cov, e_line_tx, e_line_tx)));
+}
+
+// Check the algorithm policies of the matrix determinant and inverse
+template <std::size_t N>
+void test_matrix_policies() {
+
+  namespace policy = algebra::generic::matrix::policy;
+
+  using matrix_t = algebra::array::matrix_type<double, N, N>;
+
+  // Closed form expressions up to rank 4, pivoting beyond
+  using default_policy_t =
+      std::conditional_t<(N <= 4u), policy::hard_coded,
+                         policy::partial_pivot_lud>;
+  static_assert(
+      std::same_as<algebra::generic::determinant_t<matrix_t>,
+                   algebra::generic::determinant_t<matrix_t,
+                                                   default_policy_t>>);
+  static_assert(
+      std::same_as<algebra::generic::inversion_t<matrix_t>,
+                   algebra::generic::inversion_t<matrix_t,
+                                                 default_policy_t>>);
+  static_assert(!policy::algorithm_policy<double>);
+
+  // Diagonally dominant matrix
+  matrix_t m;
+  for (std::size_t j = 0u; j < N; ++j) {
+    for (std::size_t i = 0u; i < N; ++i) {
+      algebra::getter::element(m, i, j) =
+          0.1 * static_cast<double>(i + 1) - 0.2 * static_cast<double>(j);
+    }
+    algebra::getter::element(m, j, j) = static_cast<double>(N);
+  }
+
+  const double det_lud{
+      algebra::matrix::determinant(m, policy::partial_pivot_lud{})};
+  EXPECT_NEAR(algebra::matrix::determinant(m), det_lud,
+              1e-12 * std::abs(det_lud));
+  EXPECT_NEAR(algebra::matrix::determinant(m, policy::cofactor{}), det_lud,
+              1e-12 * std::abs(det_lud));
+
+  EXPECT_NEAR(algebra::matrix::determinant(m, policy::hard_coded{}), det_lud,
+              1e-12 * std::abs(det_lud));
+
+  const matrix_t inv = algebra::matrix::inverse(m);
+  const matrix_t inv_lud =
+      algebra::matrix::inverse(m, policy::partial_pivot_lud{});
+  const matrix_t inv_hc = algebra::matrix::inverse(m, policy::hard_coded{});
+  for (std::size_t j = 0u; j < N; ++j) {
+    for (std::size_t i = 0u; i < N; ++i) {
+      EXPECT_NEAR(algebra::getter::element(inv, i, j),
+                  algebra::getter::element(inv_lud, i, j), 1e-14);
+      EXPECT_NEAR(algebra::getter::element(inv_hc, i, j),
+                  algebra::getter::element(inv_lud, i, j), 1e-14);
+    }
+  }
+
+  // Cyclic permutation matrix: Nonsingular, but with a vanishing leading
+  // pivot, which the default algorithm has to handle
+  matrix_t p;
+  for (std::size_t j = 0u; j < N; ++j) {
+    for (std::size_t i = 0u; i < N; ++i) {
+      algebra::getter::element(p, i, j) = (i == (j + 1u) % N) ? 1. : 0.;
+    }
+  }
+  ASSERT_DOUBLE_EQ(algebra::getter::element(p, 0, 0), 0.);
+
+  // The sign of a cyclic permutation of N elements is (-1)^(N-1)
+  const double det_p{(N % 2u == 1u) ? 1. : -1.};
+  EXPECT_DOUBLE_EQ(algebra::matrix::determinant(p), det_p);
+
+  // The inverse is the transpose
+  const matrix_t inv_p = algebra::matrix::inverse(p);
+  for (std::size_t j = 0u; j < N; ++j) {
+    for (std::size_t i = 0u; i < N; ++i) {
+      EXPECT_DOUBLE_EQ(algebra::getter::element(inv_p, i, j),
+                       algebra::getter::element(p, j, i));
+    }
+  }
+}
+
+TEST(test_array_cmath, matrix_policies) {
+  test_matrix_policies<3>();
+  test_matrix_policies<4>();
+  test_matrix_policies<5>();
+  test_matrix_policies<6>();
+}
+
+// Check the matrix and vector views on an external buffer
+TEST(test_array_cmath, matrix_view) {
+
+  namespace policy = algebra::generic::matrix::policy;
+
+  using matrix44_t = algebra::array::matrix_type<double, 4, 4>;
+  using view44_t = algebra::array::matrix_view<double, 4, 4>;
+  using row_major_view44_t = algebra::array::matrix_view<double, 4, 4, 4, 1>;
+  using dynamic_view44_t =
+      algebra::storage::matrix_view<matrix44_t,
+                                    algebra::storage::dynamic_stride,
+                                    algebra::storage::dynamic_stride>;
+
+  static_assert(algebra::concepts::square_matrix<view44_t>);
+  static_assert(algebra::concepts::square_matrix<dynamic_view44_t>);
+  static_assert(
+      std::same_as<algebra::traits::matrix_t<view44_t>, matrix44_t>);
+  static_assert(sizeof(view44_t) == sizeof(double *));
+
+  // Column major matrix, followed by a matrix with padded columns
+  std::array<double, 16u + 20u> buffer{};
+
+  view44_t m{buffer.data()};
+  for (std::size_t j = 0u; j < 4u; ++j) {
+    for (std::size_t i = 0u; i < 4u; ++i) {
+      algebra::getter::element(m, i, j) =
+          0.1 * static_cast<double>(i + 1) - 0.2 * static_cast<double>(j);
+    }
+    algebra::getter::element(m, j, j) = 4.;
+  }
+  ASSERT_DOUBLE_EQ(buffer[1u + 4u * 2u], 0.2 - 0.4);
+
+  // The row major view of the same buffer is the transpose
+  const row_major_view44_t m_t{buffer.data()};
+  const matrix44_t m_transp = algebra::matrix::transpose(m);
+  for (std::size_t j = 0u; j < 4u; ++j) {
+    for (std::size_t i = 0u; i < 4u; ++i) {
+      ASSERT_DOUBLE_EQ(algebra::getter::element(m_t, i, j),
+                       algebra::getter::element(m, j, i));
+      ASSERT_DOUBLE_EQ(algebra::getter::element(m_transp, i, j),
+                       algebra::getter::element(m_t, i, j));
+    }
+  }
+
+  // Copy into the padded matrix and write through a block view
+  dynamic_view44_t p{buffer.data() + 16u, 1u, 5u};
+  p = m;
+  auto b = algebra::getter::block<2, 2>(p, 1u, 2u);
+  algebra::getter::element(b, 1u, 0u) = 42.;
+  ASSERT_DOUBLE_EQ(buffer[16u + 2u + 5u * 2u], 42.);
+  b = algebra::getter::block<2, 2>(m, 1u, 2u);
+  ASSERT_DOUBLE_EQ(buffer[16u + 2u + 5u * 2u], buffer[2u + 4u * 2u]);
+
+  using block_getter_t = algebra::traits::block_getter_t<dynamic_view44_t>;
+  const auto v = block_getter_t{}.vector<3>(p, 1u, 3u);
+  for (std::size_t i = 0u; i < 3u; ++i) {
+    ASSERT_DOUBLE_EQ(v[i], algebra::getter::element(m, i + 1u, 3u));
+  }
+
+  // Multiply and invert on the buffer, read-only input views
+  const matrix44_t m_copy = m;
+  const algebra::storage::matrix_view<const matrix44_t> m_in{buffer.data()};
+  algebra::matrix::set_product(p, m_in, m_t);
+  p = algebra::matrix::inverse(m_in);
+
+  const matrix44_t inv = algebra::matrix::inverse(m_copy);
+  for (std::size_t j = 0u; j < 4u; ++j) {
+    for (std::size_t i = 0u; i < 4u; ++i) {
+      ASSERT_NEAR(algebra::getter::element(p, i, j),
+                  algebra::getter::element(inv, i, j), 1e-14);
+    }
+  }
+
+  const double det{algebra::matrix::determinant(m_copy)};
+  EXPECT_NEAR(algebra::matrix::determinant(m_in, policy::partial_pivot_lud{}),
+              det, 1e-12 * std::abs(det));
+  EXPECT_NEAR(algebra::matrix::determinant(p), 1. / det,
+              1e-12 / std::abs(det));
+
+  // The input buffer is unchanged
+  for (std::size_t j = 0u; j < 4u; ++j) {
+    for (std::size_t i = 0u; i < 4u; ++i) {
+      ASSERT_DOUBLE_EQ(buffer[i + 4u * j],
+                       algebra::getter::element(m_copy, i, j));
+    }
+  }
+}
+
+// Check the access to matrices and vectors as types of another plugin
+TEST(test_array_cmath, reinterpret_as) {
+
+  using matrix_t = algebra::array::matrix_type<double, 3, 4>;
+
+  static_assert(algebra::traits::is_column_major<matrix_t>);
+  static_assert(algebra::traits::is_layout_compatible<matrix_t, matrix_t>);
+  static_assert(!algebra::traits::is_layout_compatible<
+                matrix_t, algebra::array::matrix_type<float, 3, 4>>);
+  static_assert(!algebra::traits::is_layout_compatible<
+                matrix_t, algebra::array::matrix_type<double, 4, 3>>);
+
+  matrix_t m;
+  for (std::size_t j = 0u; j < 4u; ++j) {
+    for (std::size_t i = 0u; i < 3u; ++i) {
+      algebra::getter::element(m, i, j) = static_cast<double>(i + 3u * j);
+    }
+  }
+
+  // Same type: No copy
+  auto &m_ref = algebra::reinterpret_as<algebra::plugin::array<double>>(m);
+  static_assert(std::same_as<decltype(m_ref), matrix_t &>);
+  ASSERT_EQ(&m_ref, &m);
+
+  const matrix_t &m_const = m;
+  const auto &m_const_ref =
+      algebra::reinterpret_as<algebra::plugin::array<double>>(m_const);
+  ASSERT_EQ(&m_const_ref, &m);
+
+  // Different value type: Copy
+  const auto m_f = algebra::reinterpret_as<algebra::plugin::array<float>>(m);
+  static_assert(std::same_as<std::remove_cvref_t<decltype(m_f)>,
+                             algebra::array::matrix_type<float, 3, 4>>);
+  for (std::size_t j = 0u; j < 4u; ++j) {
+    for (std::size_t i = 0u; i < 3u; ++i) {
+      ASSERT_FLOAT_EQ(algebra::getter::element(m_f, i, j),
+                      static_cast<float>(i + 3u * j));
+    }
+  }
+
+  algebra::array::vector3<double> v{1., 2., 3.};
+  const auto v_f = algebra::reinterpret_as<algebra::plugin::array<float>>(v);
+  static_assert(std::same_as<std::remove_cvref_t<decltype(v_f)>,
+                             algebra::array::vector3<float>>);
+  ASSERT_FLOAT_EQ(v_f[2], 3.f);
+}
+
+// Check the lazy transposes and blocks
+TEST(test_array_cmath, lazy_views) {
+
+  using matrix44_t = algebra::array::matrix_type<double, 4, 4>;
+  using matrix43_t = algebra::array::matrix_type<double, 4, 3>;
+  using matrix34_t = algebra::array::matrix_type<double, 3, 4>;
+
+  matrix44_t a;
+  matrix43_t b;
+  for (std::size_t j = 0u; j < 4u; ++j) {
+    for (std::size_t i = 0u; i < 4u; ++i) {
+      algebra::getter::element(a, i, j) = static_cast<double>(i + 4u * j);
+      if (j < 3u) {
+        algebra::getter::element(b, i, j) = 0.5 * static_cast<double>(i * j);
+      }
+    }
+  }
+
+  const auto b_t = algebra::matrix::lazy_transpose(b);
+  static_assert(std::same_as<
+                algebra::traits::matrix_t<std::remove_cvref_t<decltype(b_t)>>,
+                matrix34_t>);
+
+  // Products with lazy transposes use the transposed loop order
+  matrix34_t c;
+  matrix34_t c_ref;
+  algebra::matrix::set_product(c, b_t, a);
+  algebra::matrix::set_product_left_transpose(c_ref, b, a);
+  EXPECT_EQ(c, c_ref);
+
+  matrix43_t d;
+  matrix43_t d_ref;
+  algebra::matrix::set_product(d, a, algebra::matrix::lazy_transpose(c));
+  algebra::matrix::set_product_right_transpose(d_ref, a, c);
+  EXPECT_EQ(d, d_ref);
+
+  matrix44_t e = a;
+  algebra::matrix::set_inplace_product_right(
+      e, algebra::matrix::lazy_transpose(a));
+  EXPECT_EQ(e, a * algebra::matrix::transpose(a));
+  EXPECT_EQ(e, a * algebra::matrix::lazy_transpose(a));
+
+  // Products with lazy blocks
+  const algebra::array::vector3<double> v{1., 2., 3.};
+  const auto a_block = algebra::getter::lazy_block<3, 3>(a, 1u, 0u);
+  const auto w = a_block * v;
+  const auto w_ref = algebra::getter::block<3, 3>(a, 1u, 0u) * v;
+  static_assert(std::same_as<std::remove_cvref_t<decltype(w)>,
+                             std::remove_cvref_t<decltype(w_ref)>>);
+  EXPECT_EQ(w, w_ref);
+
+  // Write through the views
+  e = a;
+  auto e_block = algebra::getter::lazy_block<3, 4>(e, 1u, 0u);
+  e_block = c;
+  for (std::size_t j = 0u; j < 4u; ++j) {
+    EXPECT_DOUBLE_EQ(algebra::getter::element(e, 0u, j),
+                     algebra::getter::element(a, 0u, j));
+    for (std::size_t i = 0u; i < 3u; ++i) {
+      EXPECT_DOUBLE_EQ(algebra::getter::element(e, i + 1u, j),
+                       algebra::getter::element(c, i, j));
+    }
+  }
+
+  algebra::getter::set_block(e, b_t, 0u, 0u);
+  EXPECT_EQ((algebra::getter::block<3, 4>(e, 0u, 0u)),
+            algebra::matrix::transpose(b));
+
+  algebra::getter::element(algebra::getter::lazy_block<2, 2>(e_block, 1u, 1u),
+                           1u, 0u) = 42.;
+  EXPECT_DOUBLE_EQ(algebra::getter::element(e, 3u, 1u), 42.);
+}
+
+// Check the symmetric eigen decomposition of R * diag(@param lambda) * R^T,
+// with R a product of rotations by multiples of @param phi
+template <typename scalar_t, std::size_t N>
+void test_symmetric_eigen(const std::array<scalar_t, N> &lambda,
+                          const scalar_t phi) {
+
+  using matrix_t = algebra::array::matrix_type<scalar_t, N, N>;
+
+  matrix_t r = algebra::matrix::identity<matrix_t>();
+  for (std::size_t p = 0u; p < N - 1u; ++p) {
+    for (std::size_t q = p + 1u; q < N; ++q) {
+      const scalar_t angle{static_cast<scalar_t>(p + q) * phi};
+      matrix_t g = algebra::matrix::identity<matrix_t>();
+      algebra::getter::element(g, p, p) = std::cos(angle);
+      algebra::getter::element(g, q, q) = std::cos(angle);
+      algebra::getter::element(g, p, q) = -std::sin(angle);
+      algebra::getter::element(g, q, p) = std::sin(angle);
+      r = r * g;
+    }
+  }
+
+  matrix_t d = algebra::matrix::zero<matrix_t>();
+  scalar_t norm{0.f};
+  for (std::size_t i = 0u; i < N; ++i) {
+    algebra::getter::element(d, i, i) = lambda[i];
+    norm = std::max(norm, std::abs(lambda[i]));
+  }
+  const matrix_t m = r * d * algebra::matrix::transpose(r);
+
+  const auto [values, vectors] = algebra::matrix::symmetric_eigen(m);
+
+  const scalar_t tol{64.f * std::numeric_limits<scalar_t>::epsilon()};
+
+  std::array<scalar_t, N> expected = lambda;
+  std::ranges::sort(expected);
+  for (std::size_t i = 0u; i < N; ++i) {
+    EXPECT_TRUE(algebra::approx_equal(values[i], expected[i], tol, tol * norm))
+        << values[i] << " != " << expected[i];
+  }
+
+  // V^T * V = I and V * diag(lambda) * V^T = A
+  EXPECT_TRUE(algebra::approx_equal(
+      algebra::matrix::transpose(vectors) * vectors,
+      algebra::matrix::identity<matrix_t>(), tol, tol));
+
+  for (std::size_t i = 0u; i < N; ++i) {
+    algebra::getter::element(d, i, i) = values[i];
+  }
+  EXPECT_TRUE(algebra::approx_equal(
+      vectors * d * algebra::matrix::transpose(vectors), m, tol, tol * norm));
+}
+
+TEST(test_array_cmath, symmetric_eigen) {
+
+  // The general case is part of the typed host tests. Badly conditioned,
+  // already diagonal and degenerate matrices:
+  test_symmetric_eigen<double, 3>({1e-3, 4., 250.}, -1.1);
+  test_symmetric_eigen<double, 3>({3., 1., 2.}, 0.);
+  test_symmetric_eigen<double, 2>({2., 2.}, 0.7);
+  test_symmetric_eigen<double, 3>({2., 2., 7.}, 0.9);
+  test_symmetric_eigen<float, 3>({1.f, 1.f, 1.f}, 0.2f);
+
+  // The rotations do not depend on the scale of the matrix
+  test_symmetric_eigen<float, 3>({5e19f, -1e19f, 2e19f}, 0.4f);
+  test_symmetric_eigen<float, 3>({5e-19f, -1e-19f, 2e-19f}, 0.4f);
+  test_symmetric_eigen<double, 3>({5e150, -1e150, 2e150}, 0.4);
+  test_symmetric_eigen<double, 3>({5e-150, -1e-150, 2e-150}, 0.4);
+}
+
+// Check the singular value decomposition of a well conditioned 6 X 4 matrix,
+// with all elements multiplied by @param scale
+template <typename scalar_t>
+void test_jacobi_svd_scale(const scalar_t scale) {
+
+  using matrix64_t = algebra::array::matrix_type<scalar_t, 6, 4>;
+  using matrix44_t = algebra::array::matrix_type<scalar_t, 4, 4>;
+  using svd_t = algebra::generic::matrix::decomposition::jacobi_svd<
+      matrix64_t, algebra::traits::element_getter_t<matrix64_t>>;
+
+  matrix64_t a;
+  matrix64_t a_scaled;
+  for (std::size_t j = 0u; j < 4u; ++j) {
+    for (std::size_t i = 0u; i < 6u; ++i) {
+      algebra::getter::element(a, i, j) =
+          (i == j ? scalar_t(2) : scalar_t(0)) +
+          scalar_t(1) / static_cast<scalar_t>(i + j + 1u);
+      algebra::getter::element(a_scaled, i, j) =
+          scale * algebra::getter::element(a, i, j);
+    }
+  }
+
+  const typename svd_t::svd d = svd_t{}(a);
+  const typename svd_t::svd d_scaled = svd_t{}(a_scaled);
+
+  const scalar_t tol{64.f * std::numeric_limits<scalar_t>::epsilon()};
+
+  // The singular values scale with the matrix, the condition number does not
+  // depend on the scale
+  matrix44_t s = algebra::matrix::zero<matrix44_t>();
+  for (std::size_t i = 0u; i < 4u; ++i) {
+    EXPECT_TRUE(algebra::approx_equal(d_scaled.sigma[i], scale * d.sigma[i],
+                                      tol, tol * scale * d.sigma[0]))
+        << d_scaled.sigma[i] << " != " << scale * d.sigma[i];
+    algebra::getter::element(s, i, i) = d_scaled.sigma[i];
+  }
+  EXPECT_TRUE(algebra::approx_equal(algebra::matrix::condition_number(a_scaled),
+                                    algebra::matrix::condition_number(a), tol,
+                                    tol));
+
+  // A = U * diag(sigma) * V^T and V^T * V = I
+  EXPECT_TRUE(algebra::approx_equal(
+      d_scaled.u * s * algebra::matrix::transpose(d_scaled.v), a_scaled, tol,
+      tol * scale * d.sigma[0]));
+  EXPECT_TRUE(
+      algebra::approx_equal(algebra::matrix::transpose(d_scaled.v) * d_scaled.v,
+                            algebra::matrix::identity<matrix44_t>(), tol, tol));
+
+  // The pseudo-inverse is a left inverse
+  const matrix44_t pinv_a =
+      algebra::matrix::pseudo_inverse(a_scaled) * a_scaled;
+  EXPECT_TRUE(algebra::approx_equal(
+      pinv_a, algebra::matrix::identity<matrix44_t>(), tol, tol));
+}
+
+// Check the singular value decomposition and the pseudo-inverse of a rank
+// deficient matrix
+TEST(test_array_cmath, jacobi_svd) {
+
+  using matrix64_t = algebra::array::matrix_type<double, 6, 4>;
+  using matrix46_t = algebra::array::matrix_type<double, 4, 6>;
+  using matrix44_t = algebra::array::matrix_type<double, 4, 4>;
+  using matrix66_t = algebra::array::matrix_type<double, 6, 6>;
+  using svd_t = algebra::generic::matrix::decomposition::jacobi_svd<
+      matrix64_t, algebra::traits::element_getter_t<matrix64_t>>;
+
+  const auto expect_near = [](const auto &a, const auto &b) {
+    using matrix_t = std::decay_t<decltype(a)>;
+    for (std::size_t j = 0u; j < algebra::traits::columns<matrix_t>; ++j) {
+      for (std::size_t i = 0u; i < algebra::traits::rows<matrix_t>; ++i) {
+        EXPECT_NEAR(algebra::getter::element(a, i, j),
+                    algebra::getter::element(b, i, j), 1e-12);
+      }
+    }
+  };
+
+  // Jacobian of rank 3: The last column is a combination of the first two
+  matrix64_t a;
+  for (std::size_t i = 0u; i < 6u; ++i) {
+    const double x{static_cast<double>(i)};
+    algebra::getter::element(a, i, 0) = 1. + 0.1 * x;
+    algebra::getter::element(a, i, 1) = 2. - 0.3 * x * x;
+    algebra::getter::element(a, i, 2) = std::sin(x);
+    algebra::getter::element(a, i, 3) = 2. * algebra::getter::element(a, i, 0) -
+                                        0.5 * algebra::getter::element(a, i, 1);
+  }
+
+  const svd_t::svd d = svd_t{}(a);
+
+  // Decreasing singular values, with one of them vanishing
+  for (std::size_t i = 0u; i < 3u; ++i) {
+    EXPECT_GE(d.sigma[i], d.sigma[i + 1u]);
+  }
+  EXPECT_GT(d.sigma[2], 0.1);
+  EXPECT_NEAR(d.sigma[3], 0., 1e-13);
+
+  // A = U * diag(sigma) * V^T and V^T * V = I
+  matrix44_t s = algebra::matrix::zero<matrix44_t>();
+  for (std::size_t i = 0u; i < 4u; ++i) {
+    algebra::getter::element(s, i, i) = d.sigma[i];
+  }
+  expect_near(d.u * s * algebra::matrix::transpose(d.v), a);
+  expect_near(algebra::matrix::transpose(d.v) * d.v,
+              algebra::matrix::identity<matrix44_t>());
+
+  // Moore-Penrose conditions
+  const matrix46_t a_pinv = algebra::matrix::pseudo_inverse(a);
+  const matrix66_t a_a_pinv = a * a_pinv;
+  const matrix44_t a_pinv_a = a_pinv * a;
+  expect_near(a_a_pinv * a, a);
+  expect_near(a_pinv_a * a_pinv, a_pinv);
+  expect_near(algebra::matrix::transpose(a_a_pinv), a_a_pinv);
+  expect_near(algebra::matrix::transpose(a_pinv_a), a_pinv_a);
+
+  EXPECT_GT(algebra::matrix::condition_number(a), 1e12);
+
+  // Wide matrices are decomposed through their transpose
+  const matrix46_t a_t = algebra::matrix::transpose(a);
+  expect_near(algebra::matrix::pseudo_inverse(a_t),
+              algebra::matrix::transpose(a_pinv));
+
+  // The rotations do not depend on the scale of the matrix
+  test_jacobi_svd_scale<float>(1e9f);
+  test_jacobi_svd_scale<float>(1e-10f);
+  test_jacobi_svd_scale<double>(1e80);
+  test_jacobi_svd_scale<double>(1e-80);
+}
@@ -0,0 +1,79 @@
+/** Algebra plugins library, part of the ACTS project
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "algebra/array_instrumented.hpp"
+
+// GoogleTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <cmath>
+
+using plugin_t = algebra::plugin::array_instrumented<double>;
+using scalar_t = algebra::get_scalar_t<plugin_t>;
+using vector3_t = algebra::get_vector3D_t<plugin_t>;
+template <std::size_t ROWS, std::size_t COLS>
+using matrix_t = algebra::get_matrix_t<plugin_t, ROWS, COLS>;
+
+static_assert(algebra::concepts::scalar<scalar_t>);
+static_assert(algebra::concepts::algebra<plugin_t>);
+
+// Check that every arithmetic operation is counted
+TEST(test_array_instrumented, scalar) {
+
+  algebra::reset_instrumented_counters();
+
+  scalar_t a{2.};
+  scalar_t b = 3;
+
+  scalar_t c = a + b - 1.;
+  c *= a;
+  c = c / b;
+  c = algebra::math::fma(a, b, c);
+  c = algebra::math::sqrt(c);
+  ASSERT_TRUE(a < b);
+  ASSERT_TRUE(algebra::math::max(a, b) == b);
+
+  const algebra::op_counts& counts = algebra::instrumented_counters();
+  EXPECT_EQ(counts.add, 2u);
+  EXPECT_EQ(counts.mul, 1u);
+  EXPECT_EQ(counts.div, 1u);
+  EXPECT_EQ(counts.fma, 1u);
+  EXPECT_EQ(counts.sqrt, 1u);
+  EXPECT_EQ(counts.compare, 3u);
+  EXPECT_EQ(counts.flops(), 7u);
+  EXPECT_DOUBLE_EQ(c.value(), std::sqrt(6. + 8. / 3.));
+
+  algebra::reset_instrumented_counters();
+  EXPECT_EQ(algebra::instrumented_counters().flops(), 0u);
+}
+
+// Check the operation count of some of the plugin functions
+TEST(test_array_instrumented, plugin) {
+
+  const vector3_t v{1., 2., 3.};
+
+  algebra::reset_instrumented_counters();
+  const scalar_t d = algebra::vector::dot(v, v);
+  EXPECT_EQ(algebra::instrumented_counters().mul, 3u);
+  EXPECT_EQ(algebra::instrumented_counters().add, 3u);
+  EXPECT_DOUBLE_EQ(d.value(), 14.);
+
+  matrix_t<2, 2> m;
+  algebra::getter::element(m, 0, 0) = 4.;
+  algebra::getter::element(m, 0, 1) = 2.;
+  algebra::getter::element(m, 1, 0) = 1.;
+  algebra::getter::element(m, 1, 1) = 3.;
+
+  // 2x2 matrices use the hard coded determinant
+  algebra::reset_instrumented_counters();
+  const scalar_t det = algebra::matrix::determinant(m);
+  EXPECT_EQ(algebra::instrumented_counters().mul, 2u);
+  EXPECT_EQ(algebra::instrumented_counters().add, 1u);
+  EXPECT_DOUBLE_EQ(det.value(), 10.);
+}
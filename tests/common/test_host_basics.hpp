@@ -19,10 +19,13 @@
 #include <gtest/gtest.h>
 
 // System include(s).
+#include <algorithm>
 #include <array>
 #include <cmath>
+#include <concepts>
 #include <cstddef>
 #include <limits>
+#include <type_traits>
 
 using namespace algebra;
 
@@ -266,6 +269,126 @@ class test_host_basics_matrix : public testing::Test, public test_base<T> {
 
     this->template test_matrix_ops_any_matrix<A, N, N>();
   }
+
+  /// Check the Cholesky decomposition of a N X N matrix and its rank-1 updates
+  template <typename A, std::size_t N>
+  void test_cholesky() {
+
+    using scalar_t = typename A::scalar;
+    using matrix_t = typename A::template matrix<N, N>;
+    using vector_t = algebra::traits::vector_t<matrix_t>;
+    using element_getter_t = algebra::traits::element_getter_t<matrix_t>;
+    using vector_getter_t = algebra::traits::element_getter_t<vector_t>;
+
+    namespace decomposition = algebra::generic::matrix::decomposition;
+
+    // Symmetric positive definite matrix
+    matrix_t m;
+    vector_t v;
+    for (std::size_t j = 0u; j < N; ++j) {
+      for (std::size_t i = 0u; i < N; ++i) {
+        algebra::getter::element(m, i, j) =
+            static_cast<scalar_t>(0.1 * static_cast<double>(i + j + 1) -
+                                  0.05 * static_cast<double>(i * j));
+      }
+      algebra::getter::element(m, j, j) = static_cast<scalar_t>(N);
+      vector_getter_t{}(v, j) =
+          static_cast<scalar_t>(0.5 - 0.3 * static_cast<double>(j));
+    }
+
+    const matrix_t L =
+        decomposition::cholesky<matrix_t, element_getter_t>{}(m);
+    for (std::size_t j = 1u; j < N; ++j) {
+      for (std::size_t i = 0u; i < j; ++i) {
+        ASSERT_EQ(algebra::getter::element(L, i, j), scalar_t(0));
+      }
+    }
+    const matrix_t llt = L * algebra::matrix::transpose(L);
+    expect_matrix_near(llt, m);
+
+    // m + v * v^T
+    matrix_t m_up = m;
+    for (std::size_t j = 0u; j < N; ++j) {
+      for (std::size_t i = 0u; i < N; ++i) {
+        algebra::getter::element(m_up, i, j) +=
+            vector_getter_t{}(v, i) * vector_getter_t{}(v, j);
+      }
+    }
+
+    matrix_t L_up = L;
+    decomposition::cholesky_update<matrix_t, element_getter_t>{}(L_up, v);
+    expect_matrix_near(
+        L_up, decomposition::cholesky<matrix_t, element_getter_t>{}(m_up));
+
+    // Downdate back to m
+    decomposition::cholesky_downdate<matrix_t, element_getter_t>{}(L_up, v);
+    expect_matrix_near(L_up, L);
+  }
+
+  /// Check the symmetric eigen decomposition of R * diag(@param lambda) * R^T,
+  /// with R a product of rotations by multiples of @param phi
+  template <typename A, std::size_t N>
+  void test_symmetric_eigen(const std::array<typename A::scalar, N> &lambda,
+                            const typename A::scalar phi) {
+
+    using scalar_t = typename A::scalar;
+    using matrix_t = typename A::template matrix<N, N>;
+
+    matrix_t r = algebra::matrix::identity<matrix_t>();
+    for (std::size_t p = 0u; p < N - 1u; ++p) {
+      for (std::size_t q = p + 1u; q < N; ++q) {
+        const scalar_t angle{static_cast<scalar_t>(p + q) * phi};
+        matrix_t g = algebra::matrix::identity<matrix_t>();
+        algebra::getter::element(g, p, p) = std::cos(angle);
+        algebra::getter::element(g, q, q) = std::cos(angle);
+        algebra::getter::element(g, p, q) = -std::sin(angle);
+        algebra::getter::element(g, q, p) = std::sin(angle);
+        r = r * g;
+      }
+    }
+
+    matrix_t d = algebra::matrix::zero<matrix_t>();
+    for (std::size_t i = 0u; i < N; ++i) {
+      algebra::getter::element(d, i, i) = lambda[i];
+    }
+    const matrix_t m = r * d * algebra::matrix::transpose(r);
+
+    const auto [values, vectors] = algebra::matrix::symmetric_eigen(m);
+    using vector_getter_t =
+        algebra::traits::element_getter_t<std::decay_t<decltype(values)>>;
+
+    std::array<scalar_t, N> expected = lambda;
+    std::ranges::sort(expected);
+    for (std::size_t i = 0u; i < N; ++i) {
+      ASSERT_NEAR(vector_getter_t{}(values, i), expected[i],
+                  this->m_isclose * (scalar_t(1) + std::abs(expected[i])));
+    }
+
+    // V^T * V = I and V * diag(lambda) * V^T = A
+    const matrix_t vtv = algebra::matrix::transpose(vectors) * vectors;
+    expect_matrix_near(vtv, algebra::matrix::identity<matrix_t>());
+
+    for (std::size_t i = 0u; i < N; ++i) {
+      algebra::getter::element(d, i, i) = vector_getter_t{}(values, i);
+    }
+    const matrix_t vdvt = vectors * d * algebra::matrix::transpose(vectors);
+    expect_matrix_near(vdvt, m);
+  }
+
+  /// Compare the dense matrices @param m and @param m_ref element by element,
+  /// relative to the size of the reference elements
+  template <typename M, typename M_REF>
+  void expect_matrix_near(const M &m, const M_REF &m_ref) const {
+    using scalar_t = algebra::traits::scalar_t<M_REF>;
+
+    for (std::size_t j = 0; j < algebra::traits::columns<M_REF>; ++j) {
+      for (std::size_t i = 0; i < algebra::traits::rows<M_REF>; ++i) {
+        const scalar_t ref{algebra::getter::element(m_ref, i, j)};
+        EXPECT_NEAR(algebra::getter::element(m, i, j), ref,
+                    this->m_isclose * (scalar_t(1) + std::abs(ref)));
+      }
+    }
+  }
 };
 TYPED_TEST_SUITE_P(test_host_basics_matrix);
 
@@ -837,6 +960,49 @@ TYPED_TEST_P(test_host_basics_matrix, matrix_3x3) {
   this->template test_matrix_ops_square_matrix<TypeParam, N>();
 }
 
+TYPED_TEST_P(test_host_basics_matrix, matrix_4x4) {
+  static constexpr typename TypeParam::size_type N = 4;
+
+  // Test 4 X 4 matrix with a determinant that is different from one
+  typename TypeParam::template matrix<4, 4> m44;
+  algebra::getter::element(m44, 0, 0) = 2.f;
+  algebra::getter::element(m44, 0, 1) = 1.f;
+  algebra::getter::element(m44, 0, 2) = 0.f;
+  algebra::getter::element(m44, 0, 3) = 1.f;
+  algebra::getter::element(m44, 1, 0) = 0.f;
+  algebra::getter::element(m44, 1, 1) = 3.f;
+  algebra::getter::element(m44, 1, 2) = 1.f;
+  algebra::getter::element(m44, 1, 3) = 0.f;
+  algebra::getter::element(m44, 2, 0) = 1.f;
+  algebra::getter::element(m44, 2, 1) = 0.f;
+  algebra::getter::element(m44, 2, 2) = 4.f;
+  algebra::getter::element(m44, 2, 3) = 2.f;
+  algebra::getter::element(m44, 3, 0) = 0.f;
+  algebra::getter::element(m44, 3, 1) = 2.f;
+  algebra::getter::element(m44, 3, 2) = 0.f;
+  algebra::getter::element(m44, 3, 3) = 5.f;
+
+  // Test 4 X 4 matrix determinant
+  auto m44_det = algebra::matrix::determinant(m44);
+  ASSERT_NEAR(m44_det, 131.f, this->m_isclose);
+
+  // Test 4 X 4 matrix inverse (adjugate matrix / determinant)
+  constexpr float adj[4][4] = {{64.f, -12.f, 3.f, -14.f},
+                               {5.f, 40.f, -10.f, 3.f},
+                               {-15.f, 11.f, 30.f, -9.f},
+                               {-2.f, -16.f, 4.f, 25.f}};
+
+  auto m44_inv = algebra::matrix::inverse(m44);
+  for (typename TypeParam::size_type i = 0; i < N; ++i) {
+    for (typename TypeParam::size_type j = 0; j < N; ++j) {
+      ASSERT_NEAR(algebra::getter::element(m44_inv, i, j), adj[i][j] / 131.f,
+                  this->m_isclose);
+    }
+  }
+
+  this->template test_matrix_ops_square_matrix<TypeParam, N>();
+}
+
 TYPED_TEST_P(test_host_basics_matrix, matrix_2x2) {
   static constexpr typename TypeParam::size_type N = 2;
 
@@ -1314,6 +1480,576 @@ TYPED_TEST_P(test_host_basics_matrix, matrix_small_mixed) {
   ASSERT_NEAR(algebra::getter::element(m22, 1, 1), -7.9f, this->m_isclose);
 }
 
+// This defines the diagonal matrix test
+TYPED_TEST_P(test_host_basics_matrix, diagonal_matrix) {
+
+  using scalar_t = typename TypeParam::scalar;
+  using matrix44_t = typename TypeParam::template matrix<4, 4>;
+  using matrix43_t = typename TypeParam::template matrix<4, 3>;
+  using matrix41_t = typename TypeParam::template matrix<4, 1>;
+  using matrix24_t = typename TypeParam::template matrix<2, 4>;
+  using matrix22_t = typename TypeParam::template matrix<2, 2>;
+  using diagonal4_t = algebra::storage::diagonal_matrix<matrix44_t>;
+  using diagonal2_t = algebra::storage::diagonal_matrix<matrix22_t>;
+
+  static_assert(algebra::concepts::square_matrix<diagonal4_t>);
+  static_assert(
+      std::same_as<algebra::traits::matrix_t<diagonal4_t>, matrix44_t>);
+
+  const diagonal4_t d{typename diagonal4_t::array_type{1.f, 2.f, 4.f, 8.f}};
+  const matrix44_t d_dense = d;
+
+  matrix44_t a;
+  matrix43_t b;
+  matrix41_t v;
+  matrix24_t h;
+  for (std::size_t j = 0u; j < 4u; ++j) {
+    for (std::size_t i = 0u; i < 4u; ++i) {
+      algebra::getter::element(a, i, j) = static_cast<scalar_t>(i + 4u * j);
+      if (j < 3u) {
+        algebra::getter::element(b, i, j) =
+            static_cast<scalar_t>(0.5 * static_cast<double>(i * j));
+      }
+      if (i < 2u) {
+        algebra::getter::element(h, i, j) =
+            static_cast<scalar_t>((i == j) ? 1 : 0);
+      }
+    }
+    algebra::getter::element(v, j, 0) = static_cast<scalar_t>(1);
+  }
+
+  for (std::size_t j = 0u; j < 4u; ++j) {
+    for (std::size_t i = 0u; i < 4u; ++i) {
+      ASSERT_EQ(d(i, j), algebra::getter::element(d_dense, i, j));
+      ASSERT_EQ(d(i, j), (i == j) ? d[i] : scalar_t(0));
+    }
+  }
+
+  // Determinant, inverse and transpose
+  ASSERT_NEAR(algebra::matrix::determinant(d), 64.f, this->m_isclose);
+
+  const diagonal4_t d_inv = algebra::matrix::inverse(d);
+  for (std::size_t i = 0u; i < 4u; ++i) {
+    ASSERT_NEAR(d_inv[i], scalar_t(1) / d[i], this->m_epsilon);
+  }
+  ASSERT_EQ(algebra::matrix::transpose(d).diagonal(), d.diagonal());
+
+  // Products with dense matrices
+  const matrix43_t db_ref = d_dense * b;
+  const matrix44_t ad_ref = a * d_dense;
+  const matrix44_t da_ref = d_dense * a;
+  const matrix41_t dv_ref = d_dense * v;
+
+  matrix43_t db;
+  algebra::matrix::set_product(db, d, b);
+  this->expect_matrix_near(db, db_ref);
+  this->expect_matrix_near(static_cast<matrix43_t>(d * b), db_ref);
+  this->expect_matrix_near(static_cast<matrix41_t>(d * v), dv_ref);
+
+  matrix44_t ad;
+  algebra::matrix::set_product(ad, a, d);
+  this->expect_matrix_near(ad, ad_ref);
+  this->expect_matrix_near(static_cast<matrix44_t>(a * d), ad_ref);
+
+  ad = a;
+  algebra::matrix::set_inplace_product_right(ad, d);
+  this->expect_matrix_near(ad, ad_ref);
+
+  matrix44_t da = a;
+  algebra::matrix::set_inplace_product_left(da, d);
+  this->expect_matrix_near(da, da_ref);
+
+  const diagonal4_t d2 = d * d;
+  const diagonal4_t d_scaled = scalar_t(2) * d;
+  for (std::size_t i = 0u; i < 4u; ++i) {
+    ASSERT_NEAR(d2[i], d[i] * d[i], this->m_epsilon);
+    ASSERT_NEAR(d_scaled[i], 2.f * d[i], this->m_epsilon);
+  }
+
+  // Sums and differences with dense matrices
+  const matrix44_t a_plus_d = a + d_dense;
+  const matrix44_t a_minus_d = a - d_dense;
+  const matrix44_t d_minus_a = d_dense - a;
+  this->expect_matrix_near(static_cast<matrix44_t>(a + d), a_plus_d);
+  this->expect_matrix_near(static_cast<matrix44_t>(d + a), a_plus_d);
+  this->expect_matrix_near(static_cast<matrix44_t>(a - d), a_minus_d);
+  this->expect_matrix_near(static_cast<matrix44_t>(d - a), d_minus_a);
+
+  // Projected covariance with measurement noise: H C H^T + V
+  const diagonal2_t noise{typename diagonal2_t::array_type{0.1f, 0.2f}};
+  const matrix22_t noise_dense = noise;
+  const matrix22_t hch = h * d_dense * algebra::matrix::transpose(h);
+  const matrix22_t r_ref = hch + noise_dense;
+  this->expect_matrix_near(static_cast<matrix22_t>(hch + noise), r_ref);
+}
+
+// This defines the projection matrix test
+TYPED_TEST_P(test_host_basics_matrix, projection_matrix) {
+
+  using scalar_t = typename TypeParam::scalar;
+  using matrix25_t = typename TypeParam::template matrix<2, 5>;
+  using matrix52_t = typename TypeParam::template matrix<5, 2>;
+  using matrix55_t = typename TypeParam::template matrix<5, 5>;
+  using matrix51_t = typename TypeParam::template matrix<5, 1>;
+  using matrix35_t = typename TypeParam::template matrix<3, 5>;
+  using matrix32_t = typename TypeParam::template matrix<3, 2>;
+  using matrix22_t = typename TypeParam::template matrix<2, 2>;
+  using matrix21_t = typename TypeParam::template matrix<2, 1>;
+  using projection_t = algebra::storage::projection_matrix<matrix25_t>;
+
+  static_assert(algebra::concepts::matrix<projection_t>);
+  static_assert(algebra::traits::rows<projection_t> == 2u);
+  static_assert(algebra::traits::columns<projection_t> == 5u);
+
+  // Compile-time indices
+  constexpr projection_t h{1, 3};
+  static_assert(h.index(0) == 1u && h.index(1) == 3u);
+
+  const auto h_t = algebra::matrix::transpose(h);
+  using transposed_t = std::remove_const_t<decltype(h_t)>;
+  static_assert(transposed_t::rows() == 5u);
+  static_assert(transposed_t::columns() == 2u);
+
+  const matrix25_t h_dense = h;
+  const matrix52_t h_t_dense = h_t;
+  const matrix52_t h_dense_t = algebra::matrix::transpose(h_dense);
+  this->expect_matrix_near(h_t_dense, h_dense_t);
+  ASSERT_EQ(h(0, 1), scalar_t(1));
+  ASSERT_EQ(h(1, 1), scalar_t(0));
+
+  matrix55_t c;
+  matrix35_t a;
+  matrix32_t b;
+  matrix51_t v;
+  for (std::size_t j = 0u; j < 5u; ++j) {
+    for (std::size_t i = 0u; i < 5u; ++i) {
+      algebra::getter::element(c, i, j) = static_cast<scalar_t>(i + 5u * j);
+      if (i < 3u) {
+        algebra::getter::element(a, i, j) =
+            static_cast<scalar_t>(0.5 * static_cast<double>(i * j));
+      }
+      if (i < 3u && j < 2u) {
+        algebra::getter::element(b, i, j) = static_cast<scalar_t>(i + j + 1u);
+      }
+    }
+    algebra::getter::element(v, j, 0) = static_cast<scalar_t>(j + 1u);
+  }
+
+  // Gathers
+  const matrix25_t hc_ref = h_dense * c;
+  const matrix52_t ch_t_ref = c * h_t_dense;
+  const matrix22_t hch_t_ref = h_dense * c * h_t_dense;
+  const matrix32_t ah_t_ref = a * h_t_dense;
+  this->expect_matrix_near(static_cast<matrix25_t>(h * c), hc_ref);
+  this->expect_matrix_near(static_cast<matrix52_t>(c * h_t), ch_t_ref);
+  this->expect_matrix_near(static_cast<matrix22_t>(h * c * h_t), hch_t_ref);
+  this->expect_matrix_near(static_cast<matrix32_t>(a * h_t), ah_t_ref);
+
+  const matrix22_t projected = h * c * h_t;
+  ASSERT_EQ(algebra::getter::element(projected, 0, 1),
+            algebra::getter::element(c, 1, 3));
+
+  const matrix21_t hv = h * v;
+  ASSERT_EQ(algebra::getter::element(hv, 0, 0), scalar_t(2));
+  ASSERT_EQ(algebra::getter::element(hv, 1, 0), scalar_t(4));
+
+  // Scatters
+  matrix21_t r;
+  algebra::getter::element(r, 0, 0) = static_cast<scalar_t>(0.5);
+  algebra::getter::element(r, 1, 0) = static_cast<scalar_t>(-1);
+  const matrix51_t h_t_r = h_t * r;
+  for (std::size_t i = 0u; i < 5u; ++i) {
+    const scalar_t ref{(i == 1u) ? scalar_t(0.5)
+                                 : ((i == 3u) ? scalar_t(-1) : scalar_t(0))};
+    ASSERT_EQ(algebra::getter::element(h_t_r, i, 0), ref);
+  }
+  const matrix35_t bh_ref = b * h_dense;
+  this->expect_matrix_near(static_cast<matrix35_t>(b * h), bh_ref);
+
+  // Run-time indices
+  const projection_t g{typename projection_t::index_array{4, 0}};
+  const matrix25_t g_dense = g;
+
+  matrix35_t d;
+  algebra::matrix::set_product(d, b, g);
+  const matrix35_t bg_ref = b * g_dense;
+  this->expect_matrix_near(d, bg_ref);
+
+  matrix25_t e;
+  algebra::matrix::set_product(e, g, c);
+  const matrix25_t gc_ref = g_dense * c;
+  this->expect_matrix_near(e, gc_ref);
+}
+
+// This defines the triangular matrix test
+TYPED_TEST_P(test_host_basics_matrix, triangular_matrix) {
+
+  using scalar_t = typename TypeParam::scalar;
+  using matrix44_t = typename TypeParam::template matrix<4, 4>;
+  using matrix43_t = typename TypeParam::template matrix<4, 3>;
+  using matrix34_t = typename TypeParam::template matrix<3, 4>;
+  using matrix41_t = typename TypeParam::template matrix<4, 1>;
+  using lower_t = algebra::storage::lower_triangular<matrix44_t>;
+  using upper_t = algebra::storage::upper_triangular<matrix44_t>;
+
+  static_assert(algebra::concepts::square_matrix<lower_t>);
+  static_assert(sizeof(lower_t) == 10u * sizeof(scalar_t));
+
+  matrix44_t m;
+  matrix43_t b;
+  matrix34_t a;
+  matrix41_t v;
+  for (std::size_t j = 0u; j < 4u; ++j) {
+    for (std::size_t i = 0u; i < 4u; ++i) {
+      algebra::getter::element(m, i, j) = static_cast<scalar_t>(
+          (i == j) ? 2. + static_cast<double>(i)
+                   : 0.1 * static_cast<double>(i + 3u * j + 1u));
+      if (j < 3u) {
+        algebra::getter::element(b, i, j) =
+            static_cast<scalar_t>(static_cast<double>(i + j) - 2.);
+      }
+      if (i < 3u) {
+        algebra::getter::element(a, i, j) =
+            static_cast<scalar_t>(0.5 * static_cast<double>(i * j));
+      }
+    }
+  }
+  algebra::getter::element(v, 0, 0) = static_cast<scalar_t>(1);
+  algebra::getter::element(v, 1, 0) = static_cast<scalar_t>(-2);
+  algebra::getter::element(v, 2, 0) = static_cast<scalar_t>(3);
+  algebra::getter::element(v, 3, 0) = static_cast<scalar_t>(0.5);
+
+  const lower_t l{m};
+  const upper_t u{m};
+  const matrix44_t l_dense = l;
+  const matrix44_t u_dense = u;
+
+  for (std::size_t j = 0u; j < 4u; ++j) {
+    for (std::size_t i = 0u; i < 4u; ++i) {
+      ASSERT_EQ(l(i, j), i >= j ? algebra::getter::element(m, i, j)
+                                : scalar_t(0));
+      ASSERT_EQ(u(i, j), i <= j ? algebra::getter::element(m, i, j)
+                                : scalar_t(0));
+      ASSERT_EQ(algebra::getter::element(l_dense, i, j), l(i, j));
+      ASSERT_EQ(algebra::getter::element(u_dense, i, j), u(i, j));
+    }
+  }
+
+  // Products
+  const matrix41_t lv_ref = l_dense * v;
+  const matrix41_t uv_ref = u_dense * v;
+  this->expect_matrix_near(static_cast<matrix41_t>(l * v), lv_ref);
+  this->expect_matrix_near(static_cast<matrix41_t>(u * v), uv_ref);
+
+  const matrix43_t ub_ref = u_dense * b;
+  const matrix43_t lb_ref = l_dense * b;
+  const matrix34_t al_ref = a * l_dense;
+  const matrix34_t au_ref = a * u_dense;
+  const matrix44_t ll_ref = l_dense * l_dense;
+  const matrix44_t uu_ref = u_dense * u_dense;
+  const matrix44_t lu_ref = l_dense * u_dense;
+  this->expect_matrix_near(
+      static_cast<matrix43_t>(algebra::matrix::trmm(u, b)), ub_ref);
+  this->expect_matrix_near(static_cast<matrix43_t>(l * b), lb_ref);
+  this->expect_matrix_near(static_cast<matrix34_t>(a * l), al_ref);
+  this->expect_matrix_near(static_cast<matrix34_t>(a * u), au_ref);
+  this->expect_matrix_near(static_cast<matrix44_t>(l * l), ll_ref);
+  this->expect_matrix_near(static_cast<matrix44_t>(u * u), uu_ref);
+  this->expect_matrix_near(static_cast<matrix44_t>(l * u), lu_ref);
+
+  // Solvers
+  const matrix41_t x_l = algebra::matrix::solve_lower(l, v);
+  const matrix41_t x_u = algebra::matrix::solve_upper(u, v);
+  const matrix43_t y_l = algebra::matrix::solve_lower(l, b);
+  this->expect_matrix_near(static_cast<matrix41_t>(l_dense * x_l), v);
+  this->expect_matrix_near(static_cast<matrix41_t>(u_dense * x_u), v);
+  this->expect_matrix_near(static_cast<matrix43_t>(l_dense * y_l), b);
+
+  // Determinant, inverse and transpose
+  ASSERT_NEAR(algebra::matrix::determinant(l), 120.f, this->m_isclose);
+  ASSERT_NEAR(algebra::matrix::determinant(u), 120.f, this->m_isclose);
+
+  const matrix44_t id = algebra::matrix::identity<matrix44_t>();
+  const matrix44_t l_inv = algebra::matrix::inverse(l);
+  const matrix44_t u_inv = algebra::matrix::inverse(u);
+  this->expect_matrix_near(static_cast<matrix44_t>(l_dense * l_inv), id);
+  this->expect_matrix_near(static_cast<matrix44_t>(u_dense * u_inv), id);
+
+  const upper_t l_t = algebra::matrix::transpose(l);
+  const matrix44_t l_t_dense = l_t;
+  const matrix44_t l_dense_t = algebra::matrix::transpose(l_dense);
+  this->expect_matrix_near(l_t_dense, l_dense_t);
+}
+
+// This defines the block diagonal matrix test
+TYPED_TEST_P(test_host_basics_matrix, block_diagonal_matrix) {
+
+  using scalar_t = typename TypeParam::scalar;
+  using matrix22_t = typename TypeParam::template matrix<2, 2>;
+  using matrix33_t = typename TypeParam::template matrix<3, 3>;
+  using matrix55_t = typename TypeParam::template matrix<5, 5>;
+  using matrix52_t = typename TypeParam::template matrix<5, 2>;
+  using matrix25_t = typename TypeParam::template matrix<2, 5>;
+  using matrix51_t = typename TypeParam::template matrix<5, 1>;
+  using block_diagonal_t =
+      algebra::storage::block_diagonal_matrix<matrix22_t, matrix33_t>;
+
+  static_assert(algebra::concepts::square_matrix<block_diagonal_t>);
+  static_assert(algebra::traits::rank<block_diagonal_t> == 5u);
+  static_assert(block_diagonal_t::template offset<1>() == 2u);
+
+  matrix22_t m2;
+  matrix33_t m3;
+  for (std::size_t j = 0u; j < 3u; ++j) {
+    for (std::size_t i = 0u; i < 3u; ++i) {
+      const scalar_t val{static_cast<scalar_t>(
+          (i == j) ? 3. + static_cast<double>(i)
+                   : 0.2 * static_cast<double>(i + 2u * j + 1u))};
+      algebra::getter::element(m3, i, j) = val;
+      if (i < 2u && j < 2u) {
+        algebra::getter::element(m2, i, j) = -val;
+      }
+    }
+  }
+
+  block_diagonal_t d{m2, m3};
+  const matrix55_t d_dense = d;
+
+  for (std::size_t j = 0u; j < 5u; ++j) {
+    for (std::size_t i = 0u; i < 5u; ++i) {
+      const bool in_block{(i < 2u && j < 2u) || (i >= 2u && j >= 2u)};
+      ASSERT_EQ(d(i, j), in_block ? algebra::getter::element(d_dense, i, j)
+                                  : scalar_t(0));
+    }
+  }
+
+  // Zero-copy access to the blocks
+  ASSERT_EQ(algebra::getter::element(d.template block<1>(), 1, 2),
+            algebra::getter::element(m3, 1, 2));
+  algebra::getter::element(d.template block<1>(), 1, 2) = scalar_t(7);
+  ASSERT_EQ(d(3, 4), scalar_t(7));
+  d = block_diagonal_t{m2, m3};
+
+  const auto blk =
+      algebra::traits::block_getter_t<block_diagonal_t>{}
+          .template operator()<2, 3>(d, 1, 2);
+  ASSERT_EQ(blk(0, 0), scalar_t(0));
+  ASSERT_EQ(blk(1, 1), algebra::getter::element(m3, 0, 1));
+
+  // Products
+  matrix52_t b;
+  matrix25_t a;
+  matrix51_t v;
+  for (std::size_t j = 0u; j < 5u; ++j) {
+    for (std::size_t i = 0u; i < 2u; ++i) {
+      algebra::getter::element(b, j, i) =
+          static_cast<scalar_t>(static_cast<double>(i + j) - 2.);
+      algebra::getter::element(a, i, j) =
+          static_cast<scalar_t>(0.5 * static_cast<double>(i * j + 1u));
+    }
+    algebra::getter::element(v, j, 0) =
+        static_cast<scalar_t>(1. - 0.5 * static_cast<double>(j));
+  }
+
+  const matrix51_t dv_ref = d_dense * v;
+  const matrix52_t db_ref = d_dense * b;
+  const matrix25_t ad_ref = a * d_dense;
+  const matrix55_t dd_ref = d_dense * d_dense;
+  const matrix55_t d_sum_ref = d_dense + d_dense;
+  const matrix55_t d_t_ref = algebra::matrix::transpose(d_dense);
+  this->expect_matrix_near(static_cast<matrix51_t>(d * v), dv_ref);
+  this->expect_matrix_near(static_cast<matrix52_t>(d * b), db_ref);
+  this->expect_matrix_near(static_cast<matrix25_t>(a * d), ad_ref);
+
+  const matrix55_t dd = d * d;
+  const matrix55_t d_sum = d + d;
+  const matrix55_t d_t = algebra::matrix::transpose(d);
+  this->expect_matrix_near(dd, dd_ref);
+  this->expect_matrix_near(d_sum, d_sum_ref);
+  this->expect_matrix_near(d_t, d_t_ref);
+
+  // Similarity transforms
+  const matrix22_t ada_ref = a * d_dense * algebra::matrix::transpose(a);
+  const matrix55_t ddd_ref = dd_ref * d_t_ref;
+  const matrix55_t ddd = algebra::matrix::similarity(d, d);
+  this->expect_matrix_near(
+      static_cast<matrix22_t>(algebra::matrix::similarity(a, d)), ada_ref);
+  this->expect_matrix_near(ddd, ddd_ref);
+
+  // Determinant and inverse, block by block
+  const scalar_t det_ref{algebra::matrix::determinant(d_dense)};
+  ASSERT_NEAR(algebra::matrix::determinant(d), det_ref,
+              this->m_isclose * std::abs(det_ref));
+
+  const matrix55_t d_inv = algebra::matrix::inverse(d);
+  const matrix55_t d_inv_ref = algebra::matrix::inverse(d_dense);
+  this->expect_matrix_near(d_inv, d_inv_ref);
+}
+
+// This defines the Cholesky decomposition test
+TYPED_TEST_P(test_host_basics_matrix, cholesky) {
+  this->template test_cholesky<TypeParam, 3>();
+  this->template test_cholesky<TypeParam, 5>();
+  this->template test_cholesky<TypeParam, 6>();
+  this->template test_cholesky<TypeParam, 8>();
+}
+
+// This defines the Householder QR decomposition and least squares test
+TYPED_TEST_P(test_host_basics_matrix, householder_qr) {
+
+  using scalar_t = typename TypeParam::scalar;
+  using matrix63_t = typename TypeParam::template matrix<6, 3>;
+  using matrix36_t = typename TypeParam::template matrix<3, 6>;
+  using matrix33_t = typename TypeParam::template matrix<3, 3>;
+  using vector6_t = algebra::traits::vector_t<matrix63_t>;
+  using vector3_t = algebra::traits::vector_t<matrix33_t>;
+  using vector6_getter_t = algebra::traits::element_getter_t<vector6_t>;
+  using vector3_getter_t = algebra::traits::element_getter_t<vector3_t>;
+  using qr_t = algebra::generic::matrix::decomposition::householder_qr<
+      matrix63_t, algebra::traits::element_getter_t<matrix63_t>>;
+
+  // Parabola fit y = a + b * x + c * x^2 through six points
+  matrix63_t a;
+  vector6_t b;
+  for (std::size_t i = 0u; i < 6u; ++i) {
+    const double x{static_cast<double>(i) - 2.5};
+    algebra::getter::element(a, i, 0) = static_cast<scalar_t>(1);
+    algebra::getter::element(a, i, 1) = static_cast<scalar_t>(x);
+    algebra::getter::element(a, i, 2) = static_cast<scalar_t>(x * x);
+    vector6_getter_t{}(b, i) = static_cast<scalar_t>(
+        0.5 - 2. * x + 0.1 * x * x + ((i % 2u == 0u) ? 0.01 : -0.01));
+  }
+
+  const typename qr_t::qrd d = qr_t{}(a);
+  const matrix63_t q = qr_t::thin_q(d);
+  const typename qr_t::r_matrix_type r = qr_t::r(d);
+
+  // A = Q * R and Q^T * Q = I
+  const matrix63_t qr = q * r;
+  const matrix33_t qtq = algebra::matrix::transpose(q) * q;
+  this->expect_matrix_near(qr, a);
+  this->expect_matrix_near(qtq, algebra::matrix::identity<matrix33_t>());
+
+  // The least squares solution solves the normal equations
+  const matrix36_t a_t = algebra::matrix::transpose(a);
+  const vector3_t x = algebra::matrix::least_squares(a, b);
+  const vector6_t ax = a * x;
+  const vector3_t atax = a_t * ax;
+  const vector3_t atb = a_t * b;
+  for (std::size_t i = 0u; i < 3u; ++i) {
+    const scalar_t ref{vector3_getter_t{}(atb, i)};
+    ASSERT_NEAR(vector3_getter_t{}(atax, i), ref,
+                this->m_isclose * (scalar_t(1) + std::abs(ref)));
+  }
+  ASSERT_NEAR(vector3_getter_t{}(x, 0), 0.5f, 0.02f);
+  ASSERT_NEAR(vector3_getter_t{}(x, 1), -2.f, 0.02f);
+  ASSERT_NEAR(vector3_getter_t{}(x, 2), 0.1f, 0.02f);
+
+  // Square systems are solved exactly
+  matrix33_t m;
+  vector3_t y;
+  for (std::size_t j = 0u; j < 3u; ++j) {
+    for (std::size_t i = 0u; i < 3u; ++i) {
+      algebra::getter::element(m, i, j) = static_cast<scalar_t>(
+          (i == j) ? 4. : 1. / static_cast<double>(i + 2u * j + 1u));
+    }
+    vector3_getter_t{}(y, j) =
+        static_cast<scalar_t>(1. - 1.5 * static_cast<double>(j));
+  }
+  const vector3_t my = m * y;
+  const vector3_t y_sol = algebra::matrix::least_squares(m, my);
+  for (std::size_t i = 0u; i < 3u; ++i) {
+    ASSERT_NEAR(vector3_getter_t{}(y_sol, i), vector3_getter_t{}(y, i),
+                this->m_isclose);
+  }
+}
+
+// This defines the symmetric eigen decomposition test
+TYPED_TEST_P(test_host_basics_matrix, symmetric_eigen) {
+
+  using scalar_t = typename TypeParam::scalar;
+
+  this->template test_symmetric_eigen<TypeParam, 2>({3.f, -1.f},
+                                                    scalar_t(0.3f));
+  this->template test_symmetric_eigen<TypeParam, 3>({5.f, -1.f, 2.f},
+                                                    scalar_t(0.4f));
+}
+
+// This defines the singular value decomposition and pseudo-inverse test
+TYPED_TEST_P(test_host_basics_matrix, jacobi_svd) {
+
+  using scalar_t = typename TypeParam::scalar;
+  using matrix64_t = typename TypeParam::template matrix<6, 4>;
+  using matrix46_t = typename TypeParam::template matrix<4, 6>;
+  using matrix44_t = typename TypeParam::template matrix<4, 4>;
+  using svd_t = algebra::generic::matrix::decomposition::jacobi_svd<
+      matrix64_t, algebra::traits::element_getter_t<matrix64_t>>;
+  using vector_getter_t = typename svd_t::vector_getter;
+
+  // Well conditioned 6 X 4 matrix
+  matrix64_t a;
+  for (std::size_t j = 0u; j < 4u; ++j) {
+    for (std::size_t i = 0u; i < 6u; ++i) {
+      algebra::getter::element(a, i, j) =
+          static_cast<scalar_t>((i == j ? 2. : 0.) +
+                                1. / static_cast<double>(i + j + 1u));
+    }
+  }
+
+  const typename svd_t::svd d = svd_t{}(a);
+
+  // Decreasing singular values, A = U * diag(sigma) * V^T and V^T * V = I
+  matrix44_t s = algebra::matrix::zero<matrix44_t>();
+  for (std::size_t i = 0u; i < 4u; ++i) {
+    if (i > 0u) {
+      ASSERT_GE(vector_getter_t{}(d.sigma, i - 1u),
+                vector_getter_t{}(d.sigma, i));
+    }
+    algebra::getter::element(s, i, i) = vector_getter_t{}(d.sigma, i);
+  }
+  const matrix64_t usvt = d.u * s * algebra::matrix::transpose(d.v);
+  const matrix44_t vtv = algebra::matrix::transpose(d.v) * d.v;
+  const matrix44_t id = algebra::matrix::identity<matrix44_t>();
+  this->expect_matrix_near(usvt, a);
+  this->expect_matrix_near(vtv, id);
+
+  const scalar_t cond{vector_getter_t{}(d.sigma, 0) /
+                      vector_getter_t{}(d.sigma, 3)};
+  ASSERT_NEAR(algebra::matrix::condition_number(a), cond,
+              this->m_isclose * cond);
+
+  // The pseudo-inverse is a left inverse, wide matrices are decomposed
+  // through their transpose
+  const matrix46_t a_pinv = algebra::matrix::pseudo_inverse(a);
+  const matrix44_t a_pinv_a = a_pinv * a;
+  this->expect_matrix_near(a_pinv_a, id);
+
+  const matrix46_t a_t = algebra::matrix::transpose(a);
+  const matrix64_t a_t_pinv = algebra::matrix::pseudo_inverse(a_t);
+  const matrix64_t a_pinv_t = algebra::matrix::transpose(a_pinv);
+  this->expect_matrix_near(a_t_pinv, a_pinv_t);
+
+  // The pseudo-inverse of a regular matrix is its inverse
+  matrix44_t m;
+  for (std::size_t j = 0u; j < 4u; ++j) {
+    for (std::size_t i = 0u; i < 4u; ++i) {
+      algebra::getter::element(m, i, j) = static_cast<scalar_t>(
+          (i == j) ? 4. : 1. / static_cast<double>(i + 2u * j + 1u));
+    }
+  }
+  const matrix44_t m_pinv = algebra::matrix::pseudo_inverse(m);
+  const matrix44_t m_inv = algebra::matrix::inverse(m);
+  this->expect_matrix_near(m_pinv, m_inv);
+
+  // Condition number of a diagonal matrix
+  matrix44_t c = algebra::matrix::zero<matrix44_t>();
+  algebra::getter::element(c, 0, 0) = static_cast<scalar_t>(2);
+  algebra::getter::element(c, 1, 1) = static_cast<scalar_t>(-8);
+  algebra::getter::element(c, 2, 2) = static_cast<scalar_t>(0.5);
+  algebra::getter::element(c, 3, 3) = static_cast<scalar_t>(1);
+  ASSERT_NEAR(algebra::matrix::condition_number(c), 16.f, this->m_isclose);
+}
+
 // clang-format off
 #define TEST_HOST_BASICS_MATRIX_TESTS(...) \
   REGISTER_TYPED_TEST_SUITE_P(test_host_basics_matrix \
@@ -1321,10 +2057,19 @@ TYPED_TEST_P(test_host_basics_matrix, matrix_small_mixed) {
     , matrix_2x3 \
     , matrix_3x1 \
     , matrix_3x3 \
+    , matrix_4x4 \
     , matrix_6x4 \
     , matrix_5x5 \
     , matrix_6x6 \
     , matrix_small_mixed \
+    , diagonal_matrix \
+    , projection_matrix \
+    , triangular_matrix \
+    , block_diagonal_matrix \
+    , cholesky \
+    , householder_qr \
+    , symmetric_eigen \
+    , jacobi_svd \
     )
 // clang-format on
 
@@ -1549,3 +2294,91 @@ TYPED_TEST_P(test_host_basics_transform, global_transformations) {
   ASSERT_NEAR(lvectorB[1], lvectorC[1], this->m_isclose);
   ASSERT_NEAR(lvectorB[2], lvectorC[2], this->m_isclose);
 }
+
+// This test the rotation construction and the alignment corrections
+TYPED_TEST_P(test_host_basics_transform, alignment) {
+
+  using scalar_t = typename TypeParam::scalar;
+  using vector3_t = typename TypeParam::vector3;
+  using point3_t = typename TypeParam::point3;
+  using transform3_t = typename TypeParam::transform3;
+
+  const scalar_t angle{0.7f};
+  const vector3_t n = algebra::vector::normalize(vector3_t{3.f, 2.f, 1.f});
+  const transform3_t rot = transform3_t::rotation_from_axis_angle(n, angle);
+
+  // Compare to Rodrigues' rotation formula
+  const vector3_t v = {1.f, -2.f, 0.5f};
+  const vector3_t v_rot =
+      std::cos(angle) * v + std::sin(angle) * algebra::vector::cross(n, v) +
+      ((1.f - std::cos(angle)) * algebra::vector::dot(n, v)) * n;
+  const vector3_t v_glob = rot.vector_to_global(v);
+  const vector3_t v_loc = rot.vector_to_local(v_glob);
+  for (unsigned int i = 0u; i < 3u; ++i) {
+    ASSERT_NEAR(v_glob[i], v_rot[i], this->m_isclose);
+    ASSERT_NEAR(v_loc[i], v[i], this->m_isclose);
+  }
+
+  // Euler angles: Equal to the rotations around the fixed axes, in order
+  const scalar_t alpha{0.3f};
+  const scalar_t beta{-0.4f};
+  const scalar_t gamma{1.2f};
+  const transform3_t euler =
+      transform3_t::rotation_from_euler(alpha, beta, gamma);
+
+  const vector3_t zero = {0.f, 0.f, 0.f};
+  transform3_t seq =
+      transform3_t::rotation_from_euler(alpha, scalar_t(0), scalar_t(0));
+  seq.apply_delta(zero, vector3_t{0.f, beta, 0.f});
+  seq.apply_delta(zero, vector3_t{0.f, 0.f, gamma});
+
+  for (unsigned int j = 0u; j < 4u; ++j) {
+    for (unsigned int i = 0u; i < 3u; ++i) {
+      ASSERT_NEAR(algebra::getter::element(euler.matrix(), i, j),
+                  algebra::getter::element(seq.matrix(), i, j),
+                  this->m_isclose);
+      ASSERT_NEAR(algebra::getter::element(euler.matrix_inverse(), i, j),
+                  algebra::getter::element(seq.matrix_inverse(), i, j),
+                  this->m_isclose);
+    }
+  }
+
+  // Small and large corrections to a transform: The incrementally updated
+  // inverse has to agree with the full inversion
+  const vector3_t z = algebra::vector::normalize(vector3_t{3.f, 2.f, 1.f});
+  const vector3_t x = algebra::vector::normalize(vector3_t{2.f, -3.f, 0.f});
+  const point3_t t = {2.f, 3.f, 4.f};
+  const vector3_t dt = {0.01f, -0.02f, 0.005f};
+
+  for (const vector3_t& domega :
+       {vector3_t{1e-4f, -2e-4f, 5e-5f}, vector3_t{0.3f, -0.2f, 0.5f}}) {
+
+    transform3_t trf(t, z, x);
+    const transform3_t trf_orig{trf};
+    trf.apply_delta(dt, domega);
+    const transform3_t trf_full(trf.matrix());
+
+    for (unsigned int j = 0u; j < 4u; ++j) {
+      for (unsigned int i = 0u; i < 3u; ++i) {
+        ASSERT_NEAR(algebra::getter::element(trf.matrix_inverse(), i, j),
+                    algebra::getter::element(trf_full.matrix_inverse(), i, j),
+                    this->m_isclose);
+      }
+    }
+
+    // The frame is rotated around its origin and then shifted
+    const scalar_t d_angle{algebra::vector::norm(domega)};
+    const transform3_t d_rot = transform3_t::rotation_from_axis_angle(
+        (1.f / d_angle) * domega, d_angle);
+
+    const point3_t p = {3.f, 4.f, 5.f};
+    const point3_t p_glob = trf.point_to_global(p);
+    const point3_t p_exp =
+        d_rot.vector_to_global(trf_orig.point_to_global(p) - t) + t + dt;
+    const point3_t p_loc = trf.point_to_local(p_glob);
+    for (unsigned int i = 0u; i < 3u; ++i) {
+      ASSERT_NEAR(p_glob[i], p_exp[i], this->m_isclose);
+      ASSERT_NEAR(p_loc[i], p[i], this->m_isclose);
+    }
+  }
+}
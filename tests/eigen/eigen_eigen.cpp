@@ -7,6 +7,7 @@
 
 // Project include(s).
 #include "algebra/eigen_eigen.hpp"
+#include "algebra/storage/array.hpp"
 
 // Test include(s).
 #include "test_host_basics.hpp"
@@ -15,6 +16,8 @@
 #include <gtest/gtest.h>
 
 // System include(s).
+#include <cmath>
+#include <concepts>
 #include <string>
 
 /// Struct providing a readable name for the test
@@ -37,7 +40,7 @@ REGISTER_TYPED_TEST_SUITE_P(test_host_basics_vector, local_vectors, vector3,
                             getter);
 TEST_HOST_BASICS_MATRIX_TESTS();
 REGISTER_TYPED_TEST_SUITE_P(test_host_basics_transform, transform3,
-                            global_transformations);
+                            global_transformations, alignment);
 
 // Instantiate the test(s).
 typedef testing::Types<
@@ -56,3 +59,33 @@ INSTANTIATE_TYPED_TEST_SUITE_P(algebra_plugins, test_host_basics_matrix,
                                eigen_eigen_types, test_specialisation_name);
 INSTANTIATE_TYPED_TEST_SUITE_P(algebra_plugins, test_host_basics_transform,
                                eigen_eigen_types, test_specialisation_name);
+
+// Check the zero-copy access to array matrices and vectors as Eigen types
+TEST(test_eigen_eigen, reinterpret_as) {
+
+  using array_matrix_t = algebra::array::matrix_type<double, 3, 4>;
+  using eigen_matrix_t = algebra::eigen::matrix_type<double, 3, 4>;
+
+  static_assert(
+      algebra::traits::is_layout_compatible<array_matrix_t, eigen_matrix_t>);
+  static_assert(algebra::traits::is_layout_compatible<
+                algebra::array::matrix_type<float, 1, 4>,
+                algebra::eigen::matrix_type<float, 1, 4>>);
+
+  array_matrix_t m{};
+  auto m_map = algebra::reinterpret_as<algebra::plugin::eigen<double>>(m);
+  static_assert(std::same_as<decltype(m_map),
+                             Eigen::Map<eigen_matrix_t, Eigen::Unaligned>>);
+
+  // Write through the map
+  m_map.setIdentity();
+  m_map(2, 3) = 5.;
+  EXPECT_DOUBLE_EQ(m[1][1], 1.);
+  EXPECT_DOUBLE_EQ(m[3][2], 5.);
+  EXPECT_DOUBLE_EQ(m[2][1], 0.);
+
+  const algebra::array::vector3<float> v{1.f, 2.f, 3.f};
+  const auto v_map = algebra::reinterpret_as<algebra::plugin::eigen<float>>(v);
+  EXPECT_FLOAT_EQ(v_map.norm(), std::sqrt(14.f));
+  EXPECT_EQ(v_map.data(), v.data());
+}
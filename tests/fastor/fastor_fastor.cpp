@@ -38,7 +38,7 @@ REGISTER_TYPED_TEST_SUITE_P(test_host_basics_vector, local_vectors, vector3,
                             getter);
 TEST_HOST_BASICS_MATRIX_TESTS();
 REGISTER_TYPED_TEST_SUITE_P(test_host_basics_transform, transform3,
-                            global_transformations);
+                            global_transformations, alignment);
 
 // Instantiate the test(s).
 typedef testing::Types<
@@ -16,6 +16,7 @@
 
 // System include(s).
 #include <string>
+#include <vector>
 
 /// Struct providing a readable name for the test
 struct test_specialisation_name {
@@ -37,7 +38,7 @@ REGISTER_TYPED_TEST_SUITE_P(test_host_basics_vector, local_vectors, vector3,
                             getter);
 // TEST_HOST_BASICS_MATRIX_TESTS();
 REGISTER_TYPED_TEST_SUITE_P(test_host_basics_transform, transform3,
-                            global_transformations);
+                            global_transformations, alignment);
 
 // Instantiate the test(s).
 typedef testing::Types<
@@ -58,3 +59,112 @@ INSTANTIATE_TYPED_TEST_SUITE_P(algebra_plugins, test_host_basics_vector,
                                vc_aos_types, test_specialisation_name);*/
 INSTANTIATE_TYPED_TEST_SUITE_P(algebra_plugins, test_host_basics_transform,
                                vc_aos_types, test_specialisation_name);
+
+// Test the matrix type with row vector storage
+TEST(test_vc_aos, row_major_matrix) {
+
+  using vector3 = algebra::vc_aos::vector3<float>;
+  using vector4 = algebra::vc_aos::vector_type<float, 4>;
+  using matrix34 = algebra::vc_aos::row_major_matrix_type<float, 3, 4>;
+  using matrix33 = algebra::vc_aos::row_major_matrix_type<float, 3, 3>;
+
+  static_assert(algebra::concepts::matrix<matrix34>);
+  static_assert(algebra::traits::rows<matrix34> == 3u);
+  static_assert(algebra::traits::columns<matrix34> == 4u);
+
+  matrix34 m = algebra::matrix::zero<matrix34>();
+  for (std::size_t i = 0u; i < 3u; ++i) {
+    for (std::size_t j = 0u; j < 4u; ++j) {
+      algebra::getter::element(m, i, j) = static_cast<float>(10u * i + j);
+    }
+  }
+
+  // The rows are stored contiguously
+  EXPECT_FLOAT_EQ(m[1][2], 12.f);
+  EXPECT_FLOAT_EQ(algebra::getter::element(m, 2, 3), 23.f);
+
+  // Matrix-vector and vector-matrix products
+  const vector4 v{1.f, 2.f, 3.f, 4.f};
+  const vector3 mv = m * v;
+  EXPECT_FLOAT_EQ(mv[0], 20.f);
+  EXPECT_FLOAT_EQ(mv[1], 120.f);
+  EXPECT_FLOAT_EQ(mv[2], 220.f);
+
+  const vector3 w{1.f, -1.f, 2.f};
+  const vector4 wm = w * m;
+  EXPECT_FLOAT_EQ(wm[0], 30.f);
+  EXPECT_FLOAT_EQ(wm[1], 32.f);
+  EXPECT_FLOAT_EQ(wm[2], 34.f);
+  EXPECT_FLOAT_EQ(wm[3], 36.f);
+
+  // Transpose and matrix-matrix product
+  const auto mt = algebra::matrix::transpose(m);
+  static_assert(algebra::traits::rows<decltype(mt)> == 4u);
+  EXPECT_FLOAT_EQ(mt[3][1], 13.f);
+
+  const matrix33 mmt = m * mt;
+  for (std::size_t i = 0u; i < 3u; ++i) {
+    for (std::size_t j = 0u; j < 3u; ++j) {
+      float ref{0.f};
+      for (std::size_t k = 0u; k < 4u; ++k) {
+        ref += m[i][k] * m[j][k];
+      }
+      EXPECT_FLOAT_EQ(mmt[i][j], ref);
+    }
+  }
+
+  // Blocks
+  const auto b = algebra::getter::block<2, 2>(m, 1, 1);
+  EXPECT_FLOAT_EQ(b[0][0], 11.f);
+  EXPECT_FLOAT_EQ(b[1][1], 22.f);
+
+  const auto c = algebra::getter::vector<3>(m, 0, 2);
+  EXPECT_FLOAT_EQ(c[0], 2.f);
+  EXPECT_FLOAT_EQ(c[2], 22.f);
+
+  algebra::getter::set_block(m, b, 0, 0);
+  EXPECT_FLOAT_EQ(m[0][1], 12.f);
+  EXPECT_FLOAT_EQ(m[1][1], 22.f);
+
+  // Inverse
+  matrix33 a{vector3{2.f, 1.f, 0.f}, vector3{1.f, 3.f, 1.f},
+             vector3{0.f, 1.f, 4.f}};
+  EXPECT_FLOAT_EQ(algebra::matrix::determinant(a), 18.f);
+
+  const matrix33 e = a * algebra::matrix::inverse(a);
+  for (std::size_t i = 0u; i < 3u; ++i) {
+    for (std::size_t j = 0u; j < 3u; ++j) {
+      EXPECT_NEAR(e[i][j], i == j ? 1.f : 0.f, 1e-5f);
+    }
+  }
+}
+
+// Test the unpadded vector storage
+TEST(test_vc_aos, packed_vector) {
+
+  using vector6 = algebra::vc_aos::vector6<float>;
+  using packed_vector6 = algebra::vc_aos::packed_vector_type<float, 6>;
+
+  static_assert(sizeof(packed_vector6) == 6u * sizeof(float));
+  static_assert(sizeof(vector6) > sizeof(packed_vector6));
+
+  std::vector<packed_vector6> coll(3u);
+
+  const vector6 a{1.f, 2.f, 3.f, 4.f, 5.f, 6.f};
+  coll[1] = a;
+
+  // Load into the padded vector and store the result of a computation
+  const vector6 b = coll[1];
+  coll[2] = a + b;
+
+  const vector6 c = coll[2].load();
+  for (std::size_t i = 0u; i < 6u; ++i) {
+    EXPECT_FLOAT_EQ(coll[1][i], a[i]);
+    EXPECT_FLOAT_EQ(c[i], 2.f * a[i]);
+    EXPECT_FLOAT_EQ(coll[0][i], 0.f);
+  }
+
+  // The padding is zero after loading
+  EXPECT_FLOAT_EQ(c[6], 0.f);
+  EXPECT_FLOAT_EQ(c[7], 0.f);
+}
@@ -38,7 +38,7 @@ REGISTER_TYPED_TEST_SUITE_P(test_host_basics_vector, local_vectors, vector3,
 /*REGISTER_TYPED_TEST_SUITE_P(test_host_basics_matrix, matrix3, matrix64,
                             matrix22);*/
 REGISTER_TYPED_TEST_SUITE_P(test_host_basics_transform, transform3,
-                            global_transformations);
+                            global_transformations, alignment);
 
 // Instantiate the test(s).
 typedef testing::Types<
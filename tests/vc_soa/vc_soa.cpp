@@ -8,6 +8,8 @@
 // Project include(s).
 #include "algebra/vc_soa.hpp"
 
+#include "algebra/math/kernels/fits.hpp"
+#include "algebra/math/kernels/track_parameters.hpp"
 #include "algebra/utils/approximately_equal.hpp"
 #include "algebra/utils/casts.hpp"
 #include "algebra/utils/print.hpp"
@@ -17,8 +19,11 @@
 
 // System inlcude(s)
 #include <array>
+#include <cmath>
 #include <concepts>
 #include <limits>
+#include <span>
+#include <vector>
 
 using namespace algebra;
 
@@ -26,6 +31,17 @@ using value_t = float;
 
 constexpr float tol{1e-5f};
 
+/// @returns a ramp i / Size over the lanes i, to set up a different problem
+/// in every lane
+inline Vc::Vector<value_t> lane_ramp() {
+  Vc::Vector<value_t> lane{};
+  for (std::size_t i{0u}; i < Vc::Vector<value_t>::Size; ++i) {
+    lane[i] = static_cast<value_t>(i) /
+              static_cast<value_t>(Vc::Vector<value_t>::Size);
+  }
+  return lane;
+}
+
 /// This test the vector functions on an SoA (Vc::Vector) based vector
 TEST(test_vc_host, vc_soa_vector) {
   // Print the linear algebra types of this backend
@@ -168,6 +184,19 @@ TEST(test_vc_host, vc_soa_vector) {
     EXPECT_NEAR(norms_b[i], 1.f, tol);
   }
 
+  // Fast precision mode
+  constexpr precision::fast fast{};
+  scalar_t norms_fast{vector::norm(vector::normalize(b, fast), fast)};
+  scalar_t norm_b{vector::norm(b)};
+  scalar_t norm_b_fast{vector::norm(b, fast)};
+  scalar_t eta_b{vector::eta(b)};
+  scalar_t eta_b_fast{vector::eta(b, fast)};
+  for (unsigned int i{0u}; i < norms_fast.size(); ++i) {
+    EXPECT_NEAR(norms_fast[i], 1.f, tol);
+    EXPECT_NEAR(norm_b_fast[i], norm_b[i], tol * norm_b[i]);
+    EXPECT_NEAR(eta_b_fast[i], eta_b[i], tol);
+  }
+
   auto cr{vector::cross(a, b)};
   EXPECT_TRUE((cr[0] == scalar_t(-3.f)).isFull());
   EXPECT_TRUE((cr[1] == scalar_t(6.f)).isFull());
@@ -177,6 +206,48 @@ TEST(test_vc_host, vc_soa_vector) {
                 "expression type not convertible");
 }
 
+/// This test the SIMD math functions that are not provided by Vc
+TEST(test_vc_host, vc_soa_math) {
+
+  using scalar_t = Vc::Vector<value_t>;
+
+  // Sample the open interval (-1, 1)
+  scalar_t x{};
+  for (std::size_t i{0u}; i < scalar_t::Size; ++i) {
+    x[i] = -0.99f + 1.98f * static_cast<value_t>(i) /
+                        static_cast<value_t>(scalar_t::Size);
+  }
+
+  const scalar_t atanh_x{algebra::math::atanh(x)};
+  const scalar_t acos_x{algebra::math::acos(x)};
+  const scalar_t atan2_x{algebra::math::atan2(x, scalar_t::One() - x)};
+  const auto [sin_x, cos_x] = algebra::math::sincos(x);
+
+  for (std::size_t i{0u}; i < scalar_t::Size; ++i) {
+    const value_t x_i{x[i]};
+    EXPECT_NEAR(atanh_x[i], std::atanh(x_i), tol);
+    EXPECT_NEAR(acos_x[i], std::acos(x_i), tol);
+    EXPECT_NEAR(atan2_x[i], std::atan2(x_i, 1.f - x_i), tol);
+    EXPECT_NEAR(sin_x[i], std::sin(x_i), tol);
+    EXPECT_NEAR(cos_x[i], std::cos(x_i), tol);
+  }
+
+  // Edge cases
+  EXPECT_TRUE((algebra::math::atanh(scalar_t::Zero()) == scalar_t::Zero())
+                  .isFull());
+  EXPECT_TRUE(Vc::isinf(algebra::math::atanh(scalar_t::One())).isFull());
+  EXPECT_TRUE(Vc::isinf(algebra::math::atanh(-scalar_t::One())).isFull());
+  EXPECT_TRUE((algebra::math::acos(scalar_t::One()) == scalar_t::Zero())
+                  .isFull());
+
+  // Pseudo-rapidity
+  const vc_soa::vector3<value_t> v{1.f, 2.f, 3.f};
+  const scalar_t eta{vector::eta(v)};
+  for (std::size_t i{0u}; i < scalar_t::Size; ++i) {
+    EXPECT_NEAR(eta[i], std::atanh(3.f / std::sqrt(14.f)), tol);
+  }
+}
+
 /// This test the getter functions on an SoA (Vc::Vector) based vector
 TEST(test_vc_host, vc_soa_getter) {
 
@@ -332,6 +403,64 @@ TEST(test_vc_host, vc_soa_transform3) {
   EXPECT_NEAR(loc_vecB[2][0], loc_vecC[2][0], tol);
 }
 
+/// This tests the alignment corrections on a batch of transforms
+TEST(test_vc_host, vc_soa_apply_delta) {
+
+  using vector3 = vc_soa::vector3<value_t>;
+  using point3 = vc_soa::point3<value_t>;
+  using scalar_t = typename vector3::scalar_type;
+  using transform3 = vc_soa::transform3<value_t>;
+
+  const vector3 z = vector::normalize(vector3{3.f, 2.f, 1.f});
+  const vector3 x = vector::normalize(vector3{2.f, -3.f, 0.f});
+  const point3 t = {2.f, 3.f, 4.f};
+  const vector3 dt = {0.01f, -0.02f, 0.005f};
+
+  // A different rotation in every lane: No rotation in the first lane, which
+  // takes the small angle expansion
+  const scalar_t lane{lane_ramp()};
+  const vector3 domega = {0.3f * lane, -0.2f * lane, 0.5f * lane};
+
+  transform3 trf(t, z, x);
+  trf.apply_delta(dt, domega);
+
+  // The incrementally updated inverse has to agree with the full inversion
+  const transform3 trf_full(trf.matrix());
+  for (std::size_t j = 0u; j < 4u; ++j) {
+    for (std::size_t i = 0u; i < 3u; ++i) {
+      for (std::size_t k = 0u; k < scalar_t::Size; ++k) {
+        EXPECT_NEAR(trf.matrix_inverse()[j][i][k],
+                    trf_full.matrix_inverse()[j][i][k], tol);
+      }
+    }
+  }
+
+  // Every lane has to agree with the same correction applied to all lanes
+  for (std::size_t k = 0u; k < scalar_t::Size; ++k) {
+    transform3 trf_k(t, z, x);
+    trf_k.apply_delta(dt, vector3{scalar_t(domega[0][k]),
+                                  scalar_t(domega[1][k]),
+                                  scalar_t(domega[2][k])});
+
+    for (std::size_t j = 0u; j < 4u; ++j) {
+      for (std::size_t i = 0u; i < 3u; ++i) {
+        EXPECT_NEAR(trf(i, j)[k], trf_k(i, j)[0], tol);
+        EXPECT_NEAR(trf.matrix_inverse()[j][i][k],
+                    trf_k.matrix_inverse()[j][i][0], tol);
+      }
+    }
+  }
+
+  // The first lane is only shifted
+  const transform3 trf_orig(t, z, x);
+  for (std::size_t j = 0u; j < 3u; ++j) {
+    for (std::size_t i = 0u; i < 3u; ++i) {
+      EXPECT_NEAR(trf(i, j)[0], trf_orig(i, j)[0], tol);
+    }
+    EXPECT_NEAR(trf(j, 3)[0], t[j][0] + dt[j][0], tol);
+  }
+}
+
 /// This test an SoA (Vc::Vector) based 2x3 matrix
 TEST(test_vc_host, vc_soa_matrix3) {
 
@@ -410,3 +539,481 @@ TEST(test_vc_host, vc_soa_matrix64) {
   static_assert(
       std::same_as<decltype(m_cast_i), vc_soa::matrix_type<int, 6, 4>>);
 }
+
+/// This tests the track parameter conversions on a batch of tracks
+TEST(test_vc_host, vc_soa_track_parameters) {
+
+  using namespace algebra::kernels;
+
+  using scalar_t = Vc::Vector<value_t>;
+  using vector3 = vc_soa::vector3<value_t>;
+  using transform3 = vc_soa::transform3<value_t>;
+  using bound_vector = vc_soa::matrix_type<value_t, e_bound_size, 1>;
+  using bound_to_free_jacobian =
+      vc_soa::matrix_type<value_t, e_free_size, e_bound_size>;
+  using free_to_bound_jacobian =
+      vc_soa::matrix_type<value_t, e_bound_size, e_free_size>;
+
+  const vector3 z = vector::normalize(vector3{3.f, 2.f, 1.f});
+  const vector3 x = vector::normalize(vector3{2.f, -3.f, 0.f});
+  const transform3 trf(vector3{2.f, 3.f, 4.f}, z, x);
+
+  // A different track in every lane
+  const scalar_t lane{lane_ramp()};
+
+  bound_vector bound_vec;
+  getter::element(bound_vec, e_bound_loc0, 0) = 1.5f - lane;
+  getter::element(bound_vec, e_bound_loc1, 0) = -0.5f + lane;
+  getter::element(bound_vec, e_bound_phi, 0) = -3.f + 6.f * lane;
+  getter::element(bound_vec, e_bound_theta, 0) = 0.2f + 2.7f * lane;
+  getter::element(bound_vec, e_bound_qoverp, 0) = -0.1f * lane;
+  getter::element(bound_vec, e_bound_time, 0) = 10.f * lane;
+
+  bound_to_free_jacobian b2f_jac;
+  const auto free_vec = bound_to_free(trf, bound_vec, b2f_jac);
+
+  free_to_bound_jacobian f2b_jac;
+  const auto bound_vec_r = free_to_bound(trf, free_vec, f2b_jac);
+
+  // Round trip
+  for (std::size_t i{0u}; i < e_bound_size; ++i) {
+    const scalar_t diff{getter::element(bound_vec_r, i, 0) -
+                        getter::element(bound_vec, i, 0)};
+    EXPECT_TRUE((Vc::abs(diff) < tol).isFull());
+  }
+
+  // The jacobians are inverse to each other
+  const auto id = f2b_jac * b2f_jac;
+  for (std::size_t i{0u}; i < e_bound_size; ++i) {
+    for (std::size_t j{0u}; j < e_bound_size; ++j) {
+      const scalar_t diff{getter::element(id, i, j) -
+                          (i == j ? scalar_t::One() : scalar_t::Zero())};
+      EXPECT_TRUE((Vc::abs(diff) < tol).isFull());
+    }
+  }
+}
+
+/// This tests the line and circle fits on a batch of candidates
+TEST(test_vc_host, vc_soa_fits) {
+
+  using namespace algebra::kernels;
+
+  using scalar_t = Vc::Vector<value_t>;
+  using point2 = vc_soa::point2<value_t>;
+  using point3 = vc_soa::point3<value_t>;
+  using line_covariance =
+      vc_soa::matrix_type<value_t, e_line_size, e_line_size>;
+  using circle_covariance =
+      vc_soa::matrix_type<value_t, e_circle_size, e_circle_size>;
+
+  // A different candidate in every lane
+  const scalar_t lane{lane_ramp()};
+
+  // Straight lines x = lane + (1 - lane) * z, y = 2 * lane * z
+  std::array<point3, 4> line_hits;
+  for (std::size_t i{0u}; i < line_hits.size(); ++i) {
+    const scalar_t z{static_cast<value_t>(i)};
+    line_hits[i] = point3{lane + (1.f - lane) * z, 2.f * lane * z, z};
+  }
+
+  line_covariance line_cov;
+  scalar_t chi2{};
+  const auto line_vec = line_fit(line_hits, line_cov, chi2);
+
+  const scalar_t x0_diff{getter::element(line_vec, e_line_x0, 0) - lane};
+  const scalar_t y0_diff{getter::element(line_vec, e_line_y0, 0)};
+  const scalar_t tx_diff{getter::element(line_vec, e_line_tx, 0) -
+                         (1.f - lane)};
+  const scalar_t ty_diff{getter::element(line_vec, e_line_ty, 0) -
+                         2.f * lane};
+  EXPECT_TRUE((Vc::abs(x0_diff) < tol).isFull());
+  EXPECT_TRUE((Vc::abs(y0_diff) < tol).isFull());
+  EXPECT_TRUE((Vc::abs(tx_diff) < tol).isFull());
+  EXPECT_TRUE((Vc::abs(ty_diff) < tol).isFull());
+  EXPECT_TRUE((Vc::abs(chi2) < tol).isFull());
+
+  // Circles through the origin with the centers at (0, -r), bending clockwise
+  const scalar_t r{10.f + 70.f * lane};
+  std::array<point2, 5> circle_hits;
+  for (std::size_t i{0u}; i < circle_hits.size(); ++i) {
+    const value_t alpha{0.1f * static_cast<value_t>(i + 1u)};
+    circle_hits[i] = point2{r * std::sin(alpha), -r + r * std::cos(alpha)};
+  }
+
+  circle_covariance circle_cov;
+  const auto circle_vec = circle_fit(circle_hits, circle_cov, chi2);
+
+  const scalar_t rho_diff{getter::element(circle_vec, e_circle_rho, 0) * r -
+                          1.f};
+  const scalar_t phi_diff{getter::element(circle_vec, e_circle_phi, 0)};
+  const scalar_t d0_diff{getter::element(circle_vec, e_circle_d0, 0)};
+  EXPECT_TRUE((Vc::abs(rho_diff) < 1e-4f).isFull());
+  EXPECT_TRUE((Vc::abs(phi_diff) < 1e-4f).isFull());
+  EXPECT_TRUE((Vc::abs(d0_diff) < 1e-4f).isFull());
+  EXPECT_TRUE((getter::element(circle_cov, e_circle_rho, e_circle_rho) > 0.f)
+                  .isFull());
+}
+
+/// This tests the QR decomposition and the least squares solver on a batch of
+/// matrices
+TEST(test_vc_host, vc_soa_householder_qr) {
+
+  using scalar_t = Vc::Vector<value_t>;
+  using matrix_6x3_t = vc_soa::matrix_type<value_t, 6, 3>;
+  using matrix_3x3_t = vc_soa::matrix_type<value_t, 3, 3>;
+  using vector6 = vc_soa::vector6<value_t>;
+  using vector3 = vc_soa::vector3<value_t>;
+  using qr_t = generic::matrix::decomposition::householder_qr<
+      matrix_6x3_t, algebra::traits::element_getter_t<matrix_6x3_t>>;
+
+  // A different parabola fit y = a + b * x + c * x^2 in every lane
+  const scalar_t lane{lane_ramp()};
+
+  matrix_6x3_t a;
+  vector6 b;
+  for (std::size_t i{0u}; i < 6u; ++i) {
+    const scalar_t x{static_cast<value_t>(i) - 2.5f + lane};
+    getter::element(a, i, 0) = scalar_t::One();
+    getter::element(a, i, 1) = x;
+    getter::element(a, i, 2) = x * x;
+    b[i] = 0.5f * lane - (2.f - lane) * x + 0.1f * x * x +
+           ((i % 2u == 0u) ? 0.01f : -0.01f);
+  }
+
+  // A = Q * R and Q^T * Q = I in every lane
+  const qr_t::qrd d = qr_t{}(a);
+  const matrix_6x3_t q = qr_t::thin_q(d);
+  const matrix_6x3_t qr = q * qr_t::r(d);
+  const matrix_3x3_t qtq = matrix::transpose(q) * q;
+  for (std::size_t j{0u}; j < 3u; ++j) {
+    for (std::size_t i{0u}; i < 6u; ++i) {
+      const scalar_t diff{getter::element(qr, i, j) -
+                          getter::element(a, i, j)};
+      EXPECT_TRUE((Vc::abs(diff) < 1e-4f).isFull());
+      if (i < 3u) {
+        const scalar_t qtq_diff{getter::element(qtq, i, j) -
+                                (i == j ? scalar_t::One() : scalar_t::Zero())};
+        EXPECT_TRUE((Vc::abs(qtq_diff) < 1e-4f).isFull());
+      }
+    }
+  }
+
+  // The residual of the least squares solution is orthogonal to the columns
+  const vector3 x = matrix::least_squares(a, b);
+  const vector6 res = a * x - b;
+  const vector3 at_res = matrix::transpose(a) * res;
+  for (std::size_t i{0u}; i < 3u; ++i) {
+    EXPECT_TRUE((Vc::abs(at_res[i]) < 1e-4f).isFull());
+  }
+
+  // Without the noise the fit recovers the parameters of every lane
+  for (std::size_t i{0u}; i < 6u; ++i) {
+    b[i] -= (i % 2u == 0u) ? 0.01f : -0.01f;
+  }
+  const vector3 x_exact = matrix::least_squares(a, b);
+  EXPECT_TRUE((Vc::abs(x_exact[0] - 0.5f * lane) < 1e-4f).isFull());
+  EXPECT_TRUE((Vc::abs(x_exact[1] + (2.f - lane)) < 1e-4f).isFull());
+  EXPECT_TRUE((Vc::abs(x_exact[2] - 0.1f) < 1e-4f).isFull());
+}
+
+/// This tests the symmetric eigen decomposition of a batch of matrices
+TEST(test_vc_host, vc_soa_symmetric_eigen) {
+
+  using scalar_t = Vc::Vector<value_t>;
+  using matrix_3x3_t = vc_soa::matrix_type<value_t, 3, 3>;
+
+  // A different matrix in every lane, with eigenvalues of different order
+  // and a diagonal matrix in the first lane
+  const scalar_t lane{lane_ramp()};
+
+  matrix_3x3_t m;
+  getter::element(m, 0, 0) = 4.f;
+  getter::element(m, 1, 1) = 2.f - 3.f * lane;
+  getter::element(m, 2, 2) = 1.f + lane;
+  getter::element(m, 1, 0) = lane;
+  getter::element(m, 2, 0) = -0.5f * lane;
+  getter::element(m, 2, 1) = 2.f * lane * lane;
+  getter::element(m, 0, 1) = getter::element(m, 1, 0);
+  getter::element(m, 0, 2) = getter::element(m, 2, 0);
+  getter::element(m, 1, 2) = getter::element(m, 2, 1);
+
+  const auto [values, vectors] = matrix::symmetric_eigen(m);
+
+  // Increasing eigenvalues that add up to the trace
+  EXPECT_TRUE((values[0] <= values[1]).isFull());
+  EXPECT_TRUE((values[1] <= values[2]).isFull());
+  const scalar_t trace_diff{values[0] + values[1] + values[2] -
+                            (getter::element(m, 0, 0) +
+                             getter::element(m, 1, 1) +
+                             getter::element(m, 2, 2))};
+  EXPECT_TRUE((Vc::abs(trace_diff) < 1e-4f).isFull());
+
+  // A * v = lambda * v and V^T * V = I, in every lane
+  const auto av = m * vectors;
+  const auto vtv = matrix::transpose(vectors) * vectors;
+  for (std::size_t j{0u}; j < 3u; ++j) {
+    for (std::size_t i{0u}; i < 3u; ++i) {
+      const scalar_t av_diff{getter::element(av, i, j) -
+                             values[j] * getter::element(vectors, i, j)};
+      const scalar_t vtv_diff{getter::element(vtv, i, j) -
+                              (i == j ? scalar_t::One() : scalar_t::Zero())};
+      EXPECT_TRUE((Vc::abs(av_diff) < 1e-4f).isFull());
+      EXPECT_TRUE((Vc::abs(vtv_diff) < 1e-4f).isFull());
+    }
+  }
+}
+
+/// This tests the singular value decomposition of a batch of matrices
+TEST(test_vc_host, vc_soa_jacobi_svd) {
+
+  using scalar_t = Vc::Vector<value_t>;
+  using matrix_6x4_t = vc_soa::matrix_type<value_t, 6, 4>;
+  using matrix_4x4_t = vc_soa::matrix_type<value_t, 4, 4>;
+  using svd_t = generic::matrix::decomposition::jacobi_svd<
+      matrix_6x4_t, algebra::traits::element_getter_t<matrix_6x4_t>>;
+
+  // A different matrix in every lane, with a growing condition number
+  const scalar_t lane{lane_ramp()};
+
+  matrix_6x4_t m;
+  for (std::size_t j{0u}; j < 4u; ++j) {
+    for (std::size_t i{0u}; i < 6u; ++i) {
+      const value_t x{1.f / static_cast<value_t>(i + j + 1u)};
+      getter::element(m, i, j) =
+          (i == j ? 2.f - 1.5f * lane : scalar_t::Zero()) + x * (1.f + lane);
+    }
+  }
+
+  const svd_t::svd d = svd_t{}(m);
+
+  // Decreasing singular values and A = U * diag(sigma) * V^T in every lane
+  matrix_4x4_t s = matrix::zero<matrix_4x4_t>();
+  for (std::size_t i{0u}; i < 4u; ++i) {
+    if (i < 3u) {
+      EXPECT_TRUE((d.sigma[i] >= d.sigma[i + 1u]).isFull());
+    }
+    EXPECT_TRUE((d.sigma[i] > 0.f).isFull());
+    getter::element(s, i, i) = d.sigma[i];
+  }
+
+  const auto usv = d.u * s * matrix::transpose(d.v);
+  for (std::size_t j{0u}; j < 4u; ++j) {
+    for (std::size_t i{0u}; i < 6u; ++i) {
+      const scalar_t diff{getter::element(usv, i, j) -
+                          getter::element(m, i, j)};
+      EXPECT_TRUE((Vc::abs(diff) < 1e-4f).isFull());
+    }
+  }
+
+  // The pseudo-inverse is a left inverse and the condition number is the
+  // ratio of the extreme singular values
+  const auto pinv_m = matrix::pseudo_inverse(m) * m;
+  for (std::size_t j{0u}; j < 4u; ++j) {
+    for (std::size_t i{0u}; i < 4u; ++i) {
+      const scalar_t diff{getter::element(pinv_m, i, j) -
+                          (i == j ? scalar_t::One() : scalar_t::Zero())};
+      EXPECT_TRUE((Vc::abs(diff) < 1e-4f).isFull());
+    }
+  }
+
+  const scalar_t cond{matrix::condition_number(m)};
+  EXPECT_TRUE(
+      (Vc::abs(cond * d.sigma[3] - d.sigma[0]) < 1e-4f * d.sigma[0]).isFull());
+  EXPECT_TRUE((cond >= 1.f).isFull());
+}
+
+/// This tests the AoSoA containers on top of the SoA types
+TEST(test_vc_host, vc_soa_aosoa) {
+
+  using point3 = vc_soa::point3<value_t>;
+  using transform3 = vc_soa::transform3<value_t>;
+  using matrix_6x6_t = vc_soa::matrix_type<value_t, 6, 6>;
+  using matrix_2x6_t = vc_soa::matrix_type<value_t, 2, 6>;
+
+  using point_container_t = vc_soa::aosoa<point3>;
+  using trf_container_t = vc_soa::aosoa<transform3>;
+
+  constexpr std::size_t width{point_container_t::width};
+  static_assert(width == Vc::Vector<value_t>::Size);
+
+  // Fill more elements than fit into a single chunk
+  const std::size_t n{2u * width + 1u};
+
+  point_container_t points(n);
+  trf_container_t trfs(n);
+  EXPECT_EQ(points.size(), n);
+  EXPECT_EQ(points.n_chunks(), 3u);
+
+  for (std::size_t i = 0u; i < n; ++i) {
+    const auto v_i{static_cast<value_t>(i)};
+
+    points[i] = point_container_t::value_type{v_i, 2.f * v_i, 1.f};
+    trfs[i] = trf_container_t::value_type{
+        trf_container_t::value_type::vector3{v_i, 0.f, -v_i}};
+  }
+
+  // Element access on an AoS copy of a single element
+  const point_container_t::value_type p_5 = points[5];
+  EXPECT_FLOAT_EQ(p_5[0], 5.f);
+  EXPECT_FLOAT_EQ(p_5[1], 10.f);
+  EXPECT_FLOAT_EQ(p_5[2], 1.f);
+
+  // Chunk access gives the SoA type, without copying
+  const point3 &chunk_1 = points.chunk(1);
+  EXPECT_FLOAT_EQ(chunk_1[0][0], static_cast<value_t>(width));
+
+  // Bulk operations
+  const auto glob = vc_soa::point_to_global(trfs, points);
+  const auto loc = vc_soa::point_to_local(trfs, glob);
+  const auto norm2 = vc_soa::dot(points, points);
+  ASSERT_EQ(glob.size(), n);
+
+  for (std::size_t i = 0u; i < n; ++i) {
+    const auto v_i{static_cast<value_t>(i)};
+    const point_container_t::value_type g_i = glob[i];
+    const point_container_t::value_type l_i = loc[i];
+
+    EXPECT_NEAR(g_i[0], 2.f * v_i, tol);
+    EXPECT_NEAR(g_i[1], 2.f * v_i, tol);
+    EXPECT_NEAR(g_i[2], 1.f - v_i, tol);
+    EXPECT_NEAR(l_i[0], v_i, tol);
+    EXPECT_NEAR(l_i[1], 2.f * v_i, tol);
+    EXPECT_NEAR(l_i[2], 1.f, tol);
+    EXPECT_NEAR(norm2[i], 5.f * v_i * v_i + 1.f, tol);
+  }
+
+  // Similarity transform with a projection onto the first two parameters
+  vc_soa::aosoa<matrix_6x6_t> covs(n);
+  for (std::size_t i = 0u; i < n; ++i) {
+    vc_soa::aosoa<matrix_6x6_t>::value_type cov{};
+    for (std::size_t j = 0u; j < 6u; ++j) {
+      getter::element(cov, j, j) = static_cast<value_t>(i + j);
+    }
+    covs[i] = cov;
+  }
+
+  matrix_2x6_t proj = matrix::zero<matrix_2x6_t>();
+  getter::element(proj, 0, 0) = Vc::Vector<value_t>::One();
+  getter::element(proj, 1, 1) = Vc::Vector<value_t>::One();
+
+  const auto proj_covs = vc_soa::similarity(proj, covs);
+  for (std::size_t i = 0u; i < n; ++i) {
+    const auto cov_i = proj_covs[i];
+    EXPECT_FLOAT_EQ(cov_i[0][0], static_cast<value_t>(i));
+    EXPECT_FLOAT_EQ(cov_i[1][1], static_cast<value_t>(i + 1u));
+    EXPECT_FLOAT_EQ(cov_i[1][0], 0.f);
+  }
+}
+
+/// This tests the application of a single (AoS) transform to SoA points
+TEST(test_vc_host, vc_soa_broadcast_transform3) {
+
+  using scalar_t = Vc::Vector<value_t>;
+  using vector3 = vc_soa::vector3<value_t>;
+  using point3 = vc_soa::point3<value_t>;
+  using transform3 = vc_soa::transform3<value_t>;
+
+  using aos_vector3 = vc_aos::vector3<value_t>;
+  using aos_transform3 =
+      vc_aos::math::transform3<vc_aos::storage_type, value_t>;
+
+  // The same transform in both layouts
+  const aos_vector3 z{3.f / std::sqrt(14.f), 2.f / std::sqrt(14.f),
+                      1.f / std::sqrt(14.f)};
+  const aos_vector3 x{2.f / std::sqrt(13.f), -3.f / std::sqrt(13.f), 0.f};
+  const aos_vector3 t{2.f, 3.f, 4.f};
+
+  const aos_transform3 aos_trf(t, z, x);
+  const transform3 soa_trf(vector3{t[0], t[1], t[2]},
+                           vector3{z[0], z[1], z[2]},
+                           vector3{x[0], x[1], x[2]});
+
+  // Different point in every lane
+  point3 p{};
+  for (std::size_t i{0u}; i < scalar_t::Size; ++i) {
+    const auto v_i{static_cast<value_t>(i) /
+                   static_cast<value_t>(scalar_t::Size)};
+    p[0][i] = v_i;
+    p[1][i] = 1.f - v_i;
+    p[2][i] = 2.f * v_i;
+  }
+
+  const point3 glob = vc_soa::math::point_to_global(aos_trf, p);
+  const point3 glob_ref = soa_trf.point_to_global(p);
+  const point3 loc = vc_soa::math::point_to_local(aos_trf, glob);
+
+  const vector3 dir = vc_soa::math::vector_to_global(aos_trf, p);
+  const vector3 dir_ref = soa_trf.vector_to_global(p);
+  const vector3 dir_loc = vc_soa::math::vector_to_local(aos_trf, dir);
+
+  for (std::size_t j{0u}; j < 3u; ++j) {
+    for (std::size_t i{0u}; i < scalar_t::Size; ++i) {
+      EXPECT_NEAR(glob[j][i], glob_ref[j][i], tol);
+      EXPECT_NEAR(loc[j][i], p[j][i], tol);
+      EXPECT_NEAR(dir[j][i], dir_ref[j][i], tol);
+      EXPECT_NEAR(dir_loc[j][i], p[j][i], tol);
+    }
+  }
+}
+
+/// This tests the gathering/scattering of SoA transforms from/to a table of
+/// AoS transforms
+TEST(test_vc_host, vc_soa_gather_transform3) {
+
+  using scalar_t = Vc::Vector<value_t>;
+  using transform3 = vc_soa::transform3<value_t>;
+  using index_t = Vc::SimdArray<int, scalar_t::Size>;
+
+  using aos_vector3 = vc_aos::vector3<value_t>;
+  using aos_transform3 =
+      vc_aos::math::transform3<vc_aos::storage_type, value_t>;
+
+  const aos_vector3 z{3.f / std::sqrt(14.f), 2.f / std::sqrt(14.f),
+                      1.f / std::sqrt(14.f)};
+  const aos_vector3 x{2.f / std::sqrt(13.f), -3.f / std::sqrt(13.f), 0.f};
+
+  // Table of transforms that differ in their translation
+  const std::size_t n{3u * scalar_t::Size};
+  std::vector<aos_transform3> table;
+  table.reserve(n);
+  for (std::size_t k = 0u; k < n; ++k) {
+    const auto v_k{static_cast<value_t>(k)};
+    table.emplace_back(aos_vector3{v_k, 2.f * v_k, -v_k}, z, x);
+  }
+
+  // Different table entry for every lane
+  index_t idx{};
+  for (std::size_t i = 0u; i < scalar_t::Size; ++i) {
+    idx[i] = static_cast<int>((3u * i + 1u) % n);
+  }
+
+  const transform3 trf{std::span<const aos_transform3>{table}, idx};
+
+  for (std::size_t i = 0u; i < scalar_t::Size; ++i) {
+    const aos_transform3 &trf_i = table[static_cast<std::size_t>(idx[i])];
+
+    for (std::size_t j = 0u; j < 4u; ++j) {
+      for (std::size_t k = 0u; k < 3u; ++k) {
+        EXPECT_FLOAT_EQ(trf.matrix()[j][k][i], trf_i.matrix()[j][k]);
+        EXPECT_FLOAT_EQ(trf.matrix_inverse()[j][k][i],
+                        trf_i.matrix_inverse()[j][k]);
+      }
+    }
+  }
+
+  // Write the lanes back to a different table
+  std::vector<aos_transform3> out(n);
+  trf.scatter(std::span<aos_transform3>{out}, idx);
+
+  for (std::size_t i = 0u; i < scalar_t::Size; ++i) {
+    const auto k{static_cast<std::size_t>(idx[i])};
+
+    for (std::size_t j = 0u; j < 4u; ++j) {
+      for (std::size_t l = 0u; l < 3u; ++l) {
+        EXPECT_FLOAT_EQ(out[k].matrix()[j][l], table[k].matrix()[j][l]);
+        EXPECT_FLOAT_EQ(out[k].matrix_inverse()[j][l],
+                        table[k].matrix_inverse()[j][l]);
+      }
+    }
+  }
+}
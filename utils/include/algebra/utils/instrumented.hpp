@@ -0,0 +1,280 @@
+/** Algebra plugins library, part of the ACTS project
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "algebra/concepts.hpp"
+#include "algebra/math/common.hpp"
+
+// System include(s)
+#include <cmath>
+#include <cstdint>
+#include <ostream>
+
+namespace algebra {
+
+/// Number of floating point operations recorded by @c algebra::instrumented
+struct op_counts {
+  /// Additions and subtractions
+  std::uint64_t add{0u};
+  /// Multiplications
+  std::uint64_t mul{0u};
+  /// Divisions
+  std::uint64_t div{0u};
+  /// Square roots
+  std::uint64_t sqrt{0u};
+  /// Fused multiply-adds
+  std::uint64_t fma{0u};
+  /// Comparisons (incl. @c min and @c max)
+  std::uint64_t compare{0u};
+
+  /// @returns the number of arithmetic flops (an fma counts as two)
+  constexpr std::uint64_t flops() const {
+    return add + mul + div + sqrt + 2u * fma;
+  }
+
+  /// @returns the operations that were recorded between @param o and this
+  constexpr op_counts operator-(const op_counts& o) const {
+    return {add - o.add,   mul - o.mul,   div - o.div,
+            sqrt - o.sqrt, fma - o.fma, compare - o.compare};
+  }
+};
+
+namespace detail {
+
+/// Operation counters of the current thread
+inline thread_local op_counts instrumented_counts{};
+
+}  // namespace detail
+
+/// @returns the operation counters of the calling thread
+inline op_counts& instrumented_counters() {
+  return detail::instrumented_counts;
+}
+
+/// Reset the operation counters of the calling thread
+inline void reset_instrumented_counters() {
+  detail::instrumented_counts = {};
+}
+
+/// Scalar type that wraps a value of type @tparam T and counts every
+/// arithmetic operation that is performed on it
+///
+/// Meant to be dropped into a plugin in place of its scalar type, in order to
+/// compare the cost of the different algorithms analytically. Transcendental
+/// functions are forwarded to the underlying value, but not counted.
+template <concepts::value T>
+struct instrumented {
+
+  using value_type = T;
+
+  /// Wrapped value
+  value_type m_value{0};
+
+  /// Default constructor: zero
+  constexpr instrumented() = default;
+
+  /// Construct from any arithmetic value (implicit, to mimic a fundamental
+  /// type in expressions like `scalar_t s = 0`)
+  template <concepts::arithmetic U>
+  constexpr instrumented(U v) : m_value{static_cast<value_type>(v)} {}
+
+  /// Explicit conversion to arithmetic types
+  template <concepts::arithmetic U>
+  constexpr explicit operator U() const {
+    return static_cast<U>(m_value);
+  }
+
+  /// @returns the wrapped value
+  constexpr value_type value() const { return m_value; }
+
+  /// Arithmetic operators
+  /// @{
+  friend instrumented operator+(const instrumented& a, const instrumented& b) {
+    ++detail::instrumented_counts.add;
+    return instrumented{a.m_value + b.m_value};
+  }
+
+  friend instrumented operator-(const instrumented& a, const instrumented& b) {
+    ++detail::instrumented_counts.add;
+    return instrumented{a.m_value - b.m_value};
+  }
+
+  friend instrumented operator*(const instrumented& a, const instrumented& b) {
+    ++detail::instrumented_counts.mul;
+    return instrumented{a.m_value * b.m_value};
+  }
+
+  friend instrumented operator/(const instrumented& a, const instrumented& b) {
+    ++detail::instrumented_counts.div;
+    return instrumented{a.m_value / b.m_value};
+  }
+
+  friend constexpr instrumented operator+(const instrumented& a) { return a; }
+
+  friend constexpr instrumented operator-(const instrumented& a) {
+    return instrumented{-a.m_value};
+  }
+
+  instrumented& operator+=(const instrumented& o) { return *this = *this + o; }
+
+  instrumented& operator-=(const instrumented& o) { return *this = *this - o; }
+
+  instrumented& operator*=(const instrumented& o) { return *this = *this * o; }
+
+  instrumented& operator/=(const instrumented& o) { return *this = *this / o; }
+  /// @}
+
+  /// Comparison operators
+  /// @{
+  friend bool operator==(const instrumented& a, const instrumented& b) {
+    ++detail::instrumented_counts.compare;
+    return a.m_value == b.m_value;
+  }
+
+  friend bool operator!=(const instrumented& a, const instrumented& b) {
+    ++detail::instrumented_counts.compare;
+    return a.m_value != b.m_value;
+  }
+
+  friend bool operator<(const instrumented& a, const instrumented& b) {
+    ++detail::instrumented_counts.compare;
+    return a.m_value < b.m_value;
+  }
+
+  friend bool operator<=(const instrumented& a, const instrumented& b) {
+    ++detail::instrumented_counts.compare;
+    return a.m_value <= b.m_value;
+  }
+
+  friend bool operator>(const instrumented& a, const instrumented& b) {
+    ++detail::instrumented_counts.compare;
+    return a.m_value > b.m_value;
+  }
+
+  friend bool operator>=(const instrumented& a, const instrumented& b) {
+    ++detail::instrumented_counts.compare;
+    return a.m_value >= b.m_value;
+  }
+  /// @}
+
+  /// Print the wrapped value
+  friend std::ostream& operator<<(std::ostream& os, const instrumented& s) {
+    return os << s.m_value;
+  }
+};
+
+namespace math {
+
+/// Math functions on single values
+/// @{
+using std::abs;
+using std::acos;
+using std::asin;
+using std::atan;
+using std::atan2;
+using std::atanh;
+using std::copysign;
+using std::cos;
+using std::exp;
+using std::fabs;
+using std::fma;
+using std::log;
+using std::max;
+using std::min;
+using std::sin;
+using std::sqrt;
+using std::tan;
+/// @}
+
+/// Overloads of common math functions for @c algebra::instrumented
+/// @{
+template <concepts::value T>
+inline instrumented<T> abs(const instrumented<T>& s) {
+  return instrumented<T>{std::abs(s.m_value)};
+}
+
+template <concepts::value T>
+inline instrumented<T> fabs(const instrumented<T>& s) {
+  return instrumented<T>{std::fabs(s.m_value)};
+}
+
+template <concepts::value T>
+inline instrumented<T> sqrt(const instrumented<T>& s) {
+  ++detail::instrumented_counts.sqrt;
+  return instrumented<T>{std::sqrt(s.m_value)};
+}
+
+template <concepts::value T>
+inline instrumented<T> fma(const instrumented<T>& a, const instrumented<T>& b,
+                           const instrumented<T>& c) {
+  ++detail::instrumented_counts.fma;
+  return instrumented<T>{std::fma(a.m_value, b.m_value, c.m_value)};
+}
+
+template <concepts::value T>
+inline instrumented<T> copysign(const instrumented<T>& a,
+                                const instrumented<T>& b) {
+  return instrumented<T>{std::copysign(a.m_value, b.m_value)};
+}
+
+template <concepts::value T>
+inline instrumented<T> exp(const instrumented<T>& s) {
+  return instrumented<T>{std::exp(s.m_value)};
+}
+
+template <concepts::value T>
+inline instrumented<T> log(const instrumented<T>& s) {
+  return instrumented<T>{std::log(s.m_value)};
+}
+
+template <concepts::value T>
+inline instrumented<T> sin(const instrumented<T>& s) {
+  return instrumented<T>{std::sin(s.m_value)};
+}
+
+template <concepts::value T>
+inline instrumented<T> cos(const instrumented<T>& s) {
+  return instrumented<T>{std::cos(s.m_value)};
+}
+
+template <concepts::value T>
+inline instrumented<T> tan(const instrumented<T>& s) {
+  return instrumented<T>{std::tan(s.m_value)};
+}
+
+template <concepts::value T>
+inline instrumented<T> asin(const instrumented<T>& s) {
+  return instrumented<T>{std::asin(s.m_value)};
+}
+
+template <concepts::value T>
+inline instrumented<T> acos(const instrumented<T>& s) {
+  return instrumented<T>{std::acos(s.m_value)};
+}
+
+template <concepts::value T>
+inline instrumented<T> atan(const instrumented<T>& s) {
+  return instrumented<T>{std::atan(s.m_value)};
+}
+
+template <concepts::value T>
+inline instrumented<T> atan2(const instrumented<T>& y,
+                             const instrumented<T>& x) {
+  return instrumented<T>{std::atan2(y.m_value, x.m_value)};
+}
+
+template <concepts::value T>
+inline instrumented<T> atanh(const instrumented<T>& s) {
+  return instrumented<T>{std::atanh(s.m_value)};
+}
+/// @}
+
+}  // namespace math
+
+}  // namespace algebra